@@ -22,6 +22,7 @@
 
 #include "DrawDebugHelpers.h"
 #include "IsdkDataSourcesMetaXR.h"
+#include "IsdkDataSourcesMetaXRSubsystem.h"
 #include "IsdkDataSourcesMetaXRLog.h"
 #include "IsdkOculusXRHelper.h"
 #include "Core/IsdkConditionalBool.h"
@@ -183,11 +184,20 @@ bool UIsdkFromMetaXRHandDataSource::IsRootPoseValid_Implementation()
 
 void UIsdkFromMetaXRHandDataSource::ReadHandData()
 {
-  const auto& MetaXRModule = FIsdkDataSourcesMetaXRModule::GetChecked();
+  // Tracking state and joint poses are shared by all data sources of this hand, only the first
+  // one to tick this frame queries the MetaXR module
+  FIsdkHandSnapshot& Snapshot = GetHandSnapshot();
+  if (!Snapshot.IsCurrent())
+  {
+    const auto& MetaXRModule = FIsdkDataSourcesMetaXRModule::GetChecked();
+    Snapshot.BeginFrame();
+    Snapshot.bIsHighConfidence = MetaXRModule.Input_IsTrackingHighConfidence(Handedness);
+    Snapshot.bIsTracked = MetaXRModule.Input_IsHandPositionValid(Handedness);
+  }
 
-  const bool bIsHighConfidenceData = MetaXRModule.Input_IsTrackingHighConfidence(Handedness);
+  const bool bIsHighConfidenceData = Snapshot.bIsHighConfidence;
 
-  bool CanUseHandData = MetaXRModule.Input_IsHandPositionValid(Handedness);
+  bool CanUseHandData = Snapshot.bIsTracked;
   CanUseHandData &= bAllowLowConfidenceData || bIsHighConfidenceData;
   if (CanUseHandData)
   {
@@ -207,47 +217,14 @@ void UIsdkFromMetaXRHandDataSource::ReadHandData()
     RelativePointerPose = FIsdkOculusXRHelper::GetPointerPose(Handedness, MotionController);
     bIsLastGoodPointerPoseValid = !RelativePointerPose.Equals(FTransform());
 
-    const bool bIsOpenXrSystem = IsdkXRUtils::IsUsingOpenXR();
-
-    // set the wrist bone pose
     TArray<FTransform>& JointPoses = HandData->GetJointPoses();
-
-    // Required to fix the orientation of the hands
-    // As far as I can tell can be removed when the skeleton V2 is shipped
-    const bool bIsLeft = Handedness == EIsdkHandedness::Left;
-    const FQuat OVRToOXRRotation =
-        bIsLeft ? IsdkXRUtils::OVR::OVRToOXRLeft : IsdkXRUtils::OVR::OVRToOXRRight;
-
-    // Different MetaXR plugin XrApi values require different rotation correction
-    FQuat InvWristRotation;
-    if (!bIsOpenXrSystem)
-    {
-      InvWristRotation = bIsLeft ? IsdkXRUtils::OVR::HandRootInvFixupRotationLeft
-                                 : IsdkXRUtils::OVR::HandRootInvFixupRotationRight;
-    }
-    else
-    {
-      InvWristRotation = FQuat::MakeFromEuler(FVector(0, -90, -90));
-    }
-
-    // set the bone poses
-    FTransform WristPose = FTransform::Identity;
-
-    JointPoses[1] = WristPose;
-
-    for (const auto& Bone : BoneMap)
+    if (!Snapshot.bHasJoints)
     {
-      FTransform Pose{};
-      if (!Bone.OVRBoneName.IsNone())
-      {
-        Pose = OculusXrHandComponent->GetBoneTransformByName(
-            Bone.OVRBoneName, EBoneSpaces::Type::ComponentSpace);
-        Pose.SetRotation(Pose.GetRotation() * OVRToOXRRotation);
-        Pose.SetScale3D(FVector::One());
-      }
-      Pose = Pose * FTransform(InvWristRotation);
-      JointPoses[Bone.OXRBoneIndex] = Pose;
+      Snapshot.JointPoses.SetNum(JointPoses.Num());
+      ReadJointPoses(Snapshot.JointPoses);
+      Snapshot.bHasJoints = true;
     }
+    JointPoses = Snapshot.JointPoses;
 
     if (IsValid(HandDataInbound))
     {
@@ -280,6 +257,55 @@ void UIsdkFromMetaXRHandDataSource::ReadHandData()
   }
 }
 
+FIsdkHandSnapshot& UIsdkFromMetaXRHandDataSource::GetHandSnapshot()
+{
+  const UWorld* World = GetWorld();
+  auto* Subsystem = World ? World->GetSubsystem<UIsdkDataSourcesMetaXRSubsystem>() : nullptr;
+  return Subsystem ? Subsystem->GetMutableHandSnapshot(Handedness) : LocalHandSnapshot;
+}
+
+void UIsdkFromMetaXRHandDataSource::ReadJointPoses(TArray<FTransform>& OutJointPoses)
+{
+  const bool bIsOpenXrSystem = IsdkXRUtils::IsUsingOpenXR();
+
+  // Required to fix the orientation of the hands
+  // As far as I can tell can be removed when the skeleton V2 is shipped
+  const bool bIsLeft = Handedness == EIsdkHandedness::Left;
+  const FQuat OVRToOXRRotation =
+      bIsLeft ? IsdkXRUtils::OVR::OVRToOXRLeft : IsdkXRUtils::OVR::OVRToOXRRight;
+
+  // Different MetaXR plugin XrApi values require different rotation correction
+  FQuat InvWristRotation;
+  if (!bIsOpenXrSystem)
+  {
+    InvWristRotation = bIsLeft ? IsdkXRUtils::OVR::HandRootInvFixupRotationLeft
+                               : IsdkXRUtils::OVR::HandRootInvFixupRotationRight;
+  }
+  else
+  {
+    InvWristRotation = FQuat::MakeFromEuler(FVector(0, -90, -90));
+  }
+
+  // set the bone poses
+  FTransform WristPose = FTransform::Identity;
+
+  OutJointPoses[1] = WristPose;
+
+  for (const auto& Bone : BoneMap)
+  {
+    FTransform Pose{};
+    if (!Bone.OVRBoneName.IsNone())
+    {
+      Pose = OculusXrHandComponent->GetBoneTransformByName(
+          Bone.OVRBoneName, EBoneSpaces::Type::ComponentSpace);
+      Pose.SetRotation(Pose.GetRotation() * OVRToOXRRotation);
+      Pose.SetScale3D(FVector::One());
+    }
+    Pose = Pose * FTransform(InvWristRotation);
+    OutJointPoses[Bone.OXRBoneIndex] = Pose;
+  }
+}
+
 FTransform UIsdkFromMetaXRHandDataSource::GetRootPose_Implementation()
 {
   FTransform MotionTransform = MotionController->GetComponentTransform();
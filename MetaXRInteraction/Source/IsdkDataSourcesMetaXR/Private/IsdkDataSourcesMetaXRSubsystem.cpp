@@ -241,3 +241,15 @@ bool UIsdkDataSourcesMetaXRSubsystem::IsHoldingAController()
 {
   return bIsHoldingAController;
 }
+
+const FIsdkHandSnapshot& UIsdkDataSourcesMetaXRSubsystem::GetHandSnapshot(
+    EIsdkHandedness Handedness) const
+{
+  return HandSnapshots[static_cast<uint8>(Handedness)];
+}
+
+FIsdkHandSnapshot& UIsdkDataSourcesMetaXRSubsystem::GetMutableHandSnapshot(
+    EIsdkHandedness Handedness)
+{
+  return HandSnapshots[static_cast<uint8>(Handedness)];
+}
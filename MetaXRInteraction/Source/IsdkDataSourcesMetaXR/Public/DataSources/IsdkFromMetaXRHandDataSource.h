@@ -24,6 +24,7 @@
 #include "MotionControllerComponent.h"
 #include "Core/IsdkConditionalBool.h"
 #include "DataSources/IsdkExternalHandDataSource.h"
+#include "DataSources/IsdkHandSnapshot.h"
 #include "DataSources/IsdkIHandPointerPose.h"
 #include "DataSources/IsdkIRootPose.h"
 #include "Components/PoseableMeshComponent.h"
@@ -235,6 +236,8 @@ class ISDKDATASOURCESMETAXR_API UIsdkFromMetaXRHandDataSource : public UIsdkExte
 
  private:
   void ReadHandData();
+  FIsdkHandSnapshot& GetHandSnapshot();
+  void ReadJointPoses(TArray<FTransform>& OutJointPoses);
 
   FTransform RelativePointerPose = FTransform::Identity;
 
@@ -272,6 +275,9 @@ class ISDKDATASOURCESMETAXR_API UIsdkFromMetaXRHandDataSource : public UIsdkExte
   TArray<FBoneOVRToOXRMap> BoneMap;
   TArray<float> DefaultJointRadii;
 
+  // Used in place of the subsystem's shared snapshot when the subsystem is not available
+  FIsdkHandSnapshot LocalHandSnapshot;
+
 #if !UE_BUILD_SHIPPING
   // Log the state of all relevant data source state and interfaces.
   void DebugLog();
@@ -24,6 +24,7 @@
 #include "DataSources/IsdkIHmdDataSource.h"
 #include "DataSources/IsdkFromMetaXRControllerDataSource.h"
 #include "DataSources/IsdkFromMetaXRHandDataSource.h"
+#include "DataSources/IsdkHandSnapshot.h"
 #include "Subsystem/IsdkITrackingDataSubsystem.h"
 #include "Subsystems/WorldSubsystem.h"
 #include "IsdkDataSourcesMetaXRSubsystem.generated.h"
@@ -109,6 +110,16 @@ class ISDKDATASOURCESMETAXR_API UIsdkDataSourcesMetaXRSubsystem : public UTickab
 
   virtual bool IsHoldingAController();
 
+  /**
+   * @brief Returns the hand tracking data shared by all data sources of a hand this frame.
+   * @param Handedness The hand to return the snapshot of.
+   * @return const FIsdkHandSnapshot& The snapshot, check IsCurrent() before using its contents.
+   *
+   * JointPoses use the OpenXR joint layout and are relative to the hand root pose.
+   */
+  const FIsdkHandSnapshot& GetHandSnapshot(EIsdkHandedness Handedness) const;
+  FIsdkHandSnapshot& GetMutableHandSnapshot(EIsdkHandedness Handedness);
+
  private:
   EControllerHandBehavior CurrentControllerHandBehavior;
   FIsdkTrackedDataSubsystem_ControllerHandsBehaviorChangedDelegate
@@ -119,4 +130,6 @@ class ISDKDATASOURCESMETAXR_API UIsdkDataSourcesMetaXRSubsystem : public UTickab
    * to avoid expensive calls into the meta xr module instance.
    */
   bool bIsHoldingAController = true;
+
+  FIsdkHandSnapshot HandSnapshots[2];
 };
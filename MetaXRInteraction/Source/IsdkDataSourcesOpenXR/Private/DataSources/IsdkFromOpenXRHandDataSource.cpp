@@ -20,10 +20,12 @@
 
 #include "DataSources/IsdkFromOpenXRHandDataSource.h"
 #include "DrawDebugHelpers.h"
+#include "Engine/Engine.h"
 #include "IHandTracker.h"
 #include "IsdkFunctionLibrary.h"
-#include "HeadMountedDisplayFunctionLibrary.h"
 #include "IsdkDataSourcesOpenXRLog.h"
+#include "IsdkDataSourcesOpenXRSubsystem.h"
+#include "IXRTrackingSystem.h"
 #include "DataSources/IsdkOpenXRHelper.h"
 #include "Features/IModularFeatures.h"
 #include "Utilities/IsdkXRUtils.h"
@@ -123,32 +125,53 @@ void UIsdkFromOpenXRHandDataSource::TickComponent(
     return;
   }
 
-  auto& ModularFeatures = IModularFeatures::Get();
-  if (!ModularFeatures.IsModularFeatureAvailable(IHandTracker::GetModularFeatureName()))
+  // Keypoints are shared by all data sources of this hand, only the first one to tick this frame
+  // queries the hand tracker
+  FIsdkHandSnapshot& Snapshot = GetHandSnapshot();
+  if (!Snapshot.IsCurrent())
   {
-    return;
-  }
-  auto& HandTracker =
-      ModularFeatures.GetModularFeature<IHandTracker>(IHandTracker::GetModularFeatureName());
-  bool bIsHandTrackingEnabled = HandTracker.IsHandTrackingStateValid();
-  EControllerHand Hand =
-      (Handedness == EIsdkHandedness::Left) ? EControllerHand::Left : EControllerHand::Right;
-  OutPositions.Empty();
-  OutRotations.Empty();
-  OutRadii.Empty();
+    auto& ModularFeatures = IModularFeatures::Get();
+    if (!ModularFeatures.IsModularFeatureAvailable(IHandTracker::GetModularFeatureName()))
+    {
+      return;
+    }
+    auto& HandTracker =
+        ModularFeatures.GetModularFeature<IHandTracker>(IHandTracker::GetModularFeatureName());
+    const bool bIsHandTrackingEnabled = HandTracker.IsHandTrackingStateValid();
+    EControllerHand Hand =
+        (Handedness == EIsdkHandedness::Left) ? EControllerHand::Left : EControllerHand::Right;
+    OutPositions.Reset();
+    OutRotations.Reset();
+    Snapshot.BeginFrame();
+    Snapshot.JointRadii.Reset();
 
 #if (ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 5)
-  bool bIsTracked = false;
-  bool bIsHandDataValid =
-      HandTracker.GetAllKeypointStates(Hand, OutPositions, OutRotations, OutRadii, bIsTracked);
-  bIsHandDataValid &= bIsTracked;
+    bool bIsTracked = false;
+    bool bIsHandDataValid = HandTracker.GetAllKeypointStates(
+        Hand, OutPositions, OutRotations, Snapshot.JointRadii, bIsTracked);
+    bIsHandDataValid &= bIsTracked;
 #else
-  bool bIsHandDataValid =
-      HandTracker.GetAllKeypointStates(Hand, OutPositions, OutRotations, OutRadii);
+    bool bIsHandDataValid =
+        HandTracker.GetAllKeypointStates(Hand, OutPositions, OutRotations, Snapshot.JointRadii);
 #endif
 
+    Snapshot.bIsTracked = bIsHandTrackingEnabled && bIsHandDataValid;
+    Snapshot.bIsHighConfidence = Snapshot.bIsTracked;
+    if (Snapshot.bIsTracked)
+    {
+      // The hand tracker reports keypoints in tracking space, the root pose they are made relative
+      // to in ReadHandData is in world space
+      const FTransform TrackingToWorld = GEngine && GEngine->XRSystem.IsValid()
+          ? GEngine->XRSystem->GetTrackingToWorldTransform()
+          : FTransform::Identity;
+      FIsdkOpenXRHelper::KeypointsToWorldJointPoses(
+          OutPositions, OutRotations, TrackingToWorld, Snapshot.JointPoses);
+      Snapshot.bHasJoints = !Snapshot.JointPoses.IsEmpty();
+    }
+  }
+
   FName DesiredSourceName;
-  if (bIsHandTrackingEnabled && bIsHandDataValid)
+  if (Snapshot.bIsTracked)
   {
     DesiredSourceName = Handedness == EIsdkHandedness::Left ? IsdkXRUtils::LeftSourceName
                                                             : IsdkXRUtils::RightSourceName;
@@ -157,7 +180,7 @@ void UIsdkFromOpenXRHandDataSource::TickComponent(
     {
       MotionController->SetTrackingMotionSource(DesiredSourceName);
     }
-    ReadHandData();
+    ReadHandData(Snapshot);
   }
   else
   {
@@ -170,10 +193,8 @@ void UIsdkFromOpenXRHandDataSource::TickComponent(
     IsRootPoseHighConfidence->SetValue(false);
     bIsLastGoodPointerPoseValid = false;
     bIsLastGoodRootPoseValid = false;
-    bIsHandDataValid = false;
-    bIsHandTrackingEnabled = false;
   }
-  IsRootPoseConnected->SetValue(MotionController && bIsHandDataValid && bIsHandTrackingEnabled);
+  IsRootPoseConnected->SetValue(MotionController && Snapshot.bIsTracked);
 
 #if !UE_BUILD_SHIPPING
   DebugLog();
@@ -267,15 +288,9 @@ void UIsdkFromOpenXRHandDataSource::SetAllowInvalidTrackedData(bool bInAllowInva
   bAllowLowConfidenceData = bInAllowInvalidTrackedData;
 }
 
-void UIsdkFromOpenXRHandDataSource::ReadHandData()
+void UIsdkFromOpenXRHandDataSource::ReadHandData(const FIsdkHandSnapshot& Snapshot)
 {
-  FXRMotionControllerData MotionControllerData;
-  EControllerHand Hand =
-      (Handedness == EIsdkHandedness::Left) ? EControllerHand::Left : EControllerHand::Right;
-
-  UHeadMountedDisplayFunctionLibrary::GetMotionControllerData(this, Hand, MotionControllerData);
-
-  if (MotionControllerData.bValid && !MotionControllerData.HandKeyPositions.IsEmpty())
+  if (Snapshot.bHasJoints)
   {
     bHasLastKnownGood = true;
     LastGoodRootPose = GetRootPose_Implementation();
@@ -298,18 +313,14 @@ void UIsdkFromOpenXRHandDataSource::ReadHandData()
     auto RootPoseInverse = RootPose.Inverse();
 
     JointPoses[1] = FTransform::Identity;
-    for (int32 Index = 0; Index < MotionControllerData.HandKeyPositions.Num(); ++Index)
+    for (int32 Index = 0; Index < Snapshot.JointPoses.Num(); ++Index)
     {
       if (Index == 1) // Wrist pose added above
       {
         continue;
       }
 
-      auto AdjustedTransform = FTransform(
-          MotionControllerData.HandKeyRotations[Index],
-          MotionControllerData.HandKeyPositions[Index],
-          FVector::One());
-      AdjustedTransform = AdjustedTransform * RootPoseInverse;
+      auto AdjustedTransform = Snapshot.JointPoses[Index] * RootPoseInverse;
       AdjustedTransform.SetRotation(
           AdjustedTransform.GetRotation() * IsdkXRUtils::OXR::HandJointFixupRotation);
       JointPoses[Index] = AdjustedTransform;
@@ -348,6 +359,13 @@ void UIsdkFromOpenXRHandDataSource::ReadHandedness()
   Handedness = FIsdkOpenXRHelper::ReadHandedness(MotionController);
 }
 
+FIsdkHandSnapshot& UIsdkFromOpenXRHandDataSource::GetHandSnapshot()
+{
+  const UWorld* World = GetWorld();
+  auto* Subsystem = World ? World->GetSubsystem<UIsdkDataSourcesOpenXRSubsystem>() : nullptr;
+  return Subsystem ? Subsystem->GetMutableHandSnapshot(Handedness) : LocalHandSnapshot;
+}
+
 #if !UE_BUILD_SHIPPING
 void UIsdkFromOpenXRHandDataSource::DebugLog()
 {
@@ -51,3 +51,18 @@ EIsdkHandedness FIsdkOpenXRHelper::ReadHandedness(UMotionControllerComponent* Mo
   UE_LOG(LogIsdkDataSourcesOpenXR, Error, TEXT("Motion Controller is null"));
   return EIsdkHandedness::Left; // Default to left if motion controller is null
 }
+
+void FIsdkOpenXRHelper::KeypointsToWorldJointPoses(
+    const TArray<FVector>& Positions,
+    const TArray<FQuat>& Rotations,
+    const FTransform& TrackingToWorld,
+    TArray<FTransform>& OutJointPoses)
+{
+  check(Positions.Num() == Rotations.Num());
+  OutJointPoses.SetNum(Positions.Num());
+  for (int32 Index = 0; Index < Positions.Num(); ++Index)
+  {
+    OutJointPoses[Index] =
+        FTransform(Rotations[Index], Positions[Index], FVector::One()) * TrackingToWorld;
+  }
+}
@@ -208,3 +208,15 @@ UIsdkDataSourcesOpenXRSubsystem::GetControllerHandBehaviorChangedDelegate()
 {
   return &ControllerHandsBehaviorChangedDelegate;
 }
+
+const FIsdkHandSnapshot& UIsdkDataSourcesOpenXRSubsystem::GetHandSnapshot(
+    EIsdkHandedness Handedness) const
+{
+  return HandSnapshots[static_cast<uint8>(Handedness)];
+}
+
+FIsdkHandSnapshot& UIsdkDataSourcesOpenXRSubsystem::GetMutableHandSnapshot(
+    EIsdkHandedness Handedness)
+{
+  return HandSnapshots[static_cast<uint8>(Handedness)];
+}
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * Licensed under the Oculus SDK License Agreement (the "License");
+ * you may not use the Oculus SDK except in compliance with the License,
+ * which is provided at the time of installation or download, or which
+ * otherwise accompanies this software in either electronic or hard copy form.
+ *
+ * You may obtain a copy of the License at
+ *
+ * https://developer.oculus.com/licenses/oculussdk/
+ *
+ * Unless required by applicable law or agreed to in writing, the Oculus SDK
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "DataSources/IsdkOpenXRHelper.h"
+#include "Misc/AutomationTest.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FIsdkOpenXRHelperKeypointsTest,
+    "InteractionSDK.OculusInteraction.Source.IsdkDataSourcesOpenXR.Private.Tests.FIsdkOpenXRHelperKeypointsTest.All",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FIsdkOpenXRHelperKeypointsTest::RunTest(const FString& Parameters)
+{
+  const TArray<FVector> Positions = {FVector(10, 0, 0), FVector(0, 20, 5)};
+  const TArray<FQuat> Rotations = {
+      FQuat::Identity, FQuat(FVector::ForwardVector, FMath::DegreesToRadians(30.0))};
+
+  // Identity tracking to world keeps the keypoints as they are
+  {
+    TArray<FTransform> JointPoses;
+    FIsdkOpenXRHelper::KeypointsToWorldJointPoses(
+        Positions, Rotations, FTransform::Identity, JointPoses);
+    TestEqual(TEXT("Identity: joint count"), JointPoses.Num(), Positions.Num());
+    TestEqual(TEXT("Identity: position"), JointPoses[1].GetLocation(), Positions[1]);
+    TestTrue(
+        TEXT("Identity: rotation"),
+        JointPoses[1].GetRotation().Equals(Rotations[1], KINDA_SMALL_NUMBER));
+  }
+
+  // A rotated, offset and scaled tracking origin moves the keypoints into world space
+  {
+    const FQuat OriginRotation(FVector::UpVector, FMath::DegreesToRadians(90.0));
+    const FTransform TrackingToWorld(OriginRotation, FVector(100, 200, 0), FVector(2.0));
+
+    TArray<FTransform> JointPoses;
+    FIsdkOpenXRHelper::KeypointsToWorldJointPoses(
+        Positions, Rotations, TrackingToWorld, JointPoses);
+    TestEqual(TEXT("TrackingToWorld: joint count"), JointPoses.Num(), Positions.Num());
+    for (int32 Index = 0; Index < Positions.Num(); ++Index)
+    {
+      const FVector ExpectedPosition = TrackingToWorld.TransformPosition(Positions[Index]);
+      const FQuat ExpectedRotation = OriginRotation * Rotations[Index];
+      TestTrue(
+          FString::Printf(TEXT("TrackingToWorld: position %d"), Index),
+          JointPoses[Index].GetLocation().Equals(ExpectedPosition, KINDA_SMALL_NUMBER));
+      TestTrue(
+          FString::Printf(TEXT("TrackingToWorld: rotation %d"), Index),
+          JointPoses[Index].GetRotation().Equals(ExpectedRotation, KINDA_SMALL_NUMBER));
+    }
+    // (10, 0, 0) scaled by 2 and turned 90 degrees about up lands at (0, 20, 0) from the origin
+    TestTrue(
+        TEXT("TrackingToWorld: first joint"),
+        JointPoses[0].GetLocation().Equals(FVector(100, 220, 0), KINDA_SMALL_NUMBER));
+  }
+
+  return true;
+}
@@ -24,6 +24,7 @@
 #include "MotionControllerComponent.h"
 #include "Core/IsdkConditionalBool.h"
 #include "DataSources/IsdkExternalHandDataSource.h"
+#include "DataSources/IsdkHandSnapshot.h"
 #include "DataSources/IsdkIHandPointerPose.h"
 #include "DataSources/IsdkIRootPose.h"
 #include "IsdkFromOpenXRHandDataSource.generated.h"
@@ -208,8 +209,9 @@ class ISDKDATASOURCESOPENXR_API UIsdkFromOpenXRHandDataSource : public UIsdkExte
   void SetAllowInvalidTrackedData(bool bInAllowInvalidTrackedData);
 
  private:
-  void ReadHandData();
+  void ReadHandData(const FIsdkHandSnapshot& Snapshot);
   void ReadHandedness();
+  FIsdkHandSnapshot& GetHandSnapshot();
 
 #if !UE_BUILD_SHIPPING
   void DebugLog();
@@ -218,7 +220,9 @@ class ISDKDATASOURCESOPENXR_API UIsdkFromOpenXRHandDataSource : public UIsdkExte
   FTransform RelativePointerPose{};
   TArray<FVector> OutPositions;
   TArray<FQuat> OutRotations;
-  TArray<float> OutRadii;
+
+  // Used in place of the subsystem's shared snapshot when the subsystem is not available
+  FIsdkHandSnapshot LocalHandSnapshot;
 
   bool bIsLastGoodRootPoseValid = false;
   bool bIsLastGoodPointerPoseValid = false;
@@ -34,4 +34,14 @@ class ISDKDATASOURCESOPENXR_API FIsdkOpenXRHelper
   ~FIsdkOpenXRHelper();
 
   static EIsdkHandedness ReadHandedness(UMotionControllerComponent* MotionController);
+
+  /**
+   * @brief Builds world space joint poses from hand tracker keypoints, which are reported in
+   * tracking space.
+   */
+  static void KeypointsToWorldJointPoses(
+      const TArray<FVector>& Positions,
+      const TArray<FQuat>& Rotations,
+      const FTransform& TrackingToWorld,
+      TArray<FTransform>& OutJointPoses);
 };
@@ -26,6 +26,7 @@
 #include "DataSources/IsdkFromOpenXRControllerDataSource.h"
 #include "DataSources/IsdkFromOpenXRHandDataSource.h"
 #include "DataSources/IsdkFromOpenXRHmdDataSource.h"
+#include "DataSources/IsdkHandSnapshot.h"
 #include "Subsystems/WorldSubsystem.h"
 #include "IsdkDataSourcesOpenXRSubsystem.generated.h"
 
@@ -102,10 +103,23 @@ class ISDKDATASOURCESOPENXR_API UIsdkDataSourcesOpenXRSubsystem : public UWorldS
   virtual FIsdkTrackedDataSubsystem_ControllerHandsBehaviorChangedDelegate*
   GetControllerHandBehaviorChangedDelegate() override;
 
+  /**
+   * @brief Returns the hand tracking data shared by all data sources of a hand this frame.
+   * @param Handedness The hand to return the snapshot of.
+   * @return const FIsdkHandSnapshot& The snapshot, check IsCurrent() before using its contents.
+   *
+   * JointPoses are the hand tracker keypoints, moved from tracking space to world space with the
+   * XR system's tracking to world transform of the frame they were read in.
+   */
+  const FIsdkHandSnapshot& GetHandSnapshot(EIsdkHandedness Handedness) const;
+  FIsdkHandSnapshot& GetMutableHandSnapshot(EIsdkHandedness Handedness);
+
  private:
   EControllerHandBehavior CurrentControllerHandBehavior;
   FIsdkTrackedDataSubsystem_ControllerHandsBehaviorChangedDelegate
       ControllerHandsBehaviorChangedDelegate;
 
   bool bIsHoldingAController = true;
+
+  FIsdkHandSnapshot HandSnapshots[2];
 };
@@ -41,7 +41,10 @@ void UIsdkDistanceGrabDetector::Initialize(UIsdkGrabberComponent* InGrabberCompo
 
   DistanceGrabCollider = NewObject<USphereComponent>(this, TEXT("Distance Grab Collider"));
   DistanceGrabCollider->InitSphereRadius(FrustumRadius);
-  DistanceGrabCollider->SetCollisionEnabled(ECollisionEnabled::Type::QueryOnly);
+  // With the registry, the collider only exists for compatibility, so keep it out of physics
+  DistanceGrabCollider->SetCollisionEnabled(
+      bUseGrabbableRegistry ? ECollisionEnabled::Type::NoCollision
+                            : ECollisionEnabled::Type::QueryOnly);
   DistanceGrabCollider->SetCollisionObjectType(CollisionObjectType);
   DistanceGrabCollider->SetCollisionResponseToAllChannels(ECollisionResponse::ECR_Overlap);
   DistanceGrabCollider->SetMobility(EComponentMobility::Movable);
@@ -56,6 +59,39 @@ void UIsdkDistanceGrabDetector::Tick(float DeltaTime)
   CandidateGrabbable = nullptr;
   float LeastAngle = FLT_MAX;
 
+  FTransform PointerTransform = FTransform::Identity;
+  GrabberComponent->GetPointerTransform(PointerTransform);
+  const FVector PointerLocation = PointerTransform.GetLocation();
+  const FVector PointerVector = PointerTransform.GetRotation().GetForwardVector();
+
+  UIsdkGrabbableSubsystem* GrabbableSubsystem =
+      bUseGrabbableRegistry ? UIsdkGrabbableSubsystem::TryGet(GetWorld()) : nullptr;
+  if (GrabbableSubsystem)
+  {
+    // The registry returns every grabbable whose bounds touch the cone, which we then filter
+    // exactly as the overlap path does. That includes the collision filtering an overlap would
+    // have applied, since the registry knows nothing about collision settings.
+    QueryHits.Reset();
+    const ECollisionChannel DetectorObjectType = DistanceGrabCollider->GetCollisionObjectType();
+    GrabbableSubsystem->QueryCone(
+        PointerLocation,
+        PointerVector,
+        FrustumRadius,
+        FMath::DegreesToRadians(FrustumAngle * 0.5f),
+        QueryHits);
+    for (const FIsdkGrabbableQueryHit& Hit : QueryHits)
+    {
+      if (!IsValid(Hit.Collider) || !Hit.Collider->IsQueryCollisionEnabled() ||
+          Hit.Collider->GetCollisionResponseToChannel(DetectorObjectType) == ECR_Ignore)
+      {
+        continue;
+      }
+      ConsiderGrabbable(
+          Hit.Grabbable, Hit.Bounds.GetSphere(), PointerLocation, PointerVector, LeastAngle);
+    }
+    return;
+  }
+
   // We use a sphere collider to detect all potential cone overlaps, and then filter the set of
   // hovered components down to just those that are within the distance grab cone.
   TArray<UPrimitiveComponent*> OverlappedComponents;
@@ -63,62 +99,66 @@ void UIsdkDistanceGrabDetector::Tick(float DeltaTime)
   for (const auto OverlappedComponent : OverlappedComponents)
   {
     const auto Grabbable = UIsdkFunctionLibrary::FindGrabbableByComponent(OverlappedComponent);
-    if (!Grabbable || !Grabbable->IsDistanceGrabAllowed())
-    {
-      continue;
-    }
+    ConsiderGrabbable(
+        Grabbable,
+        OverlappedComponent->Bounds.GetSphere(),
+        PointerLocation,
+        PointerVector,
+        LeastAngle);
+  }
+}
 
-    // Must match on at least one input method to be considered hovered
-    const bool bPinchMatches = Grabbable->IsGrabInputMethodAllowed(EIsdkGrabInputMethod::Pinch) &&
-        GrabberComponent->IsGrabInputMethodAllowed(EIsdkGrabInputMethod::Pinch);
-    const bool bPalmMatches = Grabbable->IsGrabInputMethodAllowed(EIsdkGrabInputMethod::Palm) &&
-        GrabberComponent->IsGrabInputMethodAllowed(EIsdkGrabInputMethod::Palm);
-    if (!bPinchMatches && !bPalmMatches)
-    {
-      continue;
-    }
+void UIsdkDistanceGrabDetector::ConsiderGrabbable(
+    UIsdkGrabbableComponent* Grabbable,
+    const FSphere& BoundsSphere,
+    const FVector& PointerLocation,
+    const FVector& PointerVector,
+    float& InOutLeastAngle)
+{
+  if (!IsValid(Grabbable) || !Grabbable->IsDistanceGrabAllowed())
+  {
+    return;
+  }
 
-    // Don't detect grabbables which are already being grabbed.  Otherwise, this leads to a lot of
-    // false positive grabs, where an inactive hand at rest triggers a pinch/palm grab
-    // unintentionally while hovering a grabbed object.  We may want to provide this as a
-    // configurable option in the future, but for now we provide this as the most sensible default.
-    if (Grabbable->GetGrabTransformer() && Grabbable->GetGrabTransformer()->GetNumGrabbers() >= 1)
-    {
-      continue;
-    }
+  // Must match on at least one input method to be considered hovered
+  const bool bPinchMatches = Grabbable->IsGrabInputMethodAllowed(EIsdkGrabInputMethod::Pinch) &&
+      GrabberComponent->IsGrabInputMethodAllowed(EIsdkGrabInputMethod::Pinch);
+  const bool bPalmMatches = Grabbable->IsGrabInputMethodAllowed(EIsdkGrabInputMethod::Palm) &&
+      GrabberComponent->IsGrabInputMethodAllowed(EIsdkGrabInputMethod::Palm);
+  if (!bPinchMatches && !bPalmMatches)
+  {
+    return;
+  }
 
-    FTransform PointerTransform = FTransform::Identity;
-    GrabberComponent->GetPointerTransform(PointerTransform);
-
-    // Compute the closest point on the overlapped component's sphere bounds to our cone's center
-    // line
-    const auto BoundsSphere = OverlappedComponent->Bounds.GetSphere();
-    FVector ClosestPointOnBounds;
-    FMath::SphereDistToLine(
-        BoundsSphere.Center,
-        BoundsSphere.W,
-        PointerTransform.GetLocation(),
-        PointerTransform.GetRotation().GetForwardVector(),
-        ClosestPointOnBounds);
-
-    // Compute the angle between that point and the cone's center line
-    const auto GrabbableVector =
-        (ClosestPointOnBounds - PointerTransform.GetLocation()).GetSafeNormal();
-    const auto PointerVector = PointerTransform.GetRotation().GetForwardVector();
-    const float DotProduct = FVector::DotProduct(GrabbableVector, PointerVector);
-    const float AngleRadians = FMath::Acos(DotProduct);
-    const float AngleDegrees = FMath::Abs(FMath::RadiansToDegrees(AngleRadians));
-
-    // Add all hovered grabbables within the angle threshold
-    if (AngleDegrees <= FrustumAngle * 0.5)
-    {
-      HoveredGrabbables.Add(Grabbable);
+  // Don't detect grabbables which are already being grabbed.  Otherwise, this leads to a lot of
+  // false positive grabs, where an inactive hand at rest triggers a pinch/palm grab
+  // unintentionally while hovering a grabbed object.  We may want to provide this as a
+  // configurable option in the future, but for now we provide this as the most sensible default.
+  if (Grabbable->GetGrabTransformer() && Grabbable->GetGrabTransformer()->GetNumGrabbers() >= 1)
+  {
+    return;
+  }
 
-      if (AngleDegrees < LeastAngle)
-      {
-        LeastAngle = AngleDegrees;
-        CandidateGrabbable = Grabbable;
-      }
+  // Compute the closest point on the grabbable's sphere bounds to our cone's center line
+  FVector ClosestPointOnBounds;
+  FMath::SphereDistToLine(
+      BoundsSphere.Center, BoundsSphere.W, PointerLocation, PointerVector, ClosestPointOnBounds);
+
+  // Compute the angle between that point and the cone's center line
+  const auto GrabbableVector = (ClosestPointOnBounds - PointerLocation).GetSafeNormal();
+  const float DotProduct = FVector::DotProduct(GrabbableVector, PointerVector);
+  const float AngleRadians = FMath::Acos(DotProduct);
+  const float AngleDegrees = FMath::Abs(FMath::RadiansToDegrees(AngleRadians));
+
+  // Add all hovered grabbables within the angle threshold
+  if (AngleDegrees <= FrustumAngle * 0.5)
+  {
+    HoveredGrabbables.Add(Grabbable);
+
+    if (AngleDegrees < InOutLeastAngle)
+    {
+      InOutLeastAngle = AngleDegrees;
+      CandidateGrabbable = Grabbable;
     }
   }
 }
@@ -39,47 +39,117 @@ void UIsdkRayGrabDetector::Tick(float DeltaTime)
   const auto End = PointerTransform.GetLocation() +
       PointerTransform.GetRotation().GetForwardVector() * RayLength;
 
-  TArray<FHitResult> OutHits;
+  HoveredGrabbable = nullptr;
+
+  UIsdkGrabbableSubsystem* GrabbableSubsystem =
+      bUseGrabbableRegistry ? UIsdkGrabbableSubsystem::TryGet(GetWorld()) : nullptr;
+  if (GrabbableSubsystem)
+  {
+    TraceGrabbableRegistry(*GrabbableSubsystem, Start, End);
+  }
+  else
+  {
+    TArray<FHitResult> OutHits;
+    const FCollisionObjectQueryParams ObjectQueryParams(ObjectQueryTypes);
+    const FCollisionQueryParams CollisionQueryParams;
+    GetWorld()->LineTraceMultiByObjectType(
+        OutHits, Start, End, ObjectQueryParams, CollisionQueryParams);
+
+    for (const auto& Hit : OutHits)
+    {
+      const auto Grabbable = UIsdkFunctionLibrary::FindGrabbableByComponent(Hit.GetComponent());
+      if (!IsHoverable(Grabbable))
+      {
+        continue;
+      }
+
+      HoveredGrabbable = Grabbable;
+      CurrentHit = Hit;
+      break;
+    }
+  }
+
+  if (!IsValid(HoveredGrabbable))
+  {
+    CurrentHit = FHitResult();
+  }
+}
+
+void UIsdkRayGrabDetector::TraceGrabbableRegistry(
+    UIsdkGrabbableSubsystem& GrabbableSubsystem,
+    const FVector& Start,
+    const FVector& End)
+{
+  // Candidates come back ordered by where the ray enters their bounds, so once a candidate's
+  // bounds start behind the closest exact hit, nothing further along can be closer
+  QueryHits.Reset();
+  GrabbableSubsystem.QueryRay(Start, End, QueryHits);
+
   const FCollisionObjectQueryParams ObjectQueryParams(ObjectQueryTypes);
   const FCollisionQueryParams CollisionQueryParams;
-  GetWorld()->LineTraceMultiByObjectType(
-      OutHits, Start, End, ObjectQueryParams, CollisionQueryParams);
-
-  HoveredGrabbable = nullptr;
-  for (const auto& Hit : OutHits)
+  float ClosestHitDistance = FLT_MAX;
+  for (const FIsdkGrabbableQueryHit& QueryHit : QueryHits)
   {
-    const auto Grabbable = UIsdkFunctionLibrary::FindGrabbableByComponent(Hit.GetComponent());
-    if (!Grabbable || !Grabbable->IsRayGrabAllowed())
+    if (QueryHit.Distance > ClosestHitDistance)
+    {
+      break;
+    }
+
+    UPrimitiveComponent* Collider = QueryHit.Collider;
+    if (!IsValid(Collider) || !Collider->IsQueryCollisionEnabled() ||
+        !IsHoverable(QueryHit.Grabbable))
     {
       continue;
     }
 
-    // Must match on at least one input method to be considered hovered
-    const bool bPinchMatches = Grabbable->IsGrabInputMethodAllowed(EIsdkGrabInputMethod::Pinch) &&
-        GrabberComponent->IsGrabInputMethodAllowed(EIsdkGrabInputMethod::Pinch);
-    const bool bPalmMatches = Grabbable->IsGrabInputMethodAllowed(EIsdkGrabInputMethod::Palm) &&
-        GrabberComponent->IsGrabInputMethodAllowed(EIsdkGrabInputMethod::Palm);
-    if (!bPinchMatches && !bPalmMatches)
+    // An empty ObjectQueryTypes detects all object types
+    if (!ObjectQueryTypes.IsEmpty() &&
+        !(ObjectQueryParams.GetQueryBitfield() &
+          ECC_TO_BITFIELD(Collider->GetCollisionObjectType())))
     {
       continue;
     }
 
-    // Don't detect grabbables which are already being grabbed.  This is mostly to keep consistent
-    // with distance grab, which can trigger a lot of unintentional grabs if we allow this behavior.
-    if (Grabbable->GetGrabTransformer() && Grabbable->GetGrabTransformer()->GetNumGrabbers() >= 1)
+    FHitResult Hit;
+    if (!Collider->LineTraceComponent(Hit, Start, End, CollisionQueryParams))
     {
       continue;
     }
 
-    HoveredGrabbable = Grabbable;
-    CurrentHit = Hit;
-    break;
+    const float HitDistance = FVector::Dist(Start, Hit.Location);
+    if (HitDistance < ClosestHitDistance)
+    {
+      ClosestHitDistance = HitDistance;
+      HoveredGrabbable = QueryHit.Grabbable;
+      CurrentHit = Hit;
+    }
+  }
+}
+
+bool UIsdkRayGrabDetector::IsHoverable(UIsdkGrabbableComponent* Grabbable) const
+{
+  if (!IsValid(Grabbable) || !Grabbable->IsRayGrabAllowed())
+  {
+    return false;
   }
 
-  if (!IsValid(HoveredGrabbable))
+  // Must match on at least one input method to be considered hovered
+  const bool bPinchMatches = Grabbable->IsGrabInputMethodAllowed(EIsdkGrabInputMethod::Pinch) &&
+      GrabberComponent->IsGrabInputMethodAllowed(EIsdkGrabInputMethod::Pinch);
+  const bool bPalmMatches = Grabbable->IsGrabInputMethodAllowed(EIsdkGrabInputMethod::Palm) &&
+      GrabberComponent->IsGrabInputMethodAllowed(EIsdkGrabInputMethod::Palm);
+  if (!bPinchMatches && !bPalmMatches)
   {
-    CurrentHit = FHitResult();
+    return false;
+  }
+
+  // Don't detect grabbables which are already being grabbed.  This is mostly to keep consistent
+  // with distance grab, which can trigger a lot of unintentional grabs if we allow this behavior.
+  if (Grabbable->GetGrabTransformer() && Grabbable->GetGrabTransformer()->GetNumGrabbers() >= 1)
+  {
+    return false;
   }
+  return true;
 }
 
 void UIsdkRayGrabDetector::Select(EIsdkGrabInputMethod InputMethod)
@@ -27,6 +27,15 @@
 #include "Interaction/Grabbable/IsdkGrabFreeTransformer.h"
 #include "Interaction/Grabbable/IsdkTransformer.h"
 #include "Interaction/Motion/IsdkGrabMotion.h"
+#include "Subsystem/IsdkWorldSubsystem.h"
+
+namespace isdk
+{
+TAutoConsoleVariable<bool> CVar_Meta_InteractionSDK_DeferGrabTransforms(
+    TEXT("Meta.InteractionSDK.DeferGrabTransforms"),
+    true,
+    TEXT("Applies grab transform updates once per frame, after interaction events are dispatched"));
+} // namespace isdk
 
 UIsdkGrabTransformerComponent::UIsdkGrabTransformerComponent()
 {
@@ -296,8 +305,7 @@ void UIsdkGrabTransformerComponent::BeginTransform()
     ThrowableComponent->StartTracking(TransformTarget);
   }
 
-  ActiveGrabTransformer->BeginTransform(
-      GrabPoses.GetSelectPoses(), FIsdkTargetTransform(TransformTarget));
+  ActiveGrabTransformer->BeginTransform(GrabPoses.GetSelectPoses(), GetCurrentTargetTransform());
   GrabTransformerEvent.Broadcast(TransformEvent::BeginTransform, this);
 }
 
@@ -360,7 +368,7 @@ void UIsdkGrabTransformerComponent::UpdateTransform()
   {
     if (IsValid(LastInteractor))
     {
-      FTransform TargetTransform = TransformTarget->GetComponentToWorld();
+      FTransform TargetTransform = GetCurrentTargetTransform().WorldTransform;
       FTransform InteractorTransform = LastInteractor->GetComponentToWorld();
       FTransform ResultTransform =
           CalculateInteractorSnapTransform(TargetTransform, InteractorTransform);
@@ -389,7 +397,7 @@ void UIsdkGrabTransformerComponent::UpdateTransform()
         }
       }
 
-      TransformTarget->SetRelativeTransform(ResultTransform);
+      ApplyUpdatedTransform(ResultTransform);
     }
     else
     {
@@ -400,16 +408,54 @@ void UIsdkGrabTransformerComponent::UpdateTransform()
               "UIsdkGrabTransformerComponent::UpdateTransform() - LastInteractor for Interactor Snapping was invalid!"));
       // Defaulting to normal behavior
       const auto TargetRelativeTransform = ActiveGrabTransformer->UpdateTransform(
-          GrabPoses.GetSelectPoses(), FIsdkTargetTransform(TransformTarget));
-      TransformTarget->SetRelativeTransform(TargetRelativeTransform);
+          GrabPoses.GetSelectPoses(), GetCurrentTargetTransform());
+      ApplyUpdatedTransform(TargetRelativeTransform);
     }
   }
   else
   {
     const auto TargetRelativeTransform = ActiveGrabTransformer->UpdateTransform(
-        GrabPoses.GetSelectPoses(), FIsdkTargetTransform(TransformTarget));
-    TransformTarget->SetRelativeTransform(TargetRelativeTransform);
+        GrabPoses.GetSelectPoses(), GetCurrentTargetTransform());
+    ApplyUpdatedTransform(TargetRelativeTransform);
+  }
+}
+
+FIsdkTargetTransform UIsdkGrabTransformerComponent::GetCurrentTargetTransform() const
+{
+  FIsdkTargetTransform Target(TransformTarget);
+
+  // An update from earlier in this frame may not have been committed yet
+  const UIsdkWorldSubsystem* WorldSubsystem = UIsdkWorldSubsystem::TryGet(GetWorld());
+  if (const FTransform* PendingTransform = IsValid(WorldSubsystem)
+          ? WorldSubsystem->FindPendingTransformCommit(TransformTarget)
+          : nullptr)
+  {
+    Target.RelativeTransform = *PendingTransform;
+    Target.WorldTransform = *PendingTransform * Target.ParentWorldTransform;
+  }
+  return Target;
+}
+
+void UIsdkGrabTransformerComponent::ApplyUpdatedTransform(const FTransform& RelativeTransform)
+{
+  UIsdkWorldSubsystem* WorldSubsystem = UIsdkWorldSubsystem::TryGet(GetWorld());
+  if (isdk::CVar_Meta_InteractionSDK_DeferGrabTransforms.GetValueOnGameThread() &&
+      IsValid(WorldSubsystem))
+  {
+    // Committed with every other grab of this frame, listeners are told once it has moved
+    WorldSubsystem->QueueTransformCommit(
+        TransformTarget,
+        RelativeTransform,
+        FSimpleDelegate::CreateUObject(this, &ThisClass::BroadcastUpdateTransformEvent));
+    return;
   }
+
+  TransformTarget->SetRelativeTransform(RelativeTransform);
+  BroadcastUpdateTransformEvent();
+}
+
+void UIsdkGrabTransformerComponent::BroadcastUpdateTransformEvent()
+{
   GrabTransformerEvent.Broadcast(TransformEvent::UpdateTransform, this);
 }
 
@@ -425,8 +471,13 @@ void UIsdkGrabTransformerComponent::EndTransform()
     return;
   }
 
-  auto TargetRelativeTransform =
-      ActiveGrabTransformer->EndTransform(FIsdkTargetTransform(TransformTarget));
+  // The final transform is applied right away, a pending update would otherwise land after physics
+  // has been handed back to the target on release
+  auto TargetRelativeTransform = ActiveGrabTransformer->EndTransform(GetCurrentTargetTransform());
+  if (UIsdkWorldSubsystem* WorldSubsystem = UIsdkWorldSubsystem::TryGet(GetWorld()))
+  {
+    WorldSubsystem->DiscardPendingTransformCommit(TransformTarget);
+  }
   TransformTarget->SetRelativeTransform(TargetRelativeTransform);
   GrabTransformerEvent.Broadcast(TransformEvent::EndTransform, this);
 
@@ -490,7 +541,7 @@ void UIsdkGrabTransformerComponent::ExecuteInteractorSnap(
   if (MoveSnapDuration > 0.f)
   {
     bInteractorMoveSnapEnabled = true;
-    MoveSnapState.StartingTransform = TransformTarget->GetComponentToWorld();
+    MoveSnapState.StartingTransform = GetCurrentTargetTransform().WorldTransform;
     MoveSnapState.StartTime = GetWorld()->GetRealTimeSeconds();
     MoveSnapState.SecondsDuration = MoveSnapDuration;
   }
@@ -134,6 +134,7 @@ UIsdkClippedPlaneSurface::UIsdkClippedPlaneSurface()
 
             // Create Clipped Plane Surface
             ClippedPlaneSurfacePtr Instance{};
+            NativeClipperScale = PointablePlane->GetComponentTransform().GetScale3D();
             if (BoundsClippers.Num() > 0)
             {
               std::vector<isdk_BoundsClipper> IsdkBoundsClippers =
@@ -173,6 +174,51 @@ ClippedPlaneSurface* UIsdkClippedPlaneSurface::GetApiClippedPlaneSurface()
   return ClippedPlaneSurfaceImpl->GetOrCreateInstance();
 }
 
+bool UIsdkClippedPlaneSurface::GetWorldBoundingSphere(FSphere& OutSphere) const
+{
+  if (bWorldBoundingSphereDirty)
+  {
+    bHasWorldBoundingSphere = ComputeWorldBoundingSphere(CachedWorldBoundingSphere);
+    bWorldBoundingSphereDirty = false;
+  }
+  OutSphere = CachedWorldBoundingSphere;
+  return bHasWorldBoundingSphere;
+}
+
+bool UIsdkClippedPlaneSurface::ComputeWorldBoundingSphere(FSphere& OutSphere) const
+{
+  if (!IsValid(PointablePlane))
+  {
+    return false;
+  }
+  if (BoundsClippers.IsEmpty())
+  {
+    return PointablePlane->GetWorldBoundingSphere(OutSphere);
+  }
+
+  // The surface lies within the union of the clippers. Mirror GenerateNativeBoundsClippers: the
+  // clippers are posed without scale, and their offset and size are scaled by the plane.
+  const FVector PlaneScale = PointablePlane->GetComponentTransform().GetScale3D();
+  FSphere ClipperBounds(ForceInit);
+  for (const FIsdkBoundsClipper& Clipper : BoundsClippers)
+  {
+    const USceneComponent* PoseComponent = Cast<USceneComponent>(Clipper.PoseProvider.GetObject());
+    if (!IsValid(PoseComponent))
+    {
+      // Without a scene component there is no cheap way to locate the clipper.
+      return false;
+    }
+    const FVector Center = PoseComponent->GetComponentTransform().TransformPositionNoScale(
+        FVector(Clipper.Position) * PlaneScale);
+    // Clipper sizes are full box sizes, like the pointable box's
+    const FVector HalfExtent = FVector(Clipper.Size) / 2.0 * PlaneScale.GetAbs();
+    const double Radius = HalfExtent.Size();
+    ClipperBounds += FSphere(Center, Radius);
+  }
+  OutSphere = ClipperBounds;
+  return true;
+}
+
 const TArray<FIsdkBoundsClipper>& UIsdkClippedPlaneSurface::GetBoundsClippers() const
 {
   return BoundsClippers;
@@ -186,6 +232,8 @@ const UIsdkPointablePlane* UIsdkClippedPlaneSurface::GetPointablePlane() const
 void UIsdkClippedPlaneSurface::SetBoundsClippers(const TArray<FIsdkBoundsClipper>& InBoundsClippers)
 {
   BoundsClippers = InBoundsClippers;
+  bWorldBoundingSphereDirty = true;
+  BindClipperTransformUpdates();
   UpdateNativeBoundsClipper();
 }
 
@@ -196,6 +244,7 @@ void UIsdkClippedPlaneSurface::SetPointablePlane(UIsdkPointablePlane* InPointabl
     PointablePlane->TransformUpdated.Remove(TransformUpdatedDelegateHandle);
   }
   PointablePlane = InPointablePlane;
+  bWorldBoundingSphereDirty = true;
   if (IsValid(PointablePlane))
   {
     TransformUpdatedDelegateHandle = PointablePlane->TransformUpdated.AddWeakLambda(
@@ -203,17 +252,63 @@ void UIsdkClippedPlaneSurface::SetPointablePlane(UIsdkPointablePlane* InPointabl
         [this](
             USceneComponent* RootComponent,
             EUpdateTransformFlags UpdateTransformFlags,
-            ETeleportType Teleport) { UpdateNativeBoundsClipper(); });
+            ETeleportType Teleport) { HandlePointablePlaneTransformUpdated(); });
   }
+  BindClipperTransformUpdates();
   checkf(
       !ClippedPlaneSurfaceImpl->IsInstanceValid(),
       TEXT("SetPointablePlane can only be called prior to BeginPlay"));
 }
 
+void UIsdkClippedPlaneSurface::HandlePointablePlaneTransformUpdated()
+{
+  bWorldBoundingSphereDirty = true;
+
+  // Native clippers are relative to their pose providers, so only a change of scale affects them.
+  if (IsValid(PointablePlane) &&
+      !PointablePlane->GetComponentTransform().GetScale3D().Equals(NativeClipperScale))
+  {
+    UpdateNativeBoundsClipper();
+  }
+}
+
+void UIsdkClippedPlaneSurface::BindClipperTransformUpdates()
+{
+  UnbindClipperTransformUpdates();
+  for (const FIsdkBoundsClipper& Clipper : BoundsClippers)
+  {
+    USceneComponent* PoseComponent = Cast<USceneComponent>(Clipper.PoseProvider.GetObject());
+    if (!IsValid(PoseComponent) || PoseComponent == PointablePlane ||
+        ClipperTransformUpdatedHandles.ContainsByPredicate(
+            [PoseComponent](const auto& Entry) { return Entry.Key == PoseComponent; }))
+    {
+      continue;
+    }
+    const FDelegateHandle Handle = PoseComponent->TransformUpdated.AddWeakLambda(
+        this,
+        [this](USceneComponent*, EUpdateTransformFlags, ETeleportType)
+        { bWorldBoundingSphereDirty = true; });
+    ClipperTransformUpdatedHandles.Emplace(PoseComponent, Handle);
+  }
+}
+
+void UIsdkClippedPlaneSurface::UnbindClipperTransformUpdates()
+{
+  for (const auto& Entry : ClipperTransformUpdatedHandles)
+  {
+    if (USceneComponent* PoseComponent = Entry.Key.Get())
+    {
+      PoseComponent->TransformUpdated.Remove(Entry.Value);
+    }
+  }
+  ClipperTransformUpdatedHandles.Reset();
+}
+
 void UIsdkClippedPlaneSurface::UpdateNativeBoundsClipper()
 {
   if (ClippedPlaneSurfaceImpl->IsInstanceValid() && IsValid(PointablePlane))
   {
+    NativeClipperScale = PointablePlane->GetComponentTransform().GetScale3D();
     isdk::api::ClippedPlaneSurface* surface = GetApiClippedPlaneSurface();
     std::vector<isdk_BoundsClipper> IsdkBoundsClippers =
         isdk::api::helper::FClippedPlaneSurfaceImpl::GenerateNativeBoundsClippers(
@@ -256,6 +351,7 @@ void UIsdkClippedPlaneSurface::GetDebugSegments(TArray<TPair<FVector, FVector>>&
 
 void UIsdkClippedPlaneSurface::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
+  UnbindClipperTransformUpdates();
   ClippedPlaneSurfaceImpl->DestroyInstance();
   Super::EndPlay(EndPlayReason);
 }
@@ -20,6 +20,7 @@
 
 #include "Interaction/IsdkGrabbableComponent.h"
 #include "Subsystem/IsdkWorldSubsystem.h"
+#include "Subsystem/IsdkGrabbableSubsystem.h"
 #include "CoreMinimal.h"
 #include "IsdkRuntimeSettings.h"
 #include "OculusInteractionLog.h"
@@ -93,9 +94,36 @@ void UIsdkGrabbableComponent::BeginPlay()
   }
 #endif
 
+  if (UIsdkGrabbableSubsystem* GrabbableSubsystem = UIsdkGrabbableSubsystem::TryGet(GetWorld()))
+  {
+    GrabbableSubsystem->RegisterGrabbable(this);
+  }
+
   Super::BeginPlay();
 }
 
+void UIsdkGrabbableComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+  if (UIsdkGrabbableSubsystem* GrabbableSubsystem = UIsdkGrabbableSubsystem::TryGet(GetWorld()))
+  {
+    GrabbableSubsystem->UnregisterGrabbable(this);
+  }
+
+  Super::EndPlay(EndPlayReason);
+}
+
+void UIsdkGrabbableComponent::NotifyGrabColliderChanged()
+{
+  if (!HasBegunPlay())
+  {
+    return;
+  }
+  if (UIsdkGrabbableSubsystem* GrabbableSubsystem = UIsdkGrabbableSubsystem::TryGet(GetWorld()))
+  {
+    GrabbableSubsystem->UpdateGrabCollider(this);
+  }
+}
+
 void UIsdkGrabbableComponent::OnRegister()
 {
   Super::OnRegister();
@@ -182,6 +210,7 @@ void UIsdkGrabbableComponent::SetupCollider()
     GrabCollider->SetupAttachment(this);
     GrabCollider->RegisterComponentWithWorld(GetWorld());
   }
+  NotifyGrabColliderChanged();
 }
 
 void UIsdkGrabbableComponent::TickComponent(
@@ -303,6 +332,40 @@ UPrimitiveComponent* UIsdkGrabbableComponent::GetGrabCollider() const
 void UIsdkGrabbableComponent::SetGrabCollider(UPrimitiveComponent* InGrabCollider)
 {
   GrabCollider = InGrabCollider;
+  NotifyGrabColliderChanged();
+}
+
+bool UIsdkGrabbableComponent::MarkHoveredInGeneration(
+    const UIsdkGrabberComponent* Grabber,
+    uint32 Generation)
+{
+  const TObjectKey<UIsdkGrabberComponent> GrabberKey(Grabber);
+  for (FHoverGeneration& HoverGeneration : HoverGenerations)
+  {
+    if (HoverGeneration.Grabber == GrabberKey)
+    {
+      const bool bFirstMark = HoverGeneration.Generation != Generation;
+      HoverGeneration.Generation = Generation;
+      return bFirstMark;
+    }
+  }
+  HoverGenerations.Add({GrabberKey, Generation});
+  return true;
+}
+
+bool UIsdkGrabbableComponent::WasHoveredInGeneration(
+    const UIsdkGrabberComponent* Grabber,
+    uint32 Generation) const
+{
+  const TObjectKey<UIsdkGrabberComponent> GrabberKey(Grabber);
+  for (const FHoverGeneration& HoverGeneration : HoverGenerations)
+  {
+    if (HoverGeneration.Grabber == GrabberKey)
+    {
+      return HoverGeneration.Generation == Generation;
+    }
+  }
+  return false;
 }
 
 bool UIsdkGrabbableComponent::IsHoveredBy(UIsdkGrabberComponent* Grabber) const
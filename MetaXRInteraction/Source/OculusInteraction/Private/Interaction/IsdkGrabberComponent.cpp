@@ -215,54 +215,81 @@ void UIsdkGrabberComponent::TickInteractors(float DeltaTime)
 
 void UIsdkGrabberComponent::UpdateHoveredGrabbables()
 {
-  TSet<TObjectPtr<UIsdkGrabbableComponent>> CurrentHoveredGrabbables;
+  // Zero is never a valid generation, so fresh grabbables never look hovered
+  HoverGeneration = HoverGeneration == MAX_uint32 ? 1 : HoverGeneration + 1;
+  NewlyHoveredScratch.Reset();
+  NewlyUnhoveredScratch.Reset();
+
+  // Stamp everything the detectors hover. A grabbable found by several detectors is only
+  // considered once, and new hovers are the ones we weren't tracking yet.
   if (IsGrabDetectionTypeAllowed(EIsdkGrabDetectorType::HandGrab))
   {
-    CurrentHoveredGrabbables.Append(HandGrabDetector->GetHoveredGrabbables());
+    for (UIsdkGrabbableComponent* Grabbable : HandGrabDetector->GetHoveredGrabbables())
+    {
+      MarkHovered(Grabbable);
+    }
   }
   if (IsGrabDetectionTypeAllowed(EIsdkGrabDetectorType::DistanceGrab))
   {
-    CurrentHoveredGrabbables.Append(DistanceGrabDetector->GetHoveredGrabbables());
+    for (UIsdkGrabbableComponent* Grabbable : DistanceGrabDetector->GetHoveredGrabbables())
+    {
+      MarkHovered(Grabbable);
+    }
   }
-  if (IsGrabDetectionTypeAllowed(EIsdkGrabDetectorType::RayGrab) &&
-      IsValid(RayGrabDetector->GetHoveredGrabbable()))
+  if (IsGrabDetectionTypeAllowed(EIsdkGrabDetectorType::RayGrab))
   {
-    CurrentHoveredGrabbables.Add(RayGrabDetector->GetHoveredGrabbable());
+    MarkHovered(RayGrabDetector->GetHoveredGrabbable());
   }
 
-  // Hovered Grabbables from last tick may have become null - clear these out
-  HoveredGrabbables.Remove(nullptr);
-
-  // New hovers are in Current and not in Previous
-  const auto& NewHoveredGrabbables = CurrentHoveredGrabbables.Difference(HoveredGrabbables);
-
-  // Unhovers are in Previous and not in Current
-  const auto UnHoveredGrabbables = HoveredGrabbables.Difference(CurrentHoveredGrabbables);
-
-  // Update
-  HoveredGrabbables = CurrentHoveredGrabbables;
-
-  // Post hovered events
-  for (const auto& HoveredGrabbable : NewHoveredGrabbables)
+  // Unhovers are tracked but weren't stamped this pass. Hovered Grabbables from last tick may have
+  // become null - clear these out too
+  for (auto It = HoveredGrabbables.CreateIterator(); It; ++It)
   {
-    if (IsValid(HoveredGrabbable))
+    UIsdkGrabbableComponent* Grabbable = *It;
+    if (!IsValid(Grabbable) || !Grabbable->WasHoveredInGeneration(this, HoverGeneration))
     {
-      PostEvent(EIsdkPointerEventType::Hover, HoveredGrabbable);
-      HoveredGrabbable->AddInteractor(this);
+      if (IsValid(Grabbable))
+      {
+        NewlyUnhoveredScratch.Add(Grabbable);
+      }
+      It.RemoveCurrent();
     }
   }
+  for (UIsdkGrabbableComponent* Grabbable : NewlyHoveredScratch)
+  {
+    HoveredGrabbables.Add(Grabbable);
+  }
+
+  // Post hovered events
+  PostEvents(EIsdkPointerEventType::Hover, NewlyHoveredScratch);
+  for (UIsdkGrabbableComponent* HoveredGrabbable : NewlyHoveredScratch)
+  {
+    HoveredGrabbable->AddInteractor(this);
+  }
 
   // Post unhovered events
-  for (const auto& UnhoveredGrabbable : UnHoveredGrabbables)
+  PostEvents(EIsdkPointerEventType::Unhover, NewlyUnhoveredScratch);
+  for (UIsdkGrabbableComponent* UnhoveredGrabbable : NewlyUnhoveredScratch)
   {
     if (IsValid(UnhoveredGrabbable))
     {
-      PostEvent(EIsdkPointerEventType::Unhover, UnhoveredGrabbable);
       UnhoveredGrabbable->RemoveInteractor(this);
     }
   }
 }
 
+void UIsdkGrabberComponent::MarkHovered(UIsdkGrabbableComponent* Grabbable)
+{
+  if (!IsValid(Grabbable) || !Grabbable->MarkHoveredInGeneration(this, HoverGeneration))
+  {
+    return;
+  }
+  if (!HoveredGrabbables.Contains(Grabbable))
+  {
+    NewlyHoveredScratch.Add(Grabbable);
+  }
+}
+
 void UIsdkGrabberComponent::UpdateInteractorState()
 {
   EIsdkInteractorState NewState = EIsdkInteractorState::Normal;
@@ -736,12 +763,21 @@ void UIsdkGrabberComponent::ReleaseByInputMethod(EIsdkGrabInputMethod InputMetho
 
 void UIsdkGrabberComponent::PostEvent(EIsdkPointerEventType Type, UIsdkGrabbableComponent* Dest)
 {
-  if (!IsValid(Dest))
+  PostEvents(Type, MakeArrayView(&Dest, 1));
+}
+
+void UIsdkGrabberComponent::PostEvents(
+    EIsdkPointerEventType Type,
+    TConstArrayView<UIsdkGrabbableComponent*> Dests)
+{
+  if (Dests.IsEmpty())
   {
     return;
   }
 
+  // Everything but the pose of hover events is shared by the whole batch
   FTransform GrabTransform;
+  bool bPerDestinationTransform = false;
   if (IsValid(CurrentGrabMotion) && CurrentGrabMotion->IsActive())
   {
     // If we're distance/ray grabbing, use motion object to drive the grab transform
@@ -749,8 +785,8 @@ void UIsdkGrabberComponent::PostEvent(EIsdkPointerEventType Type, UIsdkGrabbable
   }
   else if (Type == EIsdkPointerEventType::Hover || Type == EIsdkPointerEventType::Unhover)
   {
-    // If we're hovering or unhovering,
-    GrabTransform = Dest->GetComponentTransform();
+    // If we're hovering or unhovering, use the transform of each grabbable
+    bPerDestinationTransform = true;
   }
   else
   {
@@ -763,9 +799,24 @@ void UIsdkGrabberComponent::PostEvent(EIsdkPointerEventType Type, UIsdkGrabbable
   Evt.Pose.Orientation = GrabTransform.GetRotation();
   Evt.Pose.Position = static_cast<FVector3f>(GrabTransform.GetLocation());
   Evt.Interactor = this;
-  Evt.Interactable = Dest;
   Evt.Identifier = GetID();
-  Dest->PostEvent(Evt);
+
+  for (UIsdkGrabbableComponent* Dest : Dests)
+  {
+    if (!IsValid(Dest))
+    {
+      continue;
+    }
+
+    if (bPerDestinationTransform)
+    {
+      const FTransform& DestTransform = Dest->GetComponentTransform();
+      Evt.Pose.Orientation = DestTransform.GetRotation();
+      Evt.Pose.Position = static_cast<FVector3f>(DestTransform.GetLocation());
+    }
+    Evt.Interactable = Dest;
+    Dest->PostEvent(Evt);
+  }
 }
 
 UIsdkGrabbableComponent* UIsdkGrabberComponent::GetGrabbedComponent() const
@@ -196,9 +196,19 @@ void UIsdkInteractableComponent::TickComponent(
   UpdateInteractableEnabled();
 }
 
+void UIsdkInteractableComponent::SetBroadPhaseCulled(bool bInBroadPhaseCulled)
+{
+  if (bBroadPhaseCulled == bInBroadPhaseCulled)
+  {
+    return;
+  }
+  bBroadPhaseCulled = bInBroadPhaseCulled;
+  UpdateInteractableEnabled();
+}
+
 bool UIsdkInteractableComponent::ShouldApiInstanceBeEnabled() const
 {
-  return IsActive() && IsVisible();
+  return IsActive() && IsVisible() && !bBroadPhaseCulled;
 }
 
 void UIsdkInteractableComponent::HandleApiInstanceCreated(isdk::api::IInteractable* ApiInstance)
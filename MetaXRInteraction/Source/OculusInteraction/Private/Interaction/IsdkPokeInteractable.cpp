@@ -19,6 +19,7 @@
  */
 
 #include "Interaction/IsdkPokeInteractable.h"
+#include "Interaction/IsdkPokeInteractor.h"
 
 #include "StructTypesPrivate.h"
 #include "isdk_api/isdk_api.hpp"
@@ -140,14 +141,6 @@ void UIsdkPokeInteractable::BeginPlay()
       [this]() -> isdk::api::IPointable* { return GetApiPokeInteractable(); },
       InteractorPointerEvent,
       this);
-
-  // This is just for debugging, so let's turn it off in non-editor builds
-#if WITH_EDITOR
-  if (!GIsAutomationTesting)
-  {
-    InteractorPointerEvent.AddDynamic(this, &UIsdkPokeInteractable::HandlePointerEvent);
-  }
-#endif
 }
 
 void UIsdkPokeInteractable::TickComponent(
@@ -216,6 +209,24 @@ PokeInteractable* UIsdkPokeInteractable::GetApiPokeInteractable() const
   return PokeInteractableImpl->GetOrCreateInstance();
 }
 
+bool UIsdkPokeInteractable::GetBroadPhaseBoundingSphere(FSphere& OutSphere) const
+{
+  if (!SurfacePatch.GetInterface() || !SurfacePatch->GetWorldBoundingSphere(OutSphere))
+  {
+    return false;
+  }
+
+  // Interactors start hovering within the enter hover distances of the surface patch
+  const FIsdkPokeInteractable_Config Config = GetCurrentConfig();
+  OutSphere.W += FMath::Max(Config.EnterHoverNormal, Config.EnterHoverTangent);
+  return true;
+}
+
+UClass* UIsdkPokeInteractable::GetBroadPhaseInteractorClass() const
+{
+  return UIsdkPokeInteractor::StaticClass();
+}
+
 const FIsdkPokeInteractableConfigOffsets& UIsdkPokeInteractable::GetConfigOffsets() const
 {
   return ConfigOffsets;
@@ -284,20 +295,8 @@ void UIsdkPokeInteractable::ApplyConfigToInstance() const
   }
 }
 
-void UIsdkPokeInteractable::HandlePointerEvent(const FIsdkInteractionPointerEvent& PointerEvent)
+void UIsdkPokeInteractable::DrawPointerEventDebug(const FIsdkInteractionPointerEvent& PointerEvent)
 {
-  // Only debug draw if the appropriate cvar is on
-  if (!isdk::CVar_Meta_InteractionSDK_DebugInteractionVisuals.GetValueOnAnyThread())
-  {
-    return;
-  }
-
-  // Don't draw move pointer events, they're too noisy
-  if (PointerEvent.Type == EIsdkPointerEventType::Move)
-  {
-    return;
-  }
-
   const FColor DebugColor = UIsdkDebugUtils::GetPointerEventDebugColor(PointerEvent.Type);
   const auto DebugLocation = FVector(PointerEvent.Pose.Position);
 
@@ -181,6 +181,14 @@ void UIsdkPokeInteractor::SetConfig(const FIsdkPokeInteractor_Config& InConfig)
   }
 }
 
+bool UIsdkPokeInteractor::GetBroadPhaseProbe(FIsdkInteractorBroadPhaseProbe& OutProbe) const
+{
+  // The point transform is pushed from the component transform during tick.
+  OutProbe.Start = OutProbe.End = GetComponentLocation();
+  OutProbe.Radius = Config.Radius;
+  return true;
+}
+
 bool UIsdkPokeInteractor::IsRootPoseValid() const
 {
   // If no root pose interface was provided, fall back to just using the transform of the component.
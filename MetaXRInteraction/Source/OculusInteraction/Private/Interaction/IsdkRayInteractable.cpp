@@ -19,6 +19,7 @@
  */
 
 #include "Interaction/IsdkRayInteractable.h"
+#include "Interaction/IsdkRayInteractor.h"
 
 #include "isdk_api/isdk_api.hpp"
 #include "ApiImpl.h"
@@ -116,14 +117,6 @@ void UIsdkRayInteractable::BeginPlay()
       [this]() -> isdk::api::IPointable* { return GetApiRayInteractable(); },
       InteractorPointerEvent,
       this);
-
-  // This is just for debugging, so let's turn it off in non-editor builds
-#if WITH_EDITOR
-  if (!GIsAutomationTesting)
-  {
-    InteractorPointerEvent.AddDynamic(this, &UIsdkRayInteractable::HandlePointerEvent);
-  }
-#endif
 }
 
 void UIsdkRayInteractable::TickComponent(
@@ -176,6 +169,16 @@ void UIsdkRayInteractable::BeginDestroy()
   RayInteractableImpl.Reset();
 }
 
+bool UIsdkRayInteractable::GetBroadPhaseBoundingSphere(FSphere& OutSphere) const
+{
+  return Surface.GetInterface() && Surface->GetWorldBoundingSphere(OutSphere);
+}
+
+UClass* UIsdkRayInteractable::GetBroadPhaseInteractorClass() const
+{
+  return UIsdkRayInteractor::StaticClass();
+}
+
 bool UIsdkRayInteractable::IsApiInstanceValid() const
 {
   return RayInteractableImpl->IsInstanceValid();
@@ -217,20 +220,8 @@ void UIsdkRayInteractable::SetSelectSurface(const TScriptInterface<IIsdkISurface
   }
 }
 
-void UIsdkRayInteractable::HandlePointerEvent(const FIsdkInteractionPointerEvent& PointerEvent)
+void UIsdkRayInteractable::DrawPointerEventDebug(const FIsdkInteractionPointerEvent& PointerEvent)
 {
-  // Only debug draw if the appropriate cvar is on
-  if (!isdk::CVar_Meta_InteractionSDK_DebugInteractionVisuals.GetValueOnAnyThread())
-  {
-    return;
-  }
-
-  // Don't draw move pointer events, they're too noisy
-  if (PointerEvent.Type == EIsdkPointerEventType::Move)
-  {
-    return;
-  }
-
   const auto HasDebugSegments = Cast<IIsdkHasDebugSegments>(Surface.GetObject());
   if (!HasDebugSegments)
   {
@@ -255,6 +255,28 @@ void UIsdkRayInteractor::SetSelectStrength(float InSelectStrength)
   SelectStrength = InSelectStrength;
 }
 
+bool UIsdkRayInteractor::GetBroadPhaseProbe(FIsdkInteractorBroadPhaseProbe& OutProbe) const
+{
+  if (!RayInteractorImpl->IsInstanceValid())
+  {
+    return false;
+  }
+
+  // The ray origin is pushed during tick, so the instance already holds this frame's ray.
+  const auto Instance = RayInteractorImpl->GetOrCreateInstance();
+  const float MaxRayLength = Instance->getMaxRayLength();
+  if (MaxRayLength <= 0.f)
+  {
+    // A ray length of 0 is infinite
+    return false;
+  }
+  const FVector Forward = StructTypesUtils::ConvertDouble(Instance->getForward());
+  OutProbe.Start = StructTypesUtils::ConvertDouble(Instance->getOrigin());
+  OutProbe.End = OutProbe.Start + Forward * MaxRayLength;
+  OutProbe.Radius = 0.0;
+  return true;
+}
+
 void UIsdkRayInteractor::DrawDebugVisuals(const FTransform& PointerPose) const
 {
   if (isdk::CVar_Meta_InteractionSDK_DisableDistanceDebugging.GetValueOnAnyThread())
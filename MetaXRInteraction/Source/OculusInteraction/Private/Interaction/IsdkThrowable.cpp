@@ -35,8 +35,7 @@ UIsdkThrowable::UIsdkThrowable()
 void UIsdkThrowable::StartTracking(USceneComponent* InTrackedComponent)
 {
   TrackedComponent = InTrackedComponent;
-  LastNPositions.Init(TPair<FVector, float>(FVector::ZeroVector, 0.0f), Settings.SampleSize);
-  LastNRotations.Init(TPair<FQuat, float>(FQuat::Identity, 0.0f), Settings.SampleSize);
+  ResetSamples(Settings.SampleSize);
   SetComponentTickEnabled(true);
 }
 
@@ -48,23 +47,148 @@ void UIsdkThrowable::StopTracking()
 
 void UIsdkThrowable::SetSamplePositions(const TArray<TPair<FVector, float>>& Positions)
 {
-  LastNPositions = Positions;
+  // The ring buffer always keeps at least one slot, so that later samples have somewhere to wrap
+  if (Positions.Num() == 0)
+  {
+    LastNPositions.Init(
+        TPair<FVector, float>(FVector::ZeroVector, 0.0f), FMath::Max(1, Settings.SampleSize));
+  }
+  else
+  {
+    LastNPositions = Positions;
+  }
+  NumPositionSamples = Positions.Num();
+  CurrentPositionIndex = 0;
+  PreviousPositionIndex = FMath::Max(0, NumPositionSamples - 1);
+  ScratchPositions.Reset();
+  ScratchPositions.Reserve(NumPositionSamples);
+  RebuildRunningSums();
 }
 
 void UIsdkThrowable::SetSampleRotations(const TArray<TPair<FQuat, float>>& Rotations)
 {
-  LastNRotations = Rotations;
+  if (Rotations.Num() == 0)
+  {
+    LastNRotations.Init(
+        TPair<FQuat, float>(FQuat::Identity, 0.0f), FMath::Max(1, Settings.SampleSize));
+  }
+  else
+  {
+    LastNRotations = Rotations;
+  }
+  NumRotationSamples = Rotations.Num();
+  CurrentRotationIndex = 0;
 }
 
-void UIsdkThrowable::BeginPlay()
+void UIsdkThrowable::ResetSamples(int32 Capacity)
 {
-  Super::BeginPlay();
-  IsFirstFrame = true;
-  LastNPositions.Init(TPair<FVector, float>(FVector::ZeroVector, 0.0f), Settings.SampleSize);
-  LastNRotations.Init(TPair<FQuat, float>(FQuat::Identity, 0.0f), Settings.SampleSize);
+  Capacity = FMath::Max(1, Capacity);
+  LastNPositions.Init(TPair<FVector, float>(FVector::ZeroVector, 0.0f), Capacity);
+  LastNRotations.Init(TPair<FQuat, float>(FQuat::Identity, 0.0f), Capacity);
+  NumPositionSamples = 0;
+  NumRotationSamples = 0;
   CurrentPositionIndex = 0;
   CurrentRotationIndex = 0;
   PreviousPositionIndex = 0;
+  RunningSums = FRunningPositionSums();
+
+  ScratchPositions.Reset();
+  ScratchPositions.Reserve(Capacity);
+}
+
+void UIsdkThrowable::AddPositionSample(const FVector& Position, float Time)
+{
+  if (NumPositionSamples == 0)
+  {
+    SampleOriginPosition = Position;
+    SampleOriginTime = Time;
+  }
+
+  // Full buffer: the slot we're about to overwrite holds the oldest sample
+  TPair<FVector, float>& Slot = LastNPositions[CurrentPositionIndex];
+  if (NumPositionSamples == LastNPositions.Num())
+  {
+    RunningSums.Remove(Slot.Key - SampleOriginPosition, Slot.Value - SampleOriginTime);
+  }
+  else
+  {
+    ++NumPositionSamples;
+  }
+
+  Slot = TPair<FVector, float>(Position, Time);
+  RunningSums.Add(Position - SampleOriginPosition, Time - SampleOriginTime);
+
+  PreviousPositionIndex = CurrentPositionIndex;
+  CurrentPositionIndex = (CurrentPositionIndex + 1) % LastNPositions.Num();
+}
+
+void UIsdkThrowable::AddRotationSample(const FQuat& Rotation, float Time)
+{
+  LastNRotations[CurrentRotationIndex] = TPair<FQuat, float>(Rotation, Time);
+  NumRotationSamples = FMath::Min(NumRotationSamples + 1, LastNRotations.Num());
+  CurrentRotationIndex = (CurrentRotationIndex + 1) % LastNRotations.Num();
+}
+
+void UIsdkThrowable::RebuildRunningSums()
+{
+  RunningSums = FRunningPositionSums();
+  if (NumPositionSamples == 0)
+  {
+    return;
+  }
+
+  SampleOriginPosition = GetPositionSample(0).Key;
+  SampleOriginTime = GetPositionSample(0).Value;
+  for (int32 i = 0; i < NumPositionSamples; i++)
+  {
+    const TPair<FVector, float>& Sample = GetPositionSample(i);
+    RunningSums.Add(Sample.Key - SampleOriginPosition, Sample.Value - SampleOriginTime);
+  }
+}
+
+FVector UIsdkThrowable::FRunningPositionSums::GetLeastSquaresVelocity() const
+{
+  // Same closed form as FIsdkMathUtils::LeastSquares, on the running sums
+  if (Num <= 0)
+  {
+    return FVector::ZeroVector;
+  }
+
+  const double Denominator = Num * (SumTimeSquared - (SumTime * SumTime) / Num);
+  if (FMath::IsNearlyZero(Denominator))
+  {
+    return FVector::ZeroVector;
+  }
+
+  return (Num * SumTimePosition - SumTime * SumPosition) / Denominator;
+}
+
+bool UIsdkThrowable::IsPositionOutlier(
+    const FVector& Position,
+    const FVector& Mean,
+    const FVector& StandardDeviation) const
+{
+  for (int32 Axis = 0; Axis < 3; Axis++)
+  {
+    // An axis without any spread can't contain outliers
+    if (FMath::IsNearlyZero(StandardDeviation[Axis]))
+    {
+      continue;
+    }
+    const double ZScore = FMath::Abs(Position[Axis] - Mean[Axis]) / StandardDeviation[Axis];
+    if (ZScore > Settings.Z_Score_Threshold)
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+void UIsdkThrowable::BeginPlay()
+{
+  Super::BeginPlay();
+  IsFirstFrame = true;
+  ResetSamples(Settings.SampleSize);
 
   ResetKalmanFilter();
 
@@ -97,19 +221,15 @@ void UIsdkThrowable::TickComponent(
   }
 
   // Store the current position and timestamp
-  LastNPositions[CurrentPositionIndex] =
-      TPair<FVector, float>(TrackedComponent->GetComponentLocation(), GetWorld()->GetTimeSeconds());
-  PreviousPositionIndex = CurrentPositionIndex;
-  CurrentPositionIndex = (CurrentPositionIndex + 1) % Settings.SampleSize;
-  LastNRotations[CurrentRotationIndex] =
-      TPair<FQuat, float>(TrackedComponent->GetComponentQuat(), GetWorld()->GetTimeSeconds());
-  CurrentRotationIndex = (CurrentRotationIndex + 1) % Settings.SampleSize;
+  const float Time = GetWorld()->GetTimeSeconds();
+  AddPositionSample(TrackedComponent->GetComponentLocation(), Time);
+  AddRotationSample(TrackedComponent->GetComponentQuat(), Time);
 
   // Debug visualization for throwable
 #if !UE_BUILD_SHIPPING
-  for (int i = 0; i < LastNPositions.Num(); i++)
+  for (int i = 0; i < NumPositionSamples; i++)
   {
-    const auto Position = LastNPositions[i].Key;
+    const auto Position = GetPositionSample(i).Key;
     const auto Coefficient = (1.f - i) / static_cast<float>(LastNPositions.Num());
     UE_VLOG_SPHERE(
         GetOwner(),
@@ -123,57 +243,43 @@ void UIsdkThrowable::TickComponent(
 #endif
 }
 
-void UIsdkThrowable::GetLastNPositions(int32 N, TArray<TPair<FVector, float>>& OutPositions) const
-{
-  OutPositions.Empty();
-
-  for (int32 i = 0; i < N; i++)
-  {
-    const int32 Index = (CurrentPositionIndex - i - 1 + Settings.SampleSize) % Settings.SampleSize;
-    TPair<FVector, float> PositionTimestampPair = LastNPositions[Index];
-
-    // Add initialized positions only
-    if (PositionTimestampPair.Key != FVector::ZeroVector)
-    {
-      OutPositions.Insert(PositionTimestampPair, 0);
-    }
-  }
-}
-
 FVector UIsdkThrowable::GetVelocity() const
 {
-  TArray<TPair<FVector, float>> Positions;
-  GetLastNPositions(LastNPositions.Num(), Positions);
-
-  int32 numPositions = Positions.Num();
-
   // Check if there are enough tracked positions
-  if (numPositions <= 1)
+  if (NumPositionSamples <= 1)
   {
     return FVector::ZeroVector;
   }
 
-  TArray<FVector> PositionValues;
-  for (const TPair<FVector, float>& PositionTimestampPair : Positions)
+  const int32 NumSamples = RunningSums.Num;
+  const FVector Mean = RunningSums.SumPosition / NumSamples;
+  FVector StandardDeviation;
+  for (int32 Axis = 0; Axis < 3; Axis++)
   {
-    PositionValues.Add(PositionTimestampPair.Key);
+    const double Variance =
+        (RunningSums.SumPositionSquared[Axis] - NumSamples * Mean[Axis] * Mean[Axis]) /
+        (NumSamples - 1);
+    StandardDeviation[Axis] = FMath::Sqrt(FMath::Max(Variance, 0.0));
   }
 
-  const FVector Mean = FIsdkMathUtils::GetMean(PositionValues);
-  const FVector StandardDeviation = FIsdkMathUtils::GetStandardDeviation(PositionValues, Mean);
-
   // Filter out positions that are more than a certain number of standard deviations away from the
-  // mean
-  TArray<TPair<FVector, float>> FilteredPositions;
-  FilteredPositions.Reserve(numPositions);
-
-  for (const TPair<FVector, float>& PositionTimestampPair : Positions)
+  // mean. Least squares takes the outliers out of a copy of the running sums, the other estimators
+  // get the filtered samples in the preallocated scratch array.
+  const bool bNeedsFilteredSamples =
+      Settings.VelocityEstimationMethod == EIsdkVelocityEstimationMethod::VE_RANSAC;
+  FRunningPositionSums FilteredSums = RunningSums;
+  ScratchPositions.Reset();
+  for (int32 i = 0; i < NumPositionSamples; i++)
   {
-    FVector Position = PositionTimestampPair.Key;
-    FVector ZScore = (Position - Mean) / StandardDeviation;
-    if (ZScore.GetMax() <= Settings.Z_Score_Threshold)
+    const TPair<FVector, float>& PositionTimestampPair = GetPositionSample(i);
+    const FVector RelativePosition = PositionTimestampPair.Key - SampleOriginPosition;
+    if (IsPositionOutlier(RelativePosition, Mean, StandardDeviation))
+    {
+      FilteredSums.Remove(RelativePosition, PositionTimestampPair.Value - SampleOriginTime);
+    }
+    else if (bNeedsFilteredSamples)
     {
-      FilteredPositions.Add(PositionTimestampPair);
+      ScratchPositions.Add(PositionTimestampPair);
     }
   }
 
@@ -181,12 +287,12 @@ FVector UIsdkThrowable::GetVelocity() const
   switch (Settings.VelocityEstimationMethod)
   {
     case EIsdkVelocityEstimationMethod::VE_LeastSquares:
-      OutVelocity = FIsdkMathUtils::LeastSquares(FilteredPositions)
-                        .GetClampedToSize(MinVelocity, MaxVelocity);
+      OutVelocity =
+          FilteredSums.GetLeastSquaresVelocity().GetClampedToSize(MinVelocity, MaxVelocity);
       break;
     case EIsdkVelocityEstimationMethod::VE_RANSAC:
       OutVelocity =
-          FIsdkMathUtils::Ransac(FilteredPositions, Ransac_Iterations, Ransac_Score_Threshold);
+          FIsdkMathUtils::Ransac(ScratchPositions, Ransac_Iterations, Ransac_Score_Threshold);
       break;
     case EIsdkVelocityEstimationMethod::VE_KalmanFilter:
       OutVelocity = KalmanParams.V;
@@ -198,9 +304,13 @@ FVector UIsdkThrowable::GetVelocity() const
     // Debug visualization at time of throw
 #if !UE_BUILD_SHIPPING
   {
-    for (int i = 0; i < FilteredPositions.Num(); i++)
+    for (int i = 0; i < NumPositionSamples; i++)
     {
-      const auto Position = FilteredPositions[i].Key;
+      const auto Position = GetPositionSample(i).Key;
+      if (IsPositionOutlier(Position - SampleOriginPosition, Mean, StandardDeviation))
+      {
+        continue;
+      }
       const auto Coefficient = (1.f - i) / static_cast<float>(LastNPositions.Num());
       UE_VLOG_SPHERE(
           GetOwner(),
@@ -212,7 +322,7 @@ FVector UIsdkThrowable::GetVelocity() const
           TEXT_EMPTY);
     }
 
-    const auto TraceStart = LastNPositions[CurrentPositionIndex].Key;
+    const auto TraceStart = GetPositionSample(NumPositionSamples - 1).Key;
     const auto TraceEnd = TraceStart + OutVelocity.GetSafeNormal() * 10.f;
     UE_VLOG_ARROW(
         GetOwner(), LogOculusInteraction, Log, TraceStart, TraceEnd, FColor::Red, TEXT_EMPTY);
@@ -236,20 +346,25 @@ FQuat UIsdkThrowable::GetAngularVelocity() const
     return FQuat::Identity;
   }
 
+  if (NumRotationSamples <= 1)
+  {
+    return FQuat::Identity;
+  }
+
   FVector SumAngularVelocity = FVector::ZeroVector;
-  for (int i = 0; i < LastNRotations.Num() - 1; i++)
+  for (int i = 0; i < NumRotationSamples - 1; i++)
   {
-    const FQuat CurrentRotation = LastNRotations[i].Key;
-    const FQuat NextRotation = LastNRotations[i + 1].Key;
+    const TPair<FQuat, float>& CurrentSample = GetRotationSample(i);
+    const TPair<FQuat, float>& NextSample = GetRotationSample(i + 1);
     const FQuat RotationDifference = FQuat::Slerp(
-        CurrentRotation,
-        NextRotation,
-        (LastNRotations[i + 1].Value - LastNRotations[i].Value) / Settings.SampleSize);
+        CurrentSample.Key,
+        NextSample.Key,
+        (NextSample.Value - CurrentSample.Value) / Settings.SampleSize);
     FVector Axis;
     float Angle;
     RotationDifference.ToAxisAndAngle(Axis, Angle);
     Angle = FMath::Fmod(Angle, 2 * PI);
-    const float RotationDelta = LastNRotations[i + 1].Value - LastNRotations[i].Value;
+    const float RotationDelta = NextSample.Value - CurrentSample.Value;
     // If the current and next rotation are zero, there is no angular velocity delta to add to the
     // running sum, avoid Div0 and move on
     if (RotationDelta == 0.0f)
@@ -260,7 +375,7 @@ FQuat UIsdkThrowable::GetAngularVelocity() const
     SumAngularVelocity += AngularVelocity;
   }
 
-  const FVector AverageAngularVelocity = SumAngularVelocity / (LastNRotations.Num() - 1);
+  const FVector AverageAngularVelocity = SumAngularVelocity / (NumRotationSamples - 1);
   FMath::Clamp(AverageAngularVelocity.X, -MaxAngularSpeed, MaxAngularSpeed);
   FMath::Clamp(AverageAngularVelocity.Y, -MaxAngularSpeed, MaxAngularSpeed);
   FMath::Clamp(AverageAngularVelocity.Z, -MaxAngularSpeed, MaxAngularSpeed);
@@ -320,7 +435,7 @@ bool UIsdkThrowable::CheckPositionConstraints()
 {
   if (!IsFirstFrame)
   {
-    if (LastNPositions[PreviousPositionIndex].Key != FVector::ZeroVector)
+    if (NumPositionSamples > 0)
     {
       // Check for erratic movement and lack of movement
       if (auto Distance = FVector::Dist(
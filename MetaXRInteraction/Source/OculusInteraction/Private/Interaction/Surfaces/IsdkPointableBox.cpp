@@ -82,6 +82,7 @@ void UIsdkPointableBox::OnUpdateTransform(
     ETeleportType Teleport)
 {
   Super::OnUpdateTransform(UpdateTransformFlags, Teleport);
+  bWorldBoundingSphereDirty = true;
 
   auto Instance = GetApiPointableBox();
   if (Instance != nullptr)
@@ -112,9 +113,23 @@ isdk::api::ISurface* UIsdkPointableBox::GetApiISurface()
   return GetApiPointableBox();
 }
 
+bool UIsdkPointableBox::GetWorldBoundingSphere(FSphere& OutSphere) const
+{
+  if (bWorldBoundingSphereDirty)
+  {
+    const FTransform& Transform = GetComponentTransform();
+    const FVector Extent = Size / 2.0 * Transform.GetScale3D().GetAbs();
+    CachedWorldBoundingSphere = FSphere(Transform.GetLocation(), Extent.Size());
+    bWorldBoundingSphereDirty = false;
+  }
+  OutSphere = CachedWorldBoundingSphere;
+  return true;
+}
+
 void UIsdkPointableBox::SetSize(FVector InSize)
 {
   Size = InSize;
+  bWorldBoundingSphereDirty = true;
   if (PointableBoxImpl->IsInstanceValid())
   {
     const ovrpVector3f ApiSize = StructTypesUtils::Convert(Size);
@@ -84,6 +84,7 @@ void UIsdkPointablePlane::OnUpdateTransform(
     ETeleportType Teleport)
 {
   Super::OnUpdateTransform(UpdateTransformFlags, Teleport);
+  bWorldBoundingSphereDirty = true;
 
   auto Instance = GetApiPointablePlane();
   if (Instance != nullptr)
@@ -119,9 +120,24 @@ FVector2D UIsdkPointablePlane::GetSize() const
   return Size;
 }
 
+bool UIsdkPointablePlane::GetWorldBoundingSphere(FSphere& OutSphere) const
+{
+  if (bWorldBoundingSphereDirty)
+  {
+    const FTransform& Transform = GetComponentTransform();
+    // Unlike the box and clipper sizes, the plane size is already a half extent
+    const FVector HalfExtent = FVector(0.0, Size.X, Size.Y) * Transform.GetScale3D().GetAbs();
+    CachedWorldBoundingSphere = FSphere(Transform.GetLocation(), HalfExtent.Size());
+    bWorldBoundingSphereDirty = false;
+  }
+  OutSphere = CachedWorldBoundingSphere;
+  return true;
+}
+
 void UIsdkPointablePlane::SetSize(FVector2D InSize)
 {
   Size = InSize;
+  bWorldBoundingSphereDirty = true;
   if (PointablePlaneImpl->IsInstanceValid())
   {
     const ovrpVector2f ApiSize = StructTypesUtils::Convert(Size);
@@ -25,6 +25,7 @@
 #include "Core/IsdkIGameplayTagContainer.h"
 #include "Input/IsdkIPose.h"
 #include "Interaction/IsdkGrabbableComponent.h"
+#include "Subsystem/IsdkGrabbableSubsystem.h"
 #include "Runtime/Launch/Resources/Version.h"
 
 TArray<FIsdkBoundsClipper> UIsdkFunctionLibrary::MakeBoundsClippersFromPose(
@@ -308,8 +309,19 @@ UIsdkGrabbableComponent* UIsdkFunctionLibrary::FindGrabbableByComponent(USceneCo
     return nullptr;
   }
 
-  // A grabbable's collider is likely owned directly by the grabbable, in which case, the
-  // grabbable will be the collider's outer.  Check this first because it's faster.
+  // Registered grab colliders resolve through the world's grabbable registry
+  const auto Primitive = Cast<UPrimitiveComponent>(Component);
+  if (const auto GrabbableSubsystem = UIsdkGrabbableSubsystem::TryGet(Component->GetWorld());
+      Primitive && GrabbableSubsystem)
+  {
+    if (const auto RegisteredGrabbable = GrabbableSubsystem->FindGrabbableByCollider(Primitive))
+    {
+      return RegisteredGrabbable;
+    }
+  }
+
+  // Otherwise, a grabbable's collider is likely owned directly by the grabbable, in which case,
+  // the grabbable will be the collider's outer.  Check this before scanning the owner.
   auto OutGrabbable = Cast<UIsdkGrabbableComponent>(Component->GetOuter());
   if (IsValid(OutGrabbable))
   {
@@ -217,9 +217,93 @@ void UIsdkHandMeshComponent::InitializeSkeleton()
     }
     MappedBoneIndices[BoneNameIndex] = BoneIndex;
   }
+  if (!CacheSkeletonHierarchy())
+  {
+    SetInvalidMappingState(GetSkeletalMesh());
+    return;
+  }
   SetValidMappingState(GetSkeletalMesh());
 }
 
+bool UIsdkHandMeshComponent::CacheSkeletonHierarchy()
+{
+#if defined(ENGINE_MAJOR_VERSION) && ENGINE_MAJOR_VERSION == 4
+  auto SkinnedMesh = SkeletalMesh;
+#else
+  auto SkinnedMesh = GetSkinnedAsset();
+#endif
+  if (!IsValid(SkinnedMesh))
+  {
+    return false;
+  }
+
+  const FReferenceSkeleton& RefSkeleton = SkinnedMesh->GetRefSkeleton();
+  const int32 NumBones = RefSkeleton.GetNum();
+  BoneParentIndices.SetNumUninitialized(NumBones);
+  for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+  {
+    BoneParentIndices[BoneIndex] = RefSkeleton.GetParentIndex(BoneIndex);
+  }
+
+  MappedBoneMask.Init(false, NumBones);
+  for (int BoneId = 0; BoneId < MappedBoneCount; ++BoneId)
+  {
+    if (MappedBoneMask.IsValidIndex(MappedBoneIndices[BoneId]))
+    {
+      MappedBoneMask[MappedBoneIndices[BoneId]] = true;
+    }
+  }
+
+  bComponentSpaceBoneTransformsValid = false;
+  return true;
+}
+
+const TArray<FTransform>& UIsdkHandMeshComponent::GetComponentSpaceBoneTransforms() const
+{
+  const int32 NumBones = BoneSpaceTransforms.Num();
+  if (bComponentSpaceBoneTransformsValid && ComponentSpaceBoneTransforms.Num() == NumBones)
+  {
+    return ComponentSpaceBoneTransforms;
+  }
+
+  // Parents always precede their children in the reference skeleton, so one pass is enough
+  ComponentSpaceBoneTransforms.SetNumUninitialized(NumBones);
+  for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+  {
+    const int32 ParentIndex =
+        BoneParentIndices.IsValidIndex(BoneIndex) ? BoneParentIndices[BoneIndex] : INDEX_NONE;
+    ComponentSpaceBoneTransforms[BoneIndex] = ParentIndex == INDEX_NONE
+        ? BoneSpaceTransforms[BoneIndex]
+        : BoneSpaceTransforms[BoneIndex] * ComponentSpaceBoneTransforms[ParentIndex];
+  }
+  return ComponentSpaceBoneTransforms;
+}
+
+void UIsdkHandMeshComponent::ApplyComponentSpaceBoneTransforms()
+{
+  const int32 NumBones = FMath::Min(BoneSpaceTransforms.Num(), ComponentSpaceBoneTransforms.Num());
+  for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+  {
+    const int32 ParentIndex =
+        BoneParentIndices.IsValidIndex(BoneIndex) ? BoneParentIndices[BoneIndex] : INDEX_NONE;
+    const bool bIsMappedBone = MappedBoneMask.IsValidIndex(BoneIndex) && MappedBoneMask[BoneIndex];
+    if (bIsMappedBone)
+    {
+      BoneSpaceTransforms[BoneIndex] = ParentIndex == INDEX_NONE
+          ? ComponentSpaceBoneTransforms[BoneIndex]
+          : ComponentSpaceBoneTransforms[BoneIndex].GetRelativeTransform(
+                ComponentSpaceBoneTransforms[ParentIndex]);
+    }
+    else if (ParentIndex != INDEX_NONE)
+    {
+      // Unmapped bones keep their local transform and follow their (possibly moved) parent
+      ComponentSpaceBoneTransforms[BoneIndex] =
+          BoneSpaceTransforms[BoneIndex] * ComponentSpaceBoneTransforms[ParentIndex];
+    }
+  }
+  bComponentSpaceBoneTransformsValid = true;
+}
+
 void UIsdkHandMeshComponent::SetJointsDataSource(
     TScriptInterface<IIsdkIHandJoints> InJointsDataSource)
 {
@@ -297,6 +381,9 @@ void UIsdkHandMeshComponent::TickComponent(
   {
     DrawDebugSkeleton();
   }
+
+  // Bone transforms may be modified from outside of the tick from here on
+  bComponentSpaceBoneTransformsValid = false;
 }
 
 void UIsdkHandMeshComponent::SetMappedBoneNamesAsDefault()
@@ -350,6 +437,7 @@ void UIsdkHandMeshComponent::ResetAllBoneTransforms()
     return;
   }
   BoneSpaceTransforms = SkinnedMesh->GetRefSkeleton().GetRefBonePose();
+  bComponentSpaceBoneTransformsValid = false;
   MarkRefreshTransformDirty();
 }
 
@@ -423,35 +511,42 @@ void UIsdkHandMeshComponent::UpdateSkeleton()
   {
     TArray<FTransform>& SourcePoses = HandDataSource->GetJointPoses();
     const bool bHandPoseOverrideValid = bHandPoseOverridden && IsValid(HandDataOverride);
-    TArray<FTransform> OverridePoses = {};
+    const TArray<FTransform>* OverridePoses = nullptr;
 
     // Check if we're overriding the pose
     if (bHandPoseOverrideValid)
     {
-      OverridePoses = HandDataOverride->GetJointPoses();
+      OverridePoses = &HandDataOverride->GetJointPoses();
       // If we're not lerping, use the override pose array
       if (HandPoseLerpState == EIsdkLerpState::Inactive)
       {
-        SourcePoses = HandDataOverride->GetJointPoses();
+        SourcePoses = *OverridePoses;
       }
     }
+    const bool bLerpToOverride = (uint8)HandPoseLerpState > 0 && OverridePoses != nullptr;
 
-    constexpr auto WristSpace = EBoneSpaces::Type::ComponentSpace;
+    // Build the component space pose once, overwrite the mapped joints and convert back to bone
+    // space in a single pass, instead of resolving the hierarchy for every joint
+    GetComponentSpaceBoneTransforms();
     const int BoneCount = UIsdkHandData::GetNumJoints();
     for (int BoneId = 0; BoneId < BoneCount; BoneId++)
     {
-      const FName BoneName = MappedBoneNames[BoneId];
+      const int BoneIndex = MappedBoneIndices[BoneId];
+      if (!ComponentSpaceBoneTransforms.IsValidIndex(BoneIndex))
+      {
+        continue;
+      }
 
-      FTransform BoneTransform = GetBoneTransformByName(BoneName, WristSpace);
-      if ((uint8)HandPoseLerpState > 0)
+      FTransform& BoneTransform = ComponentSpaceBoneTransforms[BoneIndex];
+      if (bLerpToOverride)
       {
         BoneTransform.SetLocation(FMath::Lerp(
             SourcePoses[BoneId].GetLocation(),
-            OverridePoses[BoneId].GetLocation(),
+            (*OverridePoses)[BoneId].GetLocation(),
             HandPoseLerpAlpha));
         BoneTransform.SetRotation(FMath::Lerp(
             SourcePoses[BoneId].GetRotation(),
-            OverridePoses[BoneId].GetRotation(),
+            (*OverridePoses)[BoneId].GetRotation(),
             HandPoseLerpAlpha));
       }
       else
@@ -459,8 +554,8 @@ void UIsdkHandMeshComponent::UpdateSkeleton()
         BoneTransform.SetLocation(SourcePoses[BoneId].GetLocation());
         BoneTransform.SetRotation(SourcePoses[BoneId].GetRotation());
       }
-      SetBoneTransformByName(BoneName, BoneTransform, WristSpace);
     }
+    ApplyComponentSpaceBoneTransforms();
 
     // Check if we're done lerping in
     if (HandPoseLerpState == EIsdkLerpState::TransitioningTo && HandPoseLerpAlpha >= 1.f)
@@ -490,12 +585,15 @@ void UIsdkHandMeshComponent::UpdateApiHandPositionFrame(
   // Set Joint Positions
   auto& ApiJointLocations = ExternalHandPositionFrameImpl->WristSpaceJointLocations;
 
-  FA2CSPose CSPose;
-  CSPose.AllocateLocalPoses(RequiredBones, GetBoneSpaceTransforms());
+  const TArray<FTransform>& ComponentSpaceTransforms = GetComponentSpaceBoneTransforms();
   for (int BoneId = 0; BoneId < MappedBoneCount; ++BoneId)
   {
     const int BoneIndex = MappedBoneIndices[BoneId];
-    const auto WristSpaceTransform = CSPose.GetComponentSpaceTransform(BoneIndex);
+    if (!ComponentSpaceTransforms.IsValidIndex(BoneIndex))
+    {
+      continue;
+    }
+    const FTransform& WristSpaceTransform = ComponentSpaceTransforms[BoneIndex];
 
     ApiJointLocations[BoneId] = StructTypesUtils::Convert(WristSpaceTransform.GetLocation());
   }
@@ -790,16 +888,32 @@ void UIsdkHandMeshComponent::PushTransformsFromSkeletonToHandData()
   if (IsValid(HandDataSource))
   {
     TArray<FTransform>& SourcePoses = HandDataSource->GetJointPoses();
-
-    constexpr auto WristSpace = EBoneSpaces::Type::ComponentSpace;
     const int BoneCount = UIsdkHandData::GetNumJoints();
-    for (int BoneId = 0; BoneId < BoneCount; BoneId++)
+
+    if (MappingState == EIsdkSkeletonMappingState::Valid)
     {
-      const FName BoneName = MappedBoneNames[BoneId];
+      const TArray<FTransform>& ComponentSpaceTransforms = GetComponentSpaceBoneTransforms();
+      for (int BoneId = 0; BoneId < BoneCount; BoneId++)
+      {
+        const int BoneIndex = MappedBoneIndices[BoneId];
+        if (ComponentSpaceTransforms.IsValidIndex(BoneIndex))
+        {
+          SourcePoses[BoneId].SetLocation(ComponentSpaceTransforms[BoneIndex].GetLocation());
+          SourcePoses[BoneId].SetRotation(ComponentSpaceTransforms[BoneIndex].GetRotation());
+        }
+      }
+    }
+    else
+    {
+      constexpr auto WristSpace = EBoneSpaces::Type::ComponentSpace;
+      for (int BoneId = 0; BoneId < BoneCount; BoneId++)
+      {
+        const FName BoneName = MappedBoneNames[BoneId];
 
-      const FTransform BoneTransform = GetBoneTransformByName(BoneName, WristSpace);
-      SourcePoses[BoneId].SetLocation(BoneTransform.GetLocation());
-      SourcePoses[BoneId].SetRotation(BoneTransform.GetRotation());
+        const FTransform BoneTransform = GetBoneTransformByName(BoneName, WristSpace);
+        SourcePoses[BoneId].SetLocation(BoneTransform.GetLocation());
+        SourcePoses[BoneId].SetRotation(BoneTransform.GetRotation());
+      }
     }
     MarkRefreshTransformDirty();
   }
@@ -109,6 +109,18 @@ class FEventQueueApiImpl : public FApiImpl<TQueueApiType, TQueueApiTypePtr>,
   }
 
   virtual void TryHandleEvents() override
+  {
+    HandleEvents(nullptr);
+  }
+
+  /**
+   * Drains the native queue. Each event is broadcast to the (Blueprint facing) forwarding
+   * delegate and, if OutBatch is given, appended to it so that native listeners can consume all
+   * events of this type in one call. Events of one queue are appended contiguously, so a batch
+   * built from several queues is grouped by target. Targets without per-event listeners skip the
+   * broadcast and only feed the batch.
+   */
+  void HandleEvents(TArray<TForwardingDelegateArg0>* OutBatch)
   {
     const auto EventQueue = static_cast<TBase*>(this)->GetOrCreateInstance();
     if (!EventQueue)
@@ -117,15 +129,23 @@ class FEventQueueApiImpl : public FApiImpl<TQueueApiType, TQueueApiTypePtr>,
     }
 
     // Handle the events
-    if (ForwardingDelegate.IsBound())
+    const bool bForward = ForwardingDelegate.IsBound();
+    if (bForward || OutBatch != nullptr)
     {
       // Process each pointer event
       while (!EventQueue->isEmpty())
       {
         const TQueueApiEventType ApiEvent{EventQueue->pop()};
-        // Let 'em know!
         TForwardingDelegateArg0 Event = CreateEvent(ApiEvent);
-        ForwardingDelegate.Broadcast(Event);
+        if (bForward)
+        {
+          // Let 'em know!
+          ForwardingDelegate.Broadcast(Event);
+        }
+        if (OutBatch != nullptr)
+        {
+          OutBatch->Add(MoveTemp(Event));
+        }
       }
     }
     else
@@ -0,0 +1,414 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * Licensed under the Oculus SDK License Agreement (the "License");
+ * you may not use the Oculus SDK except in compliance with the License,
+ * which is provided at the time of installation or download, or which
+ * otherwise accompanies this software in either electronic or hard copy form.
+ *
+ * You may obtain a copy of the License at
+ *
+ * https://developer.oculus.com/licenses/oculussdk/
+ *
+ * Unless required by applicable law or agreed to in writing, the Oculus SDK
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Subsystem/IsdkGrabbableSubsystem.h"
+#include "Interaction/IsdkGrabbableComponent.h"
+#include "Components/PrimitiveComponent.h"
+#include "Algo/Sort.h"
+#include "Runtime/Launch/Resources/Version.h"
+
+namespace isdk
+{
+namespace GrabbableSubsystem
+{
+constexpr int32 MaxLeafEntries = 4;
+
+int32 PopNode(TArray<int32>& NodeStack)
+{
+#if (ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 5)
+  return NodeStack.Pop(EAllowShrinking::No);
+#else
+  return NodeStack.Pop(false);
+#endif
+}
+
+bool SphereIntersectsCone(
+    const FVector& Center,
+    float Radius,
+    const FVector& Apex,
+    const FVector& Direction,
+    float Length,
+    float HalfAngleRadians)
+{
+  const FVector ToCenter = Center - Apex;
+  const double DistSquared = ToCenter.SizeSquared();
+  if (DistSquared > FMath::Square(Length + Radius))
+  {
+    return false;
+  }
+  if (DistSquared <= FMath::Square(Radius))
+  {
+    return true;
+  }
+
+  // Angle between the cone axis and the sphere center, minus the angle the sphere covers
+  const double Dist = FMath::Sqrt(DistSquared);
+  const double CosAngle = FMath::Clamp(FVector::DotProduct(ToCenter, Direction) / Dist, -1.0, 1.0);
+  const double AngularRadius = FMath::Asin(FMath::Min(Radius / Dist, 1.0));
+  return FMath::Acos(CosAngle) - AngularRadius <= HalfAngleRadians;
+}
+
+bool SegmentIntersectsBox(
+    const FBox& Box,
+    const FVector& Start,
+    const FVector& InvDirection,
+    float Length,
+    float& OutEntryDistance)
+{
+  double Entry = 0.0;
+  double Exit = Length;
+  for (int32 Axis = 0; Axis < 3; Axis++)
+  {
+    if (!FMath::IsFinite(InvDirection[Axis]))
+    {
+      // Parallel to this slab, so the start must be inside of it
+      if (Start[Axis] < Box.Min[Axis] || Start[Axis] > Box.Max[Axis])
+      {
+        return false;
+      }
+      continue;
+    }
+    double T0 = (Box.Min[Axis] - Start[Axis]) * InvDirection[Axis];
+    double T1 = (Box.Max[Axis] - Start[Axis]) * InvDirection[Axis];
+    if (T0 > T1)
+    {
+      Swap(T0, T1);
+    }
+    Entry = FMath::Max(Entry, T0);
+    Exit = FMath::Min(Exit, T1);
+    if (Entry > Exit)
+    {
+      return false;
+    }
+  }
+  OutEntryDistance = Entry;
+  return true;
+}
+} // namespace GrabbableSubsystem
+} // namespace isdk
+
+void UIsdkGrabbableSubsystem::Deinitialize()
+{
+  Entries.Empty();
+  EntryIndexByGrabbable.Empty();
+  GrabbableByCollider.Empty();
+  Nodes.Empty();
+  LeafEntries.Empty();
+  NodeStack.Empty();
+
+  Super::Deinitialize();
+}
+
+void UIsdkGrabbableSubsystem::RegisterGrabbable(UIsdkGrabbableComponent* Grabbable)
+{
+  if (!IsValid(Grabbable))
+  {
+    return;
+  }
+  if (EntryIndexByGrabbable.Contains(Grabbable))
+  {
+    UpdateGrabCollider(Grabbable);
+    return;
+  }
+
+  const int32 EntryIndex = Entries.AddDefaulted();
+  Entries[EntryIndex].Key = Grabbable;
+  Entries[EntryIndex].Grabbable = Grabbable;
+  EntryIndexByGrabbable.Add(Grabbable, EntryIndex);
+  UpdateGrabCollider(Grabbable);
+}
+
+void UIsdkGrabbableSubsystem::UnregisterGrabbable(UIsdkGrabbableComponent* Grabbable)
+{
+  if (const int32* EntryIndex = EntryIndexByGrabbable.Find(Grabbable))
+  {
+    RemoveEntryAt(*EntryIndex);
+  }
+}
+
+void UIsdkGrabbableSubsystem::RemoveEntryAt(int32 EntryIndex)
+{
+  const FEntry& Entry = Entries[EntryIndex];
+  if (const UPrimitiveComponent* Collider = Entry.Collider.Get())
+  {
+    const TWeakObjectPtr<UIsdkGrabbableComponent>* MappedGrabbable =
+        GrabbableByCollider.Find(Collider);
+    if (MappedGrabbable != nullptr && *MappedGrabbable == Entry.Grabbable)
+    {
+      GrabbableByCollider.Remove(Collider);
+    }
+  }
+  EntryIndexByGrabbable.Remove(Entry.Key);
+
+#if (ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 5)
+  Entries.RemoveAtSwap(EntryIndex, 1, EAllowShrinking::No);
+#else
+  Entries.RemoveAtSwap(EntryIndex, 1, false);
+#endif
+  if (Entries.IsValidIndex(EntryIndex))
+  {
+    EntryIndexByGrabbable.Add(Entries[EntryIndex].Key, EntryIndex);
+  }
+  bStructureDirty = true;
+}
+
+void UIsdkGrabbableSubsystem::UpdateGrabCollider(UIsdkGrabbableComponent* Grabbable)
+{
+  const int32* EntryIndex = EntryIndexByGrabbable.Find(Grabbable);
+  if (EntryIndex == nullptr)
+  {
+    return;
+  }
+
+  FEntry& Entry = Entries[*EntryIndex];
+  UPrimitiveComponent* NewCollider = Grabbable->GetGrabCollider();
+  if (Entry.Collider.Get() == NewCollider)
+  {
+    return;
+  }
+
+  if (const UPrimitiveComponent* OldCollider = Entry.Collider.Get())
+  {
+    const TWeakObjectPtr<UIsdkGrabbableComponent>* MappedGrabbable =
+        GrabbableByCollider.Find(OldCollider);
+    if (MappedGrabbable != nullptr && *MappedGrabbable == Entry.Grabbable)
+    {
+      GrabbableByCollider.Remove(OldCollider);
+    }
+  }
+
+  // If multiple grabbables share the same collider, the last one registered wins
+  Entry.Collider = NewCollider;
+  if (IsValid(NewCollider))
+  {
+    GrabbableByCollider.Add(NewCollider, Grabbable);
+  }
+  bStructureDirty = true;
+}
+
+UIsdkGrabbableComponent* UIsdkGrabbableSubsystem::FindGrabbableByCollider(
+    const UPrimitiveComponent* Collider) const
+{
+  const TWeakObjectPtr<UIsdkGrabbableComponent>* Grabbable = GrabbableByCollider.Find(Collider);
+  return Grabbable != nullptr ? Grabbable->Get() : nullptr;
+}
+
+void UIsdkGrabbableSubsystem::RefreshIfNeeded()
+{
+  if (LastRefreshFrame == GFrameCounter && !bStructureDirty)
+  {
+    return;
+  }
+  LastRefreshFrame = GFrameCounter;
+
+  // Drop grabbables that were destroyed without unregistering, and pick up this frame's bounds
+  LeafEntries.Reset();
+  for (int32 EntryIndex = Entries.Num() - 1; EntryIndex >= 0; EntryIndex--)
+  {
+    if (!Entries[EntryIndex].Grabbable.IsValid())
+    {
+      RemoveEntryAt(EntryIndex);
+    }
+  }
+  for (int32 EntryIndex = 0; EntryIndex < Entries.Num(); EntryIndex++)
+  {
+    FEntry& Entry = Entries[EntryIndex];
+    const UPrimitiveComponent* Collider = Entry.Collider.Get();
+    if (IsValid(Collider) && Collider->IsRegistered())
+    {
+      Entry.Bounds = Collider->Bounds;
+      LeafEntries.Add(EntryIndex);
+    }
+  }
+  bStructureDirty = false;
+
+  // The hierarchy is rebuilt rather than refit: grabbables move a lot, and rebuilding a few
+  // hundred entries is cheap compared to keeping a tight tree
+  Nodes.Reset();
+  if (LeafEntries.Num() > 0)
+  {
+    BuildNode(0, LeafEntries.Num());
+  }
+}
+
+int32 UIsdkGrabbableSubsystem::BuildNode(int32 Begin, int32 End)
+{
+  const int32 NodeIndex = Nodes.AddDefaulted();
+
+  FBox Box(ForceInit);
+  FBox CentroidBox(ForceInit);
+  for (int32 i = Begin; i < End; i++)
+  {
+    const FBoxSphereBounds& Bounds = Entries[LeafEntries[i]].Bounds;
+    Box += Bounds.GetBox();
+    CentroidBox += Bounds.Origin;
+  }
+  Nodes[NodeIndex].Box = Box;
+  Nodes[NodeIndex].Sphere = FSphere(Box.GetCenter(), Box.GetExtent().Size());
+
+  if (End - Begin <= isdk::GrabbableSubsystem::MaxLeafEntries)
+  {
+    Nodes[NodeIndex].First = Begin;
+    Nodes[NodeIndex].Count = End - Begin;
+    return NodeIndex;
+  }
+
+  // Median split along the axis with the largest centroid spread
+  const FVector CentroidExtent = CentroidBox.GetExtent();
+  const int32 Axis = CentroidExtent.X >= CentroidExtent.Y
+      ? (CentroidExtent.X >= CentroidExtent.Z ? 0 : 2)
+      : (CentroidExtent.Y >= CentroidExtent.Z ? 1 : 2);
+  Algo::Sort(
+      MakeArrayView(LeafEntries.GetData() + Begin, End - Begin),
+      [this, Axis](int32 A, int32 B)
+      { return Entries[A].Bounds.Origin[Axis] < Entries[B].Bounds.Origin[Axis]; });
+
+  const int32 Mid = Begin + (End - Begin) / 2;
+  BuildNode(Begin, Mid);
+  const int32 RightIndex = BuildNode(Mid, End);
+  Nodes[NodeIndex].First = RightIndex;
+  Nodes[NodeIndex].Count = 0;
+  return NodeIndex;
+}
+
+bool UIsdkGrabbableSubsystem::ResolveHit(
+    int32 EntryIndex,
+    float Distance,
+    FIsdkGrabbableQueryHit& OutHit) const
+{
+  const FEntry& Entry = Entries[EntryIndex];
+  OutHit.Grabbable = Entry.Grabbable.Get();
+  OutHit.Collider = Entry.Collider.Get();
+  OutHit.Bounds = Entry.Bounds;
+  OutHit.Distance = Distance;
+  return OutHit.Grabbable != nullptr && OutHit.Collider != nullptr;
+}
+
+void UIsdkGrabbableSubsystem::QueryCone(
+    const FVector& Apex,
+    const FVector& Direction,
+    float Length,
+    float HalfAngleRadians,
+    TArray<FIsdkGrabbableQueryHit>& OutHits)
+{
+  RefreshIfNeeded();
+  if (Nodes.Num() == 0)
+  {
+    return;
+  }
+
+  using isdk::GrabbableSubsystem::SphereIntersectsCone;
+  NodeStack.Reset();
+  NodeStack.Add(0);
+  while (NodeStack.Num() > 0)
+  {
+    const int32 NodeIndex = isdk::GrabbableSubsystem::PopNode(NodeStack);
+    const FNode& Node = Nodes[NodeIndex];
+    if (!SphereIntersectsCone(
+            Node.Sphere.Center, Node.Sphere.W, Apex, Direction, Length, HalfAngleRadians))
+    {
+      continue;
+    }
+
+    if (Node.Count == 0)
+    {
+      NodeStack.Add(NodeIndex + 1);
+      NodeStack.Add(Node.First);
+      continue;
+    }
+
+    for (int32 i = Node.First; i < Node.First + Node.Count; i++)
+    {
+      const FBoxSphereBounds& Bounds = Entries[LeafEntries[i]].Bounds;
+      if (!SphereIntersectsCone(
+              Bounds.Origin, Bounds.SphereRadius, Apex, Direction, Length, HalfAngleRadians))
+      {
+        continue;
+      }
+
+      FIsdkGrabbableQueryHit Hit;
+      const float Distance =
+          FMath::Max(0.f, FVector::Dist(Apex, Bounds.Origin) - Bounds.SphereRadius);
+      if (ResolveHit(LeafEntries[i], Distance, Hit))
+      {
+        OutHits.Add(Hit);
+      }
+    }
+  }
+}
+
+void UIsdkGrabbableSubsystem::QueryRay(
+    const FVector& Start,
+    const FVector& End,
+    TArray<FIsdkGrabbableQueryHit>& OutHits)
+{
+  RefreshIfNeeded();
+  if (Nodes.Num() == 0)
+  {
+    return;
+  }
+
+  using isdk::GrabbableSubsystem::SegmentIntersectsBox;
+  const FVector Segment = End - Start;
+  const float Length = Segment.Size();
+  if (FMath::IsNearlyZero(Length))
+  {
+    return;
+  }
+  const FVector Direction = Segment / Length;
+  const FVector InvDirection(1.0 / Direction.X, 1.0 / Direction.Y, 1.0 / Direction.Z);
+
+  const int32 FirstHit = OutHits.Num();
+  NodeStack.Reset();
+  NodeStack.Add(0);
+  while (NodeStack.Num() > 0)
+  {
+    const int32 NodeIndex = isdk::GrabbableSubsystem::PopNode(NodeStack);
+    const FNode& Node = Nodes[NodeIndex];
+    float EntryDistance;
+    if (!SegmentIntersectsBox(Node.Box, Start, InvDirection, Length, EntryDistance))
+    {
+      continue;
+    }
+
+    if (Node.Count == 0)
+    {
+      NodeStack.Add(NodeIndex + 1);
+      NodeStack.Add(Node.First);
+      continue;
+    }
+
+    for (int32 i = Node.First; i < Node.First + Node.Count; i++)
+    {
+      const FBox EntryBox = Entries[LeafEntries[i]].Bounds.GetBox();
+      FIsdkGrabbableQueryHit Hit;
+      if (SegmentIntersectsBox(EntryBox, Start, InvDirection, Length, EntryDistance) &&
+          ResolveHit(LeafEntries[i], EntryDistance, Hit))
+      {
+        OutHits.Add(Hit);
+      }
+    }
+  }
+
+  Algo::Sort(
+      MakeArrayView(OutHits.GetData() + FirstHit, OutHits.Num() - FirstHit),
+      [](const FIsdkGrabbableQueryHit& A, const FIsdkGrabbableQueryHit& B)
+      { return A.Distance < B.Distance; });
+}
@@ -33,6 +33,7 @@
 #include "Utilities/IsdkXRUtils.h"
 #include "IsdkChecks.h"
 #include "Runtime/Launch/Resources/Version.h"
+#include "Algo/Sort.h"
 
 namespace isdk
 {
@@ -48,6 +49,132 @@ TAutoConsoleVariable<bool> CVar_Meta_InteractionSDK_HandGrabPoses_DebugPoseVecto
 } // namespace isdk
 // namespace isdk
 
+void FIsdkHandPoseVariationIndex::Build(
+    const TSet<uint32>& Variations,
+    const FIsdkHandPoseDataCache& PoseDataCache)
+{
+  for (TArray<FIsdkHandPoseIndexEntry>& Tree : Trees)
+  {
+    Tree.Reset();
+  }
+
+  for (uint32 VariationIdx : Variations)
+  {
+    if (!PoseDataCache.CachedHandPoseGroups.IsValidIndex(VariationIdx) ||
+        !PoseDataCache.CachedTransforms.IsValidIndex(VariationIdx))
+    {
+      continue;
+    }
+
+    const FTransform& CachedTransform = PoseDataCache.CachedTransforms[VariationIdx];
+    FIsdkHandPoseIndexEntry Entry;
+    Entry.Location = CachedTransform.GetLocation();
+    Entry.Rotation = CachedTransform.GetRotation().GetNormalized();
+    Entry.VariationIdx = VariationIdx;
+
+    // A pose group may hold both handednesses (mirrored without moving the transform)
+    for (const auto& Elem : PoseDataCache.CachedHandPoseGroups[VariationIdx].CachedHandPoses)
+    {
+      const int32 HandednessIdx = static_cast<int32>(Elem.Key);
+      if (HandednessIdx >= 0 && HandednessIdx < NumHandedness)
+      {
+        Trees[HandednessIdx].Add(Entry);
+      }
+    }
+  }
+
+  for (TArray<FIsdkHandPoseIndexEntry>& Tree : Trees)
+  {
+    BuildNode(Tree, 0);
+  }
+  bDirty = false;
+}
+
+void FIsdkHandPoseVariationIndex::BuildNode(TArrayView<FIsdkHandPoseIndexEntry> Entries, int32 Depth)
+{
+  if (Entries.Num() <= 1)
+  {
+    return;
+  }
+
+  const int32 Axis = Depth % 3;
+  Algo::Sort(
+      Entries,
+      [Axis](const FIsdkHandPoseIndexEntry& A, const FIsdkHandPoseIndexEntry& B)
+      { return A.Location[Axis] < B.Location[Axis]; });
+
+  const int32 Mid = Entries.Num() / 2;
+  BuildNode(Entries.Slice(0, Mid), Depth + 1);
+  BuildNode(Entries.RightChop(Mid + 1), Depth + 1);
+}
+
+int32 FIsdkHandPoseVariationIndex::FindBestVariation(
+    EIsdkHandedness Handedness,
+    const FVector& LocalHandLocation,
+    const FQuat& LocalHandRotation) const
+{
+  const int32 HandednessIdx = static_cast<int32>(Handedness);
+  if (HandednessIdx < 0 || HandednessIdx >= NumHandedness)
+  {
+    return INDEX_NONE;
+  }
+
+  float BestDelta = FLT_MAX;
+  int32 BestVariation = INDEX_NONE;
+  FindBestInNode(
+      Trees[HandednessIdx], 0, LocalHandLocation, LocalHandRotation, BestDelta, BestVariation);
+  return BestVariation;
+}
+
+void FIsdkHandPoseVariationIndex::FindBestInNode(
+    TConstArrayView<FIsdkHandPoseIndexEntry> Entries,
+    int32 Depth,
+    const FVector& LocalHandLocation,
+    const FQuat& LocalHandRotation,
+    float& InOutBestDelta,
+    int32& InOutBestVariation)
+{
+  if (Entries.Num() == 0)
+  {
+    return;
+  }
+
+  const int32 Mid = Entries.Num() / 2;
+  const FIsdkHandPoseIndexEntry& Node = Entries[Mid];
+
+  // The rotation delta is never negative, so the location delta alone is a lower bound
+  const float LocationDelta = FVector::DistSquared(LocalHandLocation, Node.Location);
+  if (LocationDelta < InOutBestDelta)
+  {
+    const float RotationDelta =
+        FMath::RadiansToDegrees(LocalHandRotation.AngularDistance(Node.Rotation));
+    const float FinalDelta = LocationDelta + RotationDelta;
+    // Ties go to the variation registered first, independent of the tree layout
+    const int32 VariationIdx = static_cast<int32>(Node.VariationIdx);
+    if (FinalDelta < InOutBestDelta ||
+        (FinalDelta == InOutBestDelta && VariationIdx < InOutBestVariation))
+    {
+      InOutBestDelta = FinalDelta;
+      InOutBestVariation = VariationIdx;
+    }
+  }
+
+  const int32 Axis = Depth % 3;
+  const float PlaneDistance = LocalHandLocation[Axis] - Node.Location[Axis];
+  const TConstArrayView<FIsdkHandPoseIndexEntry> Near =
+      PlaneDistance < 0.f ? Entries.Slice(0, Mid) : Entries.RightChop(Mid + 1);
+  const TConstArrayView<FIsdkHandPoseIndexEntry> Far =
+      PlaneDistance < 0.f ? Entries.RightChop(Mid + 1) : Entries.Slice(0, Mid);
+
+  FindBestInNode(
+      Near, Depth + 1, LocalHandLocation, LocalHandRotation, InOutBestDelta, InOutBestVariation);
+  if (FMath::Square(PlaneDistance) < InOutBestDelta)
+  {
+    FindBestInNode(
+        Far, Depth + 1, LocalHandLocation, LocalHandRotation, InOutBestDelta, InOutBestVariation);
+  }
+}
+
 UIsdkHandPoseSubsystem::UIsdkHandPoseSubsystem()
 {
   static FStaticObjectFinders StaticObjectFinders;
@@ -71,27 +198,7 @@ void UIsdkHandPoseSubsystem::Tick(float InDeltaTime)
   Super::Tick(InDeltaTime);
 
   // Check if we have any hand grab poses to destroy
-  if (HandGrabPoseDestroyQueue.Num() > 0)
-  {
-    for (int i = 0; i < HandGrabPoseDestroyQueue.Num(); i++)
-    {
-      USceneComponent* ComponentToDestroy = HandGrabPoseDestroyQueue[i];
-
-      if (ComponentToDestroy->IsRegistered())
-      {
-        ComponentToDestroy->UnregisterComponent();
-      }
-      ComponentToDestroy->DestroyComponent();
-
-#if (ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 5)
-      HandGrabPoseDestroyQueue.RemoveAt(0, 1, EAllowShrinking::Yes);
-#else
-      HandGrabPoseDestroyQueue.RemoveAt(0, 1, true);
-#endif
-
-      i--;
-    }
-  }
+  FlushHandGrabPoseDestroyQueue();
 
   // Handle Pose Transform Debug Drawing when enabled (this is not currently intended to be
   // performant)
@@ -153,6 +260,32 @@ void UIsdkHandPoseSubsystem::Tick(float InDeltaTime)
   }
 }
 
+void UIsdkHandPoseSubsystem::FlushHandGrabPoseDestroyQueue()
+{
+  // Consume the queue from its head instead of removing the front element, which would shift the
+  // remaining entries once per destroyed component. Destroying a component may queue more.
+  while (HandGrabPoseDestroyQueueHead < HandGrabPoseDestroyQueue.Num())
+  {
+    USceneComponent* ComponentToDestroy = HandGrabPoseDestroyQueue[HandGrabPoseDestroyQueueHead];
+    HandGrabPoseDestroyQueue[HandGrabPoseDestroyQueueHead] = nullptr;
+    ++HandGrabPoseDestroyQueueHead;
+
+    if (!IsValid(ComponentToDestroy))
+    {
+      continue;
+    }
+    if (ComponentToDestroy->IsRegistered())
+    {
+      ComponentToDestroy->UnregisterComponent();
+    }
+    ComponentToDestroy->DestroyComponent();
+  }
+
+  // Rewind, keeping the allocation for the next batch of registrations
+  HandGrabPoseDestroyQueue.Reset();
+  HandGrabPoseDestroyQueueHead = 0;
+}
+
 ETickableTickType UIsdkHandPoseSubsystem::GetTickableTickType() const
 {
   return IsTemplate() ? ETickableTickType::Never : ETickableTickType::Always;
@@ -200,7 +333,27 @@ FName UIsdkHandPoseSubsystem::GetActorClassNameFromComponent(USceneComponent* Co
     return NAME_None;
   }
 
-  return FTopLevelAssetPath(OwningActor->GetClass()).GetPackageName();
+  UClass* OwningActorClass = OwningActor->GetClass();
+  if (const FName* CachedClassName = ActorClassNameCache.Find(OwningActorClass))
+  {
+    return *CachedClassName;
+  }
+  return ActorClassNameCache.Add(
+      OwningActorClass, FTopLevelAssetPath(OwningActorClass).GetPackageName());
+}
+
+void UIsdkHandPoseSubsystem::MarkVariationsDirty(FName OuterActorName, AActor* ActorIn)
+{
+  FIsdkHandPoseDataActorCache* ActorPoseDataCache = ActorPoseCacheMap.Find(OuterActorName);
+  if (ActorPoseDataCache == nullptr)
+  {
+    return;
+  }
+  if (FIsdkHandPoseDataActorVariations* ActorVariations =
+          ActorPoseDataCache->InstanceVariations.Find(ActorIn))
+  {
+    ActorVariations->Index.bDirty = true;
+  }
 }
 
 void UIsdkHandPoseSubsystem::RegisterHandPoseData(
@@ -433,106 +586,69 @@ bool UIsdkHandPoseSubsystem::CheckForHandPose(
   const FName OuterActorName = GetActorClassNameFromComponent(InteractableIn);
 
   // Find the PoseDataCache for this base blueprint class
-  if (ActorPoseCacheMap.Contains(OuterActorName))
+  FIsdkHandPoseDataActorCache* ActorPoseDataCache = ActorPoseCacheMap.Find(OuterActorName);
+  if (ActorPoseDataCache == nullptr)
   {
-    const FIsdkHandPoseDataActorCache ActorPoseDataCache = *ActorPoseCacheMap.Find(OuterActorName);
+    return false;
+  }
 
-    // Find the specific variations for this AActor
-    if (ActorPoseDataCache.InstanceVariations.Contains(OuterActor))
-    {
-      const FIsdkHandPoseDataActorVariations ActorVariations =
-          ActorPoseDataCache.InstanceVariations[OuterActor];
-      if (ActorVariations.Variations.Num() > 0)
-      {
-        int32 CurrentWinningIdx = -1;
-        float LastWinningLocationRotationDelta = FLT_MAX;
-        const FTransform ActorTransform =
-            InteractableIn->GetAttachParentActor()->GetActorTransform();
-        const FTransform HandTransform = InteractingHandIn->GetComponentTransform();
-        const FTransform HandWorldTransform = InteractingHandIn->GetComponentToWorld();
-        const FIsdkHandPoseDataCache PoseDataCache = ActorPoseDataCache.PoseDataCache;
-
-        if (isdk::CVar_Meta_InteractionSDK_HandGrabPoses_DebugPoseVectors.GetValueOnAnyThread())
-        {
-          FVector HandForwardZ = HandTransform.GetUnitAxis(EAxis::Z);
-          HandForwardZ.Normalize(1.f);
-          DrawDebugDirectionalArrow(
-              GetWorld(),
-              HandWorldTransform.GetLocation(),
-              HandWorldTransform.GetLocation() + (HandForwardZ * 15.f),
-              5.f,
-              FColor::Green,
-              false,
-              5.f,
-              0,
-              0.5f);
-        }
+  // Find the specific variations for this AActor
+  FIsdkHandPoseDataActorVariations* ActorVariations =
+      ActorPoseDataCache->InstanceVariations.Find(OuterActor);
+  if (ActorVariations == nullptr || ActorVariations->Variations.Num() == 0)
+  {
+    return false;
+  }
 
-        // The handpose with the smallest location delta + the smallest rotation delta will win
-        FTransform ThisGrabTransform;
+  const FIsdkHandPoseDataCache& PoseDataCache = ActorPoseDataCache->PoseDataCache;
+  if (ActorVariations->Index.bDirty)
+  {
+    ActorVariations->Index.Build(ActorVariations->Variations, PoseDataCache);
+  }
 
-        // Iterate through all variations that have been registered for this specific actor
-        for (uint32 VariationIdx : ActorVariations.Variations)
-        {
-          if (!PoseDataCache.CachedHandPoseGroups.IsValidIndex(VariationIdx))
-          {
-            continue;
-          }
+  const FTransform& ActorTransform = OuterActor->GetActorTransform();
+  const FTransform& HandWorldTransform = InteractingHandIn->GetComponentTransform();
 
-          // If the pose group doesn't have our handedness, move on
-          if (!PoseDataCache.CachedHandPoseGroups[VariationIdx].CachedHandPoses.Contains(
-                  IncomingHandedness))
-          {
-            continue;
-          }
-          // Properly position the grab's transform in world space
-          ThisGrabTransform.SetRotation(
-              ActorTransform.GetRotation() *
-              PoseDataCache.CachedTransforms[VariationIdx].GetRotation());
-          ThisGrabTransform.SetScale3D(PoseDataCache.CachedTransforms[VariationIdx].GetScale3D());
-          FVector UpdatedGrabLoc = ActorTransform.GetRotation().RotateVector(
-              PoseDataCache.CachedTransforms[VariationIdx].GetLocation());
-          ThisGrabTransform.SetLocation(ActorTransform.GetLocation() + UpdatedGrabLoc);
-
-          const FVector LocationDeltaVector =
-              (HandTransform.GetLocation() - ThisGrabTransform.GetLocation());
-          const FRotator RotationDeltaRotator = HandWorldTransform.GetRotation().Rotator() -
-              ThisGrabTransform.GetRotation().Rotator();
-          const float RotationDelta = FMath::Abs(RotationDeltaRotator.Yaw) +
-              FMath::Abs(RotationDeltaRotator.Pitch) + FMath::Abs(RotationDeltaRotator.Roll);
-
-          const float FinalDelta = LocationDeltaVector.SquaredLength() + RotationDelta;
-
-          if (FinalDelta < LastWinningLocationRotationDelta)
-          {
-            LastWinningLocationRotationDelta = FinalDelta;
-            CurrentWinningIdx = VariationIdx;
-            RootOffsetOut = PoseDataCache.CachedTransforms[VariationIdx];
-            GrabPosePropertiesOut = PoseDataCache.CachedProperties[VariationIdx];
-          }
-        }
+  if (isdk::CVar_Meta_InteractionSDK_HandGrabPoses_DebugPoseVectors.GetValueOnAnyThread())
+  {
+    FVector HandForwardZ = HandWorldTransform.GetUnitAxis(EAxis::Z);
+    HandForwardZ.Normalize(1.f);
+    DrawDebugDirectionalArrow(
+        GetWorld(),
+        HandWorldTransform.GetLocation(),
+        HandWorldTransform.GetLocation() + (HandForwardZ * 15.f),
+        5.f,
+        FColor::Green,
+        false,
+        5.f,
+        0,
+        0.5f);
+  }
 
-        if (CurrentWinningIdx >= 0 &&
-            PoseDataCache.CachedHandPoseGroups.IsValidIndex(CurrentWinningIdx))
-        {
-          HandPoseOut = PoseDataCache.CachedHandPoseGroups[CurrentWinningIdx]
-                            .CachedHandPoses[IncomingHandedness];
-
-          if (!UIsdkChecks::ValidateDependency(
-                  HandPoseOut,
-                  this,
-                  TEXT("Selected Hand Pose"),
-                  ANSI_TO_TCHAR(__FUNCTION__),
-                  nullptr))
-          {
-            return false;
-          }
-          return true;
-        }
-      }
-    }
+  // Grab transforms are placed with the actor's location and rotation only, so bring the hand into
+  // that frame once instead of moving every variation into world space. Both deltas are invariant
+  // under this change of frame.
+  const FQuat ActorRotationInverse = ActorTransform.GetRotation().Inverse();
+  const FVector LocalHandLocation = ActorRotationInverse.RotateVector(
+      HandWorldTransform.GetLocation() - ActorTransform.GetLocation());
+  const FQuat LocalHandRotation =
+      (ActorRotationInverse * HandWorldTransform.GetRotation()).GetNormalized();
+
+  // The handpose with the smallest location delta + the smallest rotation delta will win
+  const int32 WinningIdx = ActorVariations->Index.FindBestVariation(
+      IncomingHandedness, LocalHandLocation, LocalHandRotation);
+  if (!PoseDataCache.CachedHandPoseGroups.IsValidIndex(WinningIdx))
+  {
+    return false;
   }
-  return false;
+
+  RootOffsetOut = PoseDataCache.CachedTransforms[WinningIdx];
+  GrabPosePropertiesOut = PoseDataCache.CachedProperties[WinningIdx];
+  HandPoseOut =
+      PoseDataCache.CachedHandPoseGroups[WinningIdx].CachedHandPoses.FindRef(IncomingHandedness);
+
+  return UIsdkChecks::ValidateDependency(
+      HandPoseOut, this, TEXT("Selected Hand Pose"), ANSI_TO_TCHAR(__FUNCTION__), nullptr);
 }
 
 bool UIsdkHandPoseSubsystem::GenerateMirroredHandPoseData(
@@ -616,6 +732,7 @@ uint32 UIsdkHandPoseSubsystem::AddNewVariationToActorCacheMap(
 
   // And record a new variation
   ActorPoseCacheMap[OuterActorName].InstanceVariations[ActorIn].Variations.Add(NewVariationIdx);
+  MarkVariationsDirty(OuterActorName, ActorIn);
 
   return NewVariationIdx;
 }
@@ -654,6 +771,7 @@ bool UIsdkHandPoseSubsystem::AddExistingVariationToActorCacheMap(
     ActorPoseCacheMap[OuterActorName].InstanceVariations[ActorIn].Variations.Add(
         ActorPoseCacheMap[OuterActorName].OriginalMirrorVariationMap[VariationIndexIn]);
   }
+  MarkVariationsDirty(OuterActorName, ActorIn);
   return true;
 }
 
@@ -28,7 +28,7 @@ void UIsdkWidgetSubsystem::BeginDestroy()
 {
   Super::BeginDestroy();
 
-  VirtualUserIndexInteractors.SetNum(0);
+  VirtualUserIndexInteractors.Empty();
 }
 
 void UIsdkWidgetSubsystem::Initialize(FSubsystemCollectionBase& Collection)
@@ -68,13 +68,11 @@ FIsdkWidgetVirtualUserState* UIsdkWidgetSubsystem::FindOrCreateInteractorVirtual
     return nullptr;
   }
 
-  for (int32 Index = 0; Index < VirtualUserIndexInteractors.Num(); ++Index)
+  const TObjectKey<UObject> InteractorKey(PointerEvent.Interactor);
+  if (FIsdkWidgetVirtualUserState* VirtualUserIndexInteractor =
+          VirtualUserIndexInteractors.Find(InteractorKey))
   {
-    auto& VirtualUserIndexInteractor = VirtualUserIndexInteractors[Index];
-    if (PointerEvent.Interactor == VirtualUserIndexInteractor.Interactor)
-    {
-      return &VirtualUserIndexInteractor;
-    }
+    return VirtualUserIndexInteractor;
   }
 
   // No valid entry was found. Inspect the interactor to get the virtual user index then bind
@@ -105,7 +103,7 @@ FIsdkWidgetVirtualUserState* UIsdkWidgetSubsystem::FindOrCreateInteractorVirtual
         *PointerEvent.Interactor->GetName(),
         State.VirtualUser->GetVirtualUserIndex());
 
-    return &VirtualUserIndexInteractors.Add_GetRef(State);
+    return &VirtualUserIndexInteractors.Add(InteractorKey, State);
   }
 
   checkf(
@@ -122,19 +120,16 @@ void UIsdkWidgetSubsystem::DestroyInteractorVirtualUserState(UObject* Interactor
     return;
   }
 
-  for (int32 Index = 0; Index < VirtualUserIndexInteractors.Num(); ++Index)
+  const TObjectKey<UObject> InteractorKey(Interactor);
+  if (const FIsdkWidgetVirtualUserState* State = VirtualUserIndexInteractors.Find(InteractorKey))
   {
-    if (Interactor == VirtualUserIndexInteractors[Index].Interactor)
-    {
-      UE_LOG(
-          LogOculusInteraction,
-          Verbose,
-          TEXT("Unbinding Interactor %s from VirtualUser %u"),
-          *Interactor->GetName(),
-          Index);
-      VirtualUserIndexInteractors[Index].Interactor = nullptr;
-      break;
-    }
+    UE_LOG(
+        LogOculusInteraction,
+        Verbose,
+        TEXT("Unbinding Interactor %s from VirtualUser %u"),
+        *Interactor->GetName(),
+        State->VirtualUser->GetVirtualUserIndex());
+    VirtualUserIndexInteractors.Remove(InteractorKey);
   }
 }
 
@@ -19,11 +19,24 @@
  */
 
 #include "Subsystem/IsdkWorldSubsystem.h"
+#include "Algo/Sort.h"
+#include "Components/SceneComponent.h"
+#include "Interaction/IsdkInteractableComponent.h"
 #include "Interaction/IsdkInteractorComponent.h"
 #include "IsdkChecks.h"
 #include "IsdkEventQueueImpl.h"
 #include "StructTypesPrivate.h"
 
+namespace isdk
+{
+TAutoConsoleVariable<bool> CVar_Meta_InteractionSDK_SurfaceBroadPhase(
+    TEXT("Meta.InteractionSDK.SurfaceBroadPhase"),
+    true,
+    TEXT("Disables interactables allowing broad phase culling while no interactor can reach them"));
+
+extern TAutoConsoleVariable<bool> CVar_Meta_InteractionSDK_DebugInteractionVisuals;
+} // namespace isdk
+
 namespace isdk::api
 {
 class FIsdkScaledTimeProviderImpl : public FApiImpl<ScaledTimeProvider, ScaledTimeProviderPtr>
@@ -51,16 +64,42 @@ void UIsdkWorldSubsystem::BeginDestroy()
 void UIsdkWorldSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
   Super::Initialize(Collection);
+
+  // Catches transforms queued by components that tick after the subsystem
+  WorldPostActorTickHandle =
+      FWorldDelegates::OnWorldPostActorTick.AddUObject(this, &ThisClass::OnWorldPostActorTick);
+
+  // This is just for debugging, so let's turn it off in non-editor builds
+#if WITH_EDITOR
+  if (!GIsAutomationTesting)
+  {
+    PointerEventBatchDelegate.AddUObject(this, &ThisClass::DrawPointerEventsDebug);
+  }
+#endif
 }
 
 void UIsdkWorldSubsystem::Deinitialize()
 {
   Super::Deinitialize();
 
+  FWorldDelegates::OnWorldPostActorTick.Remove(WorldPostActorTickHandle);
+  PendingTransformCommits.Empty();
+  PendingTransformCommitLookup.Empty();
+  CommittingTransforms.Empty();
+  CommittingTargets.Empty();
+  CommittingRoots.Empty();
+
   PointerEventSubscriptions.Reset();
   InteractableStateEventSubscriptions.Reset();
   InteractorStateEventSubscriptions.Reset();
   UpdateEventSubscriptions.Reset();
+
+  PointerEventBatchDelegate.Clear();
+  InteractorStateEventBatchDelegate.Clear();
+  InteractableStateEventBatchDelegate.Clear();
+  PointerEventBatch.Empty();
+  InteractorStateEventBatch.Empty();
+  InteractableStateEventBatch.Empty();
 }
 
 void UIsdkWorldSubsystem::Tick(float DeltaTime)
@@ -89,13 +128,27 @@ void UIsdkWorldSubsystem::Tick(float DeltaTime)
   // [BeginFrame]: Prepare the Payload lookup cache, if it is stale.
   UpdateInteractorPayloadLookup();
 
+  // [BeginFrame]: Cull distant interactables before the interactors test their surfaces
+  UpdateSurfaceBroadPhase();
+
   // [BeginFrame]: Interactors will 'drive' inside the IUpdate event
+  LastFrameTimings = {};
+  double StageStartTime = FPlatformTime::Seconds();
   UpdateEventSubscriptions.TryHandleEvents();
+  double StageEndTime = FPlatformTime::Seconds();
+  LastFrameTimings.InteractorUpdateSeconds = StageEndTime - StageStartTime;
 
   // [PopEvent]: Read output events
-  PointerEventSubscriptions.TryHandleEvents();
-  InteractableStateEventSubscriptions.TryHandleEvents();
-  InteractorStateEventSubscriptions.TryHandleEvents();
+  StageStartTime = StageEndTime;
+  PointerEventSubscriptions.TryHandleEventsBatched(PointerEventBatch, PointerEventBatchDelegate);
+  InteractableStateEventSubscriptions.TryHandleEventsBatched(
+      InteractableStateEventBatch, InteractableStateEventBatchDelegate);
+  InteractorStateEventSubscriptions.TryHandleEventsBatched(
+      InteractorStateEventBatch, InteractorStateEventBatchDelegate);
+  LastFrameTimings.EventDispatchSeconds = FPlatformTime::Seconds() - StageStartTime;
+
+  // [Commit]: Apply the transforms produced while handling events
+  CommitPendingTransforms();
 
   // [EndFrame]
   if (FrameFinishedEventDelegate.IsBound())
@@ -297,6 +350,254 @@ void UIsdkWorldSubsystem::UnregisterUpdateEventHandler(EventHandlerToken Token)
   UpdateEventSubscriptions.UnregisterEventHandler(Token);
 }
 
+void UIsdkWorldSubsystem::QueueTransformCommit(
+    USceneComponent* Target,
+    const FTransform& RelativeTransform,
+    FSimpleDelegate OnCommitted)
+{
+  if (!IsValid(Target))
+  {
+    return;
+  }
+
+  const TObjectKey<USceneComponent> TargetKey(Target);
+  if (const int32* ExistingIndex = PendingTransformCommitLookup.Find(TargetKey))
+  {
+    FPendingTransformCommit& Existing = PendingTransformCommits[*ExistingIndex];
+    Existing.RelativeTransform = RelativeTransform;
+    if (OnCommitted.IsBound())
+    {
+      Existing.OnCommitted.Add(MoveTemp(OnCommitted));
+    }
+    return;
+  }
+
+  int32 AttachDepth = 0;
+  for (const USceneComponent* Parent = Target->GetAttachParent(); Parent != nullptr;
+       Parent = Parent->GetAttachParent())
+  {
+    ++AttachDepth;
+  }
+
+  PendingTransformCommitLookup.Add(TargetKey, PendingTransformCommits.Num());
+  FPendingTransformCommit& Commit = PendingTransformCommits.AddDefaulted_GetRef();
+  Commit.Target = Target;
+  Commit.TargetKey = TargetKey;
+  Commit.RelativeTransform = RelativeTransform;
+  if (OnCommitted.IsBound())
+  {
+    Commit.OnCommitted.Add(MoveTemp(OnCommitted));
+  }
+  Commit.AttachDepth = AttachDepth;
+}
+
+const FTransform* UIsdkWorldSubsystem::FindPendingTransformCommit(
+    const USceneComponent* Target) const
+{
+  const int32* Index = PendingTransformCommitLookup.Find(TObjectKey<USceneComponent>(Target));
+  return Index != nullptr ? &PendingTransformCommits[*Index].RelativeTransform : nullptr;
+}
+
+void UIsdkWorldSubsystem::DiscardPendingTransformCommit(const USceneComponent* Target)
+{
+  int32 Index = INDEX_NONE;
+  if (!PendingTransformCommitLookup.RemoveAndCopyValue(TObjectKey<USceneComponent>(Target), Index))
+  {
+    return;
+  }
+
+  PendingTransformCommits.RemoveAtSwap(Index);
+  if (PendingTransformCommits.IsValidIndex(Index))
+  {
+    // Fix up the entry that was swapped into the removed slot
+    PendingTransformCommitLookup.FindChecked(PendingTransformCommits[Index].TargetKey) = Index;
+  }
+}
+
+void UIsdkWorldSubsystem::CommitPendingTransforms()
+{
+  if (PendingTransformCommits.IsEmpty())
+  {
+    return;
+  }
+
+  const double StartTime = FPlatformTime::Seconds();
+
+  // Anything queued by the callbacks below is left for the next commit
+  Swap(PendingTransformCommits, CommittingTransforms);
+  PendingTransformCommitLookup.Reset();
+
+  // Parents first, so that a target is always seen before any queued target below it
+  Algo::StableSortBy(
+      CommittingTransforms, [](const FPendingTransformCommit& Commit) { return Commit.AttachDepth; });
+
+  // Write the relative transforms without updating anything, and remember the topmost moved
+  // component of each hierarchy
+  CommittingTargets.Reset();
+  CommittingRoots.Reset();
+  for (const FPendingTransformCommit& Commit : CommittingTransforms)
+  {
+    USceneComponent* Target = Commit.Target.Get();
+    if (!IsValid(Target))
+    {
+      continue;
+    }
+
+    Target->SetRelativeTransform_Direct(Commit.RelativeTransform);
+    CommittingTargets.Add(Target);
+
+    bool bHasMovedAncestor = false;
+    for (const USceneComponent* Parent = Target->GetAttachParent(); Parent != nullptr;
+         Parent = Parent->GetAttachParent())
+    {
+      if (CommittingTargets.Contains(Parent))
+      {
+        bHasMovedAncestor = true;
+        break;
+      }
+    }
+    if (!bHasMovedAncestor)
+    {
+      CommittingRoots.Add(Target);
+    }
+  }
+
+  // One propagation per hierarchy, which also places every queued child below its root
+  for (USceneComponent* Root : CommittingRoots)
+  {
+    Root->UpdateComponentToWorld();
+    Root->UpdateOverlaps();
+  }
+  CommittingTargets.Reset();
+  CommittingRoots.Reset();
+
+  // Notify once everything has moved, so listeners see the final state of the frame
+  for (const FPendingTransformCommit& Commit : CommittingTransforms)
+  {
+    for (const FSimpleDelegate& OnCommitted : Commit.OnCommitted)
+    {
+      OnCommitted.ExecuteIfBound();
+    }
+  }
+  CommittingTransforms.Reset();
+
+  LastFrameTimings.TransformCommitSeconds += FPlatformTime::Seconds() - StartTime;
+}
+
+void UIsdkWorldSubsystem::OnWorldPostActorTick(
+    UWorld* InWorld,
+    ELevelTick InTickType,
+    float InDeltaSeconds)
+{
+  if (InWorld == GetWorld())
+  {
+    CommitPendingTransforms();
+  }
+}
+
+void UIsdkWorldSubsystem::DrawPointerEventsDebug(
+    TConstArrayView<FIsdkInteractionPointerEvent> Events) const
+{
+  // Only debug draw if the appropriate cvar is on
+  if (!isdk::CVar_Meta_InteractionSDK_DebugInteractionVisuals.GetValueOnAnyThread())
+  {
+    return;
+  }
+
+  for (const FIsdkInteractionPointerEvent& Event : Events)
+  {
+    // Don't draw move pointer events, they're too noisy
+    if (Event.Type == EIsdkPointerEventType::Move)
+    {
+      continue;
+    }
+
+    if (const auto Interactable = Cast<UIsdkInteractableComponent>(Event.Interactable.GetObject()))
+    {
+      Interactable->DrawPointerEventDebug(Event);
+    }
+  }
+}
+
+void UIsdkWorldSubsystem::UpdateSurfaceBroadPhase()
+{
+  const bool bBroadPhaseEnabled =
+      isdk::CVar_Meta_InteractionSDK_SurfaceBroadPhase.GetValueOnGameThread();
+
+  // Interactors have ticked by now, so their probes describe this frame
+  TArray<TPair<UClass*, FIsdkInteractorBroadPhaseProbe>, TInlineAllocator<8>> Probes;
+  TArray<UClass*, TInlineAllocator<4>> UnprobedInteractorClasses;
+  if (bBroadPhaseEnabled)
+  {
+    for (const UIsdkInteractorComponent* Interactor : RegisteredInteractorPayloads)
+    {
+      if (!IsValid(Interactor) ||
+          Interactor->GetInteractorState() == EIsdkInteractorState::Disabled)
+      {
+        continue;
+      }
+      FIsdkInteractorBroadPhaseProbe Probe;
+      if (Interactor->GetBroadPhaseProbe(Probe))
+      {
+        Probes.Emplace(Interactor->GetClass(), Probe);
+      }
+      else
+      {
+        UnprobedInteractorClasses.AddUnique(Interactor->GetClass());
+      }
+    }
+  }
+
+  const auto IsWithinReach = [&Probes, &UnprobedInteractorClasses](
+                                 const UIsdkInteractableComponent& Interactable)
+  {
+    UClass* InteractorClass = Interactable.GetBroadPhaseInteractorClass();
+    FSphere Bounds;
+    if (!InteractorClass || !Interactable.GetBroadPhaseBoundingSphere(Bounds))
+    {
+      return true;
+    }
+    for (const UClass* UnprobedClass : UnprobedInteractorClasses)
+    {
+      if (UnprobedClass->IsChildOf(InteractorClass))
+      {
+        return true;
+      }
+    }
+    for (const auto& [ProbeClass, Probe] : Probes)
+    {
+      if (ProbeClass->IsChildOf(InteractorClass) &&
+          FMath::PointDistToSegmentSquared(Bounds.Center, Probe.Start, Probe.End) <=
+              FMath::Square(Bounds.W + Probe.Radius))
+      {
+        return true;
+      }
+    }
+    return false;
+  };
+
+  for (UIsdkInteractableComponent* Interactable : RegisteredInteractables)
+  {
+    if (!IsValid(Interactable))
+    {
+      continue;
+    }
+    if (!bBroadPhaseEnabled || !Interactable->bAllowBroadPhaseCulling)
+    {
+      Interactable->SetBroadPhaseCulled(false);
+      continue;
+    }
+
+    // Never cull an interactable while it is being interacted with
+    const EIsdkInteractableState State = Interactable->GetCurrentState();
+    if (State == EIsdkInteractableState::Hover || State == EIsdkInteractableState::Select)
+    {
+      continue;
+    }
+    Interactable->SetBroadPhaseCulled(!IsWithinReach(*Interactable));
+  }
+}
+
 void UIsdkWorldSubsystem::UpdateInteractorPayloadLookup()
 {
   if (RegisteredInteractorPayloadsLookup.empty())
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * Licensed under the Oculus SDK License Agreement (the "License");
+ * you may not use the Oculus SDK except in compliance with the License,
+ * which is provided at the time of installation or download, or which
+ * otherwise accompanies this software in either electronic or hard copy form.
+ *
+ * You may obtain a copy of the License at
+ *
+ * https://developer.oculus.com/licenses/oculussdk/
+ *
+ * Unless required by applicable law or agreed to in writing, the Oculus SDK
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Interaction/IsdkClippedPlaneSurface.h"
+#include "Interaction/Surfaces/IsdkPointableBox.h"
+#include "Interaction/Surfaces/IsdkPointablePlane.h"
+#include "Misc/AutomationTest.h"
+#include "StructTypes.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FIsdkSurfaceBoundsTest,
+    "InteractionSDK.OculusInteraction.Source.OculusInteraction.Private.Tests.FIsdkSurfaceBoundsTest.All",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FIsdkSurfaceBoundsTest::RunTest(const FString& Parameters)
+{
+  UIsdkPointablePlane* Plane = NewObject<UIsdkPointablePlane>();
+  Plane->SetSize(FVector2D(30.0, 40.0));
+
+  // Plane bounds follow the size, and are rebuilt when the transform changes
+  {
+    FSphere Sphere;
+    TestTrue(TEXT("Plane has bounds"), Plane->GetWorldBoundingSphere(Sphere));
+    TestEqual(TEXT("Plane center"), Sphere.Center, FVector::ZeroVector);
+    TestEqual(TEXT("Plane radius"), Sphere.W, 50.0);
+
+    Plane->SetWorldLocation(FVector(100.0, 0.0, 0.0));
+    Plane->SetWorldScale3D(FVector(1.0, 2.0, 2.0));
+    Plane->GetWorldBoundingSphere(Sphere);
+    TestEqual(TEXT("Moved plane center"), Sphere.Center, FVector(100.0, 0.0, 0.0));
+    TestEqual(TEXT("Scaled plane radius"), Sphere.W, 100.0);
+  }
+
+  // Box bounds enclose the corners of the box
+  {
+    UIsdkPointableBox* Box = NewObject<UIsdkPointableBox>();
+    Box->SetSize(FVector(20.0, 20.0, 20.0));
+    FSphere Sphere;
+    TestTrue(TEXT("Box has bounds"), Box->GetWorldBoundingSphere(Sphere));
+    TestEqual(TEXT("Box radius"), Sphere.W, FMath::Sqrt(300.0));
+  }
+
+  // Clipped surfaces fall back to the plane, and are otherwise bound by their clippers
+  {
+    UIsdkClippedPlaneSurface* Surface = NewObject<UIsdkClippedPlaneSurface>();
+    FSphere Sphere;
+    TestFalse(TEXT("No bounds without a plane"), Surface->GetWorldBoundingSphere(Sphere));
+
+    Surface->SetPointablePlane(Plane);
+    TestTrue(TEXT("Unclipped surface has bounds"), Surface->GetWorldBoundingSphere(Sphere));
+    TestEqual(TEXT("Unclipped surface radius"), Sphere.W, 100.0);
+
+    FIsdkBoundsClipper Clipper;
+    Clipper.PoseProvider = Plane;
+    Clipper.Position = FVector3f(0.f, 10.f, 0.f);
+    Clipper.Size = FVector3f(0.f, 5.f, 5.f);
+    Surface->SetBoundsClippers({Clipper});
+    TestTrue(TEXT("Clipped surface has bounds"), Surface->GetWorldBoundingSphere(Sphere));
+    TestEqual(TEXT("Clipped surface center"), Sphere.Center, FVector(100.0, 20.0, 0.0));
+    TestEqual(TEXT("Clipped surface radius"), Sphere.W, FMath::Sqrt(50.0));
+
+    Plane->SetWorldLocation(FVector(0.0, 0.0, 50.0));
+    Surface->GetWorldBoundingSphere(Sphere);
+    TestEqual(TEXT("Clipped surface follows the plane"), Sphere.Center, FVector(0.0, 20.0, 50.0));
+  }
+
+  return true;
+}
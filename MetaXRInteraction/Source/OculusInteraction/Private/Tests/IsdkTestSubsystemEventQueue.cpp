@@ -177,3 +177,98 @@ bool FIsdkSubsystemTickTest::RunTest(const FString& Parameters)
 
   return bPassed;
 }
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FIsdkSubsystemBatchedDispatchTest,
+    "InteractionSDK.OculusInteraction.Source.OculusInteraction.Private.Tests.Subsystem.BatchedDispatch",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FIsdkSubsystemBatchedDispatchTest::RunTest(const FString& Parameters)
+{
+  UIsdkTestRayFixture* RayTest = NewObject<UIsdkTestRayFixture>();
+  RayTest->SetUp();
+
+  FSubsystemCollection<UWorldSubsystem> TestSubsystemCollection{};
+  UWorld* World = UWorld::CreateWorld(EWorldType::Editor, false);
+  TestSubsystemCollection.Initialize(World);
+  const auto Subsystem =
+      TestSubsystemCollection.GetSubsystem<UIsdkWorldSubsystem>(UIsdkWorldSubsystem::StaticClass());
+  if (!TestTrue("Failed to create UIsdkWorldSubsystem", IsValid(Subsystem)))
+  {
+    return false;
+  }
+
+  // Native batch listeners, alongside the per-target delegates of the fixture
+  int32 NumPointerBatches = 0;
+  TArray<EIsdkPointerEventType> BatchedPointerEvents;
+  int32 NumInteractorStateEvents = 0;
+  int32 NumInteractableStateEvents = 0;
+  Subsystem->GetPointerEventBatchDelegate().AddLambda(
+      [&](TConstArrayView<FIsdkInteractionPointerEvent> Events)
+      {
+        ++NumPointerBatches;
+        for (const FIsdkInteractionPointerEvent& Event : Events)
+        {
+          BatchedPointerEvents.Add(Event.Type);
+        }
+      });
+  Subsystem->GetInteractorStateEventBatchDelegate().AddLambda(
+      [&](TConstArrayView<FIsdkInteractorStateEvent> Events)
+      { NumInteractorStateEvents += Events.Num(); });
+  Subsystem->GetInteractableStateEventBatchDelegate().AddLambda(
+      [&](TConstArrayView<FIsdkInteractableStateEvent> Events)
+      { NumInteractableStateEvents += Events.Num(); });
+
+  const auto UpdatedToken = Subsystem->RegisterUpdateEventHandler(
+      [RayTest]() -> isdk::api::IUpdate* { return &RayTest->RayInteractor.Get(); },
+      RayTest->Updated);
+  const auto InteractorStateChangedToken = Subsystem->RegisterInteractorStateEventHandler(
+      RayTest,
+      TEXT("test"),
+      [RayTest]() -> isdk::api::IInteractor* { return &RayTest->RayInteractor.Get(); },
+      RayTest->InteractorStateChanged);
+  const auto InteractableStateChangedToken = Subsystem->RegisterInteractableStateEventHandler(
+      RayTest,
+      [RayTest]() -> isdk::api::IInteractable* { return &RayTest->RayInteractable.Get(); },
+      RayTest->InteractableStateChanged);
+  const auto InteractablePointedToken = Subsystem->RegisterPointerEventHandler(
+      [RayTest]() -> isdk::api::IPointable* { return &RayTest->RayInteractable.Get(); },
+      RayTest->InteractablePointed,
+      RayTest->MockInteractable);
+
+  Subsystem->Tick(0.01f);
+
+  // Per-target delegates see the same events as without batching, and batch listeners get all
+  // of them in a single call per type
+  bool bPassed = VerifyEventsReceived(RayTest, this);
+  bPassed &= TestEqual(TEXT("Pointer Batch Count"), NumPointerBatches, 1);
+  bPassed &= TestEqual(TEXT("Batched Pointer Event Count"), BatchedPointerEvents.Num(), 2);
+  if (BatchedPointerEvents.Num() == 2)
+  {
+    bPassed &= TestEqual(
+        TEXT("Batched Pointer Event [0] Value"),
+        BatchedPointerEvents[0],
+        EIsdkPointerEventType::Hover);
+    bPassed &= TestEqual(
+        TEXT("Batched Pointer Event [1] Value"),
+        BatchedPointerEvents[1],
+        EIsdkPointerEventType::Move);
+  }
+  bPassed &= TestEqual(TEXT("Batched Interactor Event Count"), NumInteractorStateEvents, 1);
+  bPassed &= TestEqual(TEXT("Batched Interactable Event Count"), NumInteractableStateEvents, 1);
+
+  // Cleanup
+  Subsystem->UnregisterUpdateEventHandler(UpdatedToken);
+  Subsystem->UnregisterInteractorStateEventHandler(InteractorStateChangedToken);
+  Subsystem->UnregisterInteractableStateEventHandler(InteractableStateChangedToken);
+  Subsystem->UnregisterPointerEventHandler(InteractablePointedToken);
+
+  TestSubsystemCollection.Deinitialize();
+  RayTest->TearDown();
+  RayTest->MarkAsGarbage();
+
+  World->DestroyWorld(false);
+  World->MarkAsGarbage();
+
+  return bPassed;
+}
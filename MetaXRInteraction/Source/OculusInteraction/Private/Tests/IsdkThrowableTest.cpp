@@ -56,3 +56,51 @@ bool FIsdkThrowableTest::RunTest(const FString& Parameters)
 
   return true;
 }
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FIsdkThrowableRingBufferTest,
+    "InteractionSDK.OculusInteraction.Source.OculusInteraction.Private.Tests.FIsdkThrowableTest.RingBuffer",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FIsdkThrowableRingBufferTest::RunTest(const FString& Parameters)
+{
+  UIsdkThrowable* MockThrowable = NewObject<UIsdkThrowable>();
+  MockThrowable->Settings.SampleSize = 3;
+  MockThrowable->Settings.VelocityEstimationMethod = EIsdkVelocityEstimationMethod::VE_LeastSquares;
+
+  // Empty samples keep a buffer to wrap around in, instead of a zero sized one
+  MockThrowable->SetSamplePositions({});
+  MockThrowable->SetSampleRotations({});
+  TestEqual("Empty Position Capacity", MockThrowable->LastNPositions.Num(), 3);
+  TestEqual("Empty Rotation Capacity", MockThrowable->LastNRotations.Num(), 3);
+  TestEqual("Empty Velocity", MockThrowable->GetVelocity(), FVector::ZeroVector);
+
+  // Five samples through a three sample buffer, so the write index wraps around
+  for (int32 i = 0; i < 5; ++i)
+  {
+    MockThrowable->AddPositionSample(FVector(3.0 * i, 0, 0), static_cast<float>(i));
+    MockThrowable->AddRotationSample(FQuat::Identity, static_cast<float>(i));
+  }
+  TestEqual("Wrapped Position Count", MockThrowable->NumPositionSamples, 3);
+  TestEqual("Wrapped Rotation Count", MockThrowable->NumRotationSamples, 3);
+  TestEqual("Oldest Sample After Wrap", MockThrowable->GetPositionSample(0).Value, 2.0f);
+  TestEqual("Newest Sample After Wrap", MockThrowable->GetPositionSample(2).Value, 4.0f);
+  TestEqual("Running Sum Count After Wrap", MockThrowable->RunningSums.Num, 3);
+
+  // The running sums only hold the samples still in the buffer
+  const FVector WrappedVelocity = MockThrowable->GetVelocity();
+  TestEqual("Wrapped Velocity X", WrappedVelocity.X, 3.0, 0.001);
+  TestEqual("Wrapped Velocity Y", WrappedVelocity.Y, 0.0, 0.001);
+
+  // A full buffer handed in directly wraps onto its oldest sample next
+  TArray<TPair<FVector, float>> SamplePositions;
+  SamplePositions.Add(TPair<FVector, float>(FVector(0, 0, 0), 0.0f));
+  SamplePositions.Add(TPair<FVector, float>(FVector(1, 0, 0), 1.0f));
+  SamplePositions.Add(TPair<FVector, float>(FVector(2, 0, 0), 2.0f));
+  MockThrowable->SetSamplePositions(SamplePositions);
+  MockThrowable->AddPositionSample(FVector(3, 0, 0), 3.0f);
+  TestEqual("Oldest Set Sample Replaced", MockThrowable->GetPositionSample(0).Value, 1.0f);
+  TestEqual("Set Sample Velocity X", MockThrowable->GetVelocity().X, 1.0, 0.001);
+
+  return true;
+}
@@ -0,0 +1,124 @@
+﻿/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * Licensed under the Oculus SDK License Agreement (the "License");
+ * you may not use the Oculus SDK except in compliance with the License,
+ * which is provided at the time of installation or download, or which
+ * otherwise accompanies this software in either electronic or hard copy form.
+ *
+ * You may obtain a copy of the License at
+ *
+ * https://developer.oculus.com/licenses/oculussdk/
+ *
+ * Unless required by applicable law or agreed to in writing, the Oculus SDK
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Components/SceneComponent.h"
+#include "Misc/AutomationTest.h"
+#include "Subsystem/IsdkWorldSubsystem.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    FIsdkSubsystemTransformCommitTest,
+    "InteractionSDK.OculusInteraction.Source.OculusInteraction.Private.Tests.Subsystem.TransformCommit",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FIsdkSubsystemTransformCommitTest::RunTest(const FString& Parameters)
+{
+  FSubsystemCollection<UWorldSubsystem> TestSubsystemCollection{};
+  UWorld* World = UWorld::CreateWorld(EWorldType::Editor, false);
+  TestSubsystemCollection.Initialize(World);
+  const auto Subsystem =
+      TestSubsystemCollection.GetSubsystem<UIsdkWorldSubsystem>(UIsdkWorldSubsystem::StaticClass());
+  if (!TestTrue("Failed to create UIsdkWorldSubsystem", IsValid(Subsystem)))
+  {
+    return false;
+  }
+
+  USceneComponent* Parent = NewObject<USceneComponent>(World);
+  USceneComponent* Child = NewObject<USceneComponent>(World);
+  Child->SetupAttachment(Parent);
+
+  const FTransform ParentFirst(FVector(50.0, 0.0, 0.0));
+  const FTransform ParentFinal(FVector(100.0, 0.0, 0.0));
+  const FTransform ChildFinal(FVector(0.0, 0.0, 10.0));
+
+  // The child is queued before its parent, and the parent is queued twice by different owners
+  TArray<FString> Committed;
+  FVector ChildLocationSeenByParentOwner = FVector::ZeroVector;
+  Subsystem->QueueTransformCommit(
+      Child, ChildFinal, FSimpleDelegate::CreateLambda([&] { Committed.Add(TEXT("Child")); }));
+  Subsystem->QueueTransformCommit(
+      Parent,
+      ParentFirst,
+      FSimpleDelegate::CreateLambda(
+          [&]
+          {
+            Committed.Add(TEXT("ParentFirst"));
+            ChildLocationSeenByParentOwner = Child->GetComponentLocation();
+          }));
+  Subsystem->QueueTransformCommit(
+      Parent,
+      ParentFinal,
+      FSimpleDelegate::CreateLambda(
+          [&]
+          {
+            Committed.Add(TEXT("ParentFinal"));
+            // Queued from a callback, so it waits for the next commit
+            Subsystem->QueueTransformCommit(Child, FTransform::Identity);
+          }));
+
+  // The latest request for a target wins, and nothing moves until the commit
+  const FTransform* PendingParent = Subsystem->FindPendingTransformCommit(Parent);
+  bool bPassed = TestNotNull(TEXT("Pending Parent Transform"), PendingParent);
+  if (PendingParent != nullptr)
+  {
+    bPassed &= TestTrue(
+        TEXT("Pending Parent Transform Is Latest"), PendingParent->Equals(ParentFinal));
+  }
+  bPassed &= TestTrue(
+      TEXT("Parent Not Moved Before Commit"),
+      Parent->GetRelativeTransform().Equals(FTransform::Identity));
+
+  Subsystem->CommitPendingTransforms();
+
+  // The child is placed against its parent's final transform
+  bPassed &= TestTrue(
+      TEXT("Parent Relative Transform"), Parent->GetRelativeTransform().Equals(ParentFinal));
+  bPassed &= TestTrue(
+      TEXT("Child Relative Transform"), Child->GetRelativeTransform().Equals(ChildFinal));
+  bPassed &= TestTrue(
+      TEXT("Child World Location"),
+      Child->GetComponentLocation().Equals(FVector(100.0, 0.0, 10.0)));
+
+  // Every owner of a deduplicated target is told once, after everything has moved
+  bPassed &= TestEqual(
+      TEXT("Committed Callbacks"),
+      FString::Join(Committed, TEXT(",")),
+      FString(TEXT("ParentFirst,ParentFinal,Child")));
+  bPassed &= TestTrue(
+      TEXT("Callbacks See Final State"),
+      ChildLocationSeenByParentOwner.Equals(FVector(100.0, 0.0, 10.0)));
+
+  // Only the transform queued from the callback is left, and a discarded one is never applied
+  bPassed &= TestNull(
+      TEXT("Parent Pending After Commit"), Subsystem->FindPendingTransformCommit(Parent));
+  bPassed &= TestNotNull(
+      TEXT("Child Pending From Callback"), Subsystem->FindPendingTransformCommit(Child));
+  Subsystem->DiscardPendingTransformCommit(Child);
+  Subsystem->CommitPendingTransforms();
+  bPassed &= TestTrue(
+      TEXT("Discarded Child Transform"), Child->GetRelativeTransform().Equals(ChildFinal));
+
+  // Cleanup
+  TestSubsystemCollection.Deinitialize();
+
+  World->DestroyWorld(false);
+  World->MarkAsGarbage();
+
+  return bPassed;
+}
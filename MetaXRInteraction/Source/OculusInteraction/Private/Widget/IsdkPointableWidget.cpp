@@ -24,7 +24,27 @@
 
 UIsdkPointableWidget::UIsdkPointableWidget()
 {
-  PrimaryComponentTick.bCanEverTick = false;
+  // Only ticks while there are held pointer events, after interactors have posted theirs
+  PrimaryComponentTick.bCanEverTick = true;
+  PrimaryComponentTick.bStartWithTickEnabled = false;
+  PrimaryComponentTick.TickGroup = ETickingGroup::TG_PostUpdateWork;
+}
+
+void UIsdkPointableWidget::TickComponent(
+    float DeltaTime,
+    ELevelTick TickType,
+    FActorComponentTickFunction* ThisTickFunction)
+{
+  Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+  FlushPendingPointerEvents();
+}
+
+void UIsdkPointableWidget::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+  PendingPointerEvents.Reset();
+
+  Super::EndPlay(EndPlayReason);
 }
 
 void UIsdkPointableWidget::HandleInteractionPointerEvent(
@@ -41,11 +61,92 @@ void UIsdkPointableWidget::HandleInteractionPointerEvent(
       VirtualUserIndex,
       PointerIndex};
 
+  const bool bCoalescable = PointerEvent.Type == EIsdkPointerEventType::Hover ||
+      PointerEvent.Type == EIsdkPointerEventType::Move;
+  if (!bCoalescable || !bCoalesceMoveEvents)
+  {
+    // Held events happened before this one, so they have to reach Slate first
+    FlushPendingPointerEventsFor(PointerEvent.Interactor);
+    RouteVirtualUserPointerEvent(VirtualUserPointerEvent);
+    return;
+  }
+
+  FPendingPointerEvents* Pending = PendingPointerEvents.FindByPredicate(
+      [Interactor = PointerEvent.Interactor](const FPendingPointerEvents& Entry)
+      { return (Entry.bHasHover ? Entry.Hover : Entry.Move).Interactor == Interactor; });
+  if (Pending == nullptr)
+  {
+    Pending = &PendingPointerEvents.AddDefaulted_GetRef();
+  }
+
+  if (PointerEvent.Type == EIsdkPointerEventType::Hover)
+  {
+    Pending->Hover = VirtualUserPointerEvent;
+    Pending->bHasHover = true;
+  }
+  else
+  {
+    Pending->Move = VirtualUserPointerEvent;
+    Pending->bHasMove = true;
+  }
+  SetComponentTickEnabled(true);
+}
+
+void UIsdkPointableWidget::FlushPendingPointerEvents()
+{
+  // Routing may post further events to this widget, so drain from a local copy
+  TArray<FPendingPointerEvents, TInlineAllocator<4>> Pending = MoveTemp(PendingPointerEvents);
+  PendingPointerEvents.Reset();
+  SetComponentTickEnabled(false);
+
+  for (const FPendingPointerEvents& Entry : Pending)
+  {
+    RoutePendingPointerEvents(Entry);
+  }
+}
+
+void UIsdkPointableWidget::FlushPendingPointerEventsFor(const UObject* Interactor)
+{
+  const int32 Index = PendingPointerEvents.IndexOfByPredicate(
+      [Interactor](const FPendingPointerEvents& Entry)
+      { return (Entry.bHasHover ? Entry.Hover : Entry.Move).Interactor == Interactor; });
+  if (Index == INDEX_NONE)
+  {
+    return;
+  }
+
+  const FPendingPointerEvents Pending = PendingPointerEvents[Index];
+  PendingPointerEvents.RemoveAtSwap(Index);
+  RoutePendingPointerEvents(Pending);
+}
+
+void UIsdkPointableWidget::RoutePendingPointerEvents(const FPendingPointerEvents& Pending)
+{
+  // The interactor may have been destroyed since its events were held
+  const UObject* Interactor = (Pending.bHasHover ? Pending.Hover : Pending.Move).Interactor;
+  if (!IsValid(Interactor))
+  {
+    return;
+  }
+
+  if (Pending.bHasHover)
+  {
+    RouteVirtualUserPointerEvent(Pending.Hover);
+  }
+  if (Pending.bHasMove)
+  {
+    RouteVirtualUserPointerEvent(Pending.Move);
+  }
+}
+
+void UIsdkPointableWidget::RouteVirtualUserPointerEvent(
+    const FIsdkVirtualUserPointerEvent& VirtualUserPointerEvent)
+{
   UIsdkWidget::HandleVirtualUserPointerEvent(
       VirtualUserPointerEvent,
       AttachedWidget,
       WidgetEventDelegate,
-      WidgetSubsystem,
+      UIsdkWidgetSubsystem::Get(GetWorld()),
       MinMoveTravelDistance,
       bStopBroadcastOnDrag);
 }
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * Licensed under the Oculus SDK License Agreement (the "License");
+ * you may not use the Oculus SDK except in compliance with the License,
+ * which is provided at the time of installation or download, or which
+ * otherwise accompanies this software in either electronic or hard copy form.
+ *
+ * You may obtain a copy of the License at
+ *
+ * https://developer.oculus.com/licenses/oculussdk/
+ *
+ * Unless required by applicable law or agreed to in writing, the Oculus SDK
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "CoreGlobals.h"
+
+/**
+ * @struct FIsdkHandSnapshot
+ * @brief Tracking data for one hand, read from the platform at most once per frame.
+ *
+ * Tracking data subsystems own one snapshot per hand and hand it out to every data source
+ * component driving that hand, so that rigs with several consumers of the same hand (hand mesh,
+ * poke, ray, grab, pose detection, or several rigs) query and convert the platform joints only
+ * once. The first data source to tick in a frame fills the snapshot; the others read it. The space
+ * JointPoses are expressed in is defined by the subsystem that owns the snapshot.
+ */
+struct FIsdkHandSnapshot
+{
+  /** GFrameCounter at the time the snapshot was last read, MAX_uint64 if never read. */
+  uint64 FrameNumber = MAX_uint64;
+
+  bool bIsTracked = false;
+  bool bIsHighConfidence = false;
+
+  /** Whether the joint data has been filled in this frame. */
+  bool bHasJoints = false;
+
+  TArray<FTransform> JointPoses;
+
+  /** Joint radii, only filled by platforms that report them. */
+  TArray<float> JointRadii;
+
+  /** Returns true if the snapshot was read during the current frame. */
+  bool IsCurrent() const
+  {
+    return FrameNumber == GFrameCounter;
+  }
+
+  /** Clears per frame state and stamps the snapshot with the current frame. */
+  void BeginFrame()
+  {
+    FrameNumber = GFrameCounter;
+    bIsTracked = false;
+    bIsHighConfidence = false;
+    bHasJoints = false;
+  }
+};
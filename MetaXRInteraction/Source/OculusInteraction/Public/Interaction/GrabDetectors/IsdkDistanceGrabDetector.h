@@ -22,6 +22,7 @@
 
 #include "CoreMinimal.h"
 #include "IsdkGrabDetector.h"
+#include "Subsystem/IsdkGrabbableSubsystem.h"
 #include "IsdkDistanceGrabDetector.generated.h"
 
 class USphereComponent;
@@ -52,9 +53,9 @@ class OCULUSINTERACTION_API UIsdkDistanceGrabDetector : public UIsdkGrabDetector
 
  protected:
   /**
-   * The radius of the cone/frustum used to detect grabbables.  Note that under the hood, we're
-   * using a sphere collider with radius equal to FrustumRadius to detect grab candidates, so very
-   * large values may not be performant.
+   * The radius of the cone/frustum used to detect grabbables.  Note that when
+   * bUseGrabbableRegistry is disabled, we're using a sphere collider with radius equal to
+   * FrustumRadius to detect grab candidates, so very large values may not be performant.
    */
   UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = InteractionSDK)
   float FrustumRadius = 1000.f;
@@ -65,6 +66,14 @@ class OCULUSINTERACTION_API UIsdkDistanceGrabDetector : public UIsdkGrabDetector
   UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = InteractionSDK)
   float FrustumAngle = 25.f;
 
+  /**
+   * If true, candidates are found with a cone query against the world's grabbable registry
+   * instead of through the overlaps of DistanceGrabCollider.  Only grabbable colliders are
+   * considered, and the collider is left without collision.
+   */
+  UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = InteractionSDK)
+  bool bUseGrabbableRegistry = true;
+
   /**
    * If true, visuals for this detector will be disabled when the
    * "Meta.InteractionSDK.DebugInteractionVisuals" console variable is enabled.
@@ -98,4 +107,15 @@ class OCULUSINTERACTION_API UIsdkDistanceGrabDetector : public UIsdkGrabDetector
    */
   UPROPERTY(BlueprintReadOnly, Category = InteractionSDK)
   TObjectPtr<USphereComponent> DistanceGrabCollider;
+
+ private:
+  void ConsiderGrabbable(
+      UIsdkGrabbableComponent* Grabbable,
+      const FSphere& BoundsSphere,
+      const FVector& PointerLocation,
+      const FVector& PointerVector,
+      float& InOutLeastAngle);
+
+  // Reused between ticks so registry queries don't allocate
+  TArray<FIsdkGrabbableQueryHit> QueryHits;
 };
@@ -23,6 +23,7 @@
 #include "CoreMinimal.h"
 #include "IsdkGrabDetector.h"
 #include "Engine/HitResult.h"
+#include "Subsystem/IsdkGrabbableSubsystem.h"
 #include "IsdkRayGrabDetector.generated.h"
 
 struct FHitResult;
@@ -59,6 +60,14 @@ class OCULUSINTERACTION_API UIsdkRayGrabDetector : public UIsdkGrabDetector
   UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = InteractionSDK)
   bool bDisableDebugVisuals = false;
 
+  /**
+   * If true, grabbables along the ray are found with a query against the world's grabbable
+   * registry, and only their grab colliders are traced.  Otherwise, a multi line trace against
+   * the whole world is used.
+   */
+  UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = InteractionSDK)
+  bool bUseGrabbableRegistry = true;
+
   // The length of the ray used to detect grabbables
   UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = InteractionSDK)
   float RayLength = 1000.f;
@@ -78,4 +87,14 @@ class OCULUSINTERACTION_API UIsdkRayGrabDetector : public UIsdkGrabDetector
 
   // Transform from grabbed object space to hit space
   FTransform SelectHitTransform = FTransform::Identity;
+
+ private:
+  bool IsHoverable(UIsdkGrabbableComponent* Grabbable) const;
+  void TraceGrabbableRegistry(
+      UIsdkGrabbableSubsystem& GrabbableSubsystem,
+      const FVector& Start,
+      const FVector& End);
+
+  // Reused between ticks so registry queries don't allocate
+  TArray<FIsdkGrabbableQueryHit> QueryHits;
 };
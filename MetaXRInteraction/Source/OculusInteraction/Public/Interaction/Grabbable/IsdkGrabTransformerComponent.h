@@ -232,6 +232,11 @@ class OCULUSINTERACTION_API UIsdkGrabTransformerComponent : public UActorCompone
   void UpdateTransform();
   void EndTransform();
 
+  /**
+   * The target's transform, including an update that is still waiting to be committed
+   */
+  FIsdkTargetTransform GetCurrentTargetTransform() const;
+
   FIsdkTargetTransform TargetInitialTransform;
 
   UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = InteractionSDK)
@@ -361,6 +366,11 @@ class OCULUSINTERACTION_API UIsdkGrabTransformerComponent : public UActorCompone
   FTransform QueuedInteractorSnapPoint = FTransform::Identity;
   float QueuedMoveSnapDuration = 0.f;
 
+  // Applies an updated relative transform to the target, deferred to the world subsystem's
+  // transform commit unless Meta.InteractionSDK.DeferGrabTransforms is off
+  void ApplyUpdatedTransform(const FTransform& RelativeTransform);
+  void BroadcastUpdateTransformEvent();
+
   // Resets transformer state
   void RestartTransformer();
   void UpdateTransformerConstraints();
@@ -65,6 +65,7 @@ class OCULUSINTERACTION_API UIsdkClippedPlaneSurface : public UActorComponent,
   virtual void BeginDestroy() override;
 
   virtual isdk::api::ISurfacePatch* GetApiISurfacePatch() override;
+  virtual bool GetWorldBoundingSphere(FSphere& OutSphere) const override;
   isdk::api::ClippedPlaneSurface* GetApiClippedPlaneSurface();
 
   /**
@@ -112,11 +113,28 @@ class OCULUSINTERACTION_API UIsdkClippedPlaneSurface : public UActorComponent,
 
   FDelegateHandle TransformUpdatedDelegateHandle;
   void UpdateNativeBoundsClipper();
+  void HandlePointablePlaneTransformUpdated();
 
   // IHasDebugSegments
   virtual void GetDebugSegments(TArray<TPair<FVector, FVector>>& OutSegments) const override;
   // ~IHasDebugSegments
 
  private:
+  bool ComputeWorldBoundingSphere(FSphere& OutSphere) const;
+  void BindClipperTransformUpdates();
+  void UnbindClipperTransformUpdates();
+
   TPimplPtr<isdk::api::helper::FClippedPlaneSurfaceImpl> ClippedPlaneSurfaceImpl;
+
+  // Plane scale the native clippers were last generated with; they only depend on the scale, so
+  // moving or rotating the plane does not need to regenerate them.
+  FVector NativeClipperScale = FVector::OneVector;
+
+  // Clipper poses other than the plane, which also invalidate the world space bounds when moved
+  TArray<TPair<TWeakObjectPtr<USceneComponent>, FDelegateHandle>> ClipperTransformUpdatedHandles;
+
+  // World space bounds, rebuilt lazily after the plane, a clipper pose or the clip set changes
+  mutable FSphere CachedWorldBoundingSphere{ForceInit};
+  mutable bool bHasWorldBoundingSphere = false;
+  mutable bool bWorldBoundingSphereDirty = true;
 };
@@ -23,6 +23,7 @@
 #include "CoreMinimal.h"
 #include "Interaction/IsdkSceneInteractableComponent.h"
 #include "Components/PrimitiveComponent.h"
+#include "UObject/ObjectKey.h"
 #include "Pointable/IsdkIPointable.h"
 #include "StructTypes.h"
 #include "IsdkGrabbableComponent.generated.h"
@@ -78,6 +79,7 @@ class OCULUSINTERACTION_API UIsdkGrabbableComponent : public UIsdkSceneInteracta
   UIsdkGrabbableComponent();
 
   virtual void BeginPlay() override;
+  virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
   virtual void OnRegister() override;
   virtual void
   TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* TickFn) override;
@@ -165,6 +167,17 @@ class OCULUSINTERACTION_API UIsdkGrabbableComponent : public UIsdkSceneInteracta
   UFUNCTION(BlueprintCallable, Category = InteractionSDK)
   void SetColliderMode(EIsdkGrabbableColliderMode NewColliderMode, float NewSize);
 
+  /**
+   * Stamps this grabbable as hovered by Grabber during the grabber's hover pass Generation.
+   * @return true the first time it is called for a given grabber and generation
+   */
+  bool MarkHoveredInGeneration(const UIsdkGrabberComponent* Grabber, uint32 Generation);
+
+  /**
+   * @return true if Grabber stamped this grabbable as hovered during its hover pass Generation
+   */
+  bool WasHoveredInGeneration(const UIsdkGrabberComponent* Grabber, uint32 Generation) const;
+
   bool IsHandGrabAllowed() const;
   bool IsDistanceGrabAllowed() const;
   bool IsRayGrabAllowed() const;
@@ -268,6 +281,16 @@ protected:
    */
   TArray<TObjectPtr<UIsdkGrabberComponent>> HoveredGrabbers;
 
+  /**
+   * The last hover pass of each grabber that found this grabbable hovered
+   */
+  struct FHoverGeneration
+  {
+    TObjectKey<UIsdkGrabberComponent> Grabber;
+    uint32 Generation = 0;
+  };
+  TArray<FHoverGeneration, TInlineAllocator<4>> HoverGenerations;
+
   /**
    * Delegate broadcast when pointer events are triggered
    */
@@ -277,6 +300,9 @@ protected:
   UFUNCTION()
   void HandlePointerEvent(const FIsdkInteractionPointerEvent& PointerEvent);
 
+  /* Keeps the world's grabbable registry in sync after the grab collider changed */
+  void NotifyGrabColliderChanged();
+
   UPROPERTY()
   TObjectPtr<UMaterialInterface> CustomCollisionMaterial;
 };
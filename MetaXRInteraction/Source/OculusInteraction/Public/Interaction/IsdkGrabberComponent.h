@@ -285,16 +285,25 @@ class OCULUSINTERACTION_API UIsdkGrabberComponent : public UIsdkSceneInteractorC
  private:
   void TickInteractors(float DeltaTime);
   void UpdateHoveredGrabbables();
+  void MarkHovered(UIsdkGrabbableComponent* Grabbable);
   virtual void UpdateInteractorState();
   void UpdateRayGrabVisuals();
   void UpdateDistanceGrabVisuals();
   void UpdateHoveredInteractor();
 
   void PostEvent(EIsdkPointerEventType Type, UIsdkGrabbableComponent* Dest);
+  void PostEvents(EIsdkPointerEventType Type, TConstArrayView<UIsdkGrabbableComponent*> Dests);
   void ResetGrabState();
 
   int64 PointerEventToken = 0;
 
+  // Incremented on every hover pass, grabbables found hovered during the pass are stamped with it
+  uint32 HoverGeneration = 0;
+
+  // Grabbables entering and leaving hover during the current pass, kept to reuse their memory
+  TArray<UIsdkGrabbableComponent*> NewlyHoveredScratch;
+  TArray<UIsdkGrabbableComponent*> NewlyUnhoveredScratch;
+
   UPROPERTY(Instanced)
   TObjectPtr<UIsdkGrabbableComponent> GrabbedComponent;
 
@@ -47,6 +47,15 @@ class OCULUSINTERACTION_API IIsdkISurfacePatch
   virtual isdk::api::ISurfacePatch* GetApiISurfacePatch()
       PURE_VIRTUAL(ISurfacePatch::GetApiISurfacePatch, return nullptr;);
 
+  /**
+   * Gets a conservative world space bounding sphere of this surface patch, used as a broad phase
+   * before the precise surface tests. Returns false if the patch has no finite bounds.
+   */
+  virtual bool GetWorldBoundingSphere(FSphere& OutSphere) const
+  {
+    return false;
+  }
+
   static bool EnsureSurfacePatchValid(
       const TScriptInterface<IIsdkISurfacePatch>& SurfacePatch,
       UObject* OnObject,
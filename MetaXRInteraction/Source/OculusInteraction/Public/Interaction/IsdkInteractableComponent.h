@@ -38,6 +38,8 @@ class IInteractable;
 class PointerEventQueue;
 } // namespace isdk::api
 
+struct FIsdkInteractionPointerEvent;
+
 /**
  * @class UIsdkInteractableComponent
  * @brief Abstract base class for interactables tracked by the API
@@ -165,6 +167,51 @@ class OCULUSINTERACTION_API UIsdkInteractableComponent : public USceneComponent,
     return !ContainerOut.IsEmpty();
   };
 
+  /**
+   * @brief When set, the world subsystem disables the API instance of this interactable while no
+   * interactor is near enough to interact with it, so that it is skipped by the per interactor
+   * surface tests. Intended for panels made of many interactables. A culled interactable reports
+   * the Disabled state.
+   */
+  UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = InteractionSDK)
+  bool bAllowBroadPhaseCulling = false;
+
+  /**
+   * @brief Gets the world space sphere an interactor must reach before it can interact with this
+   * interactable. Returns false if this interactable has no finite bounds, and can not be culled.
+   */
+  virtual bool GetBroadPhaseBoundingSphere(FSphere& OutSphere) const
+  {
+    return false;
+  }
+
+  /**
+   * @brief Gets the class of the interactors that interact with this interactable, and so are
+   * considered by the broad phase. Returns nullptr if this interactable can not be culled.
+   */
+  virtual UClass* GetBroadPhaseInteractorClass() const
+  {
+    return nullptr;
+  }
+
+  /**
+   * @brief Sets whether this interactable was culled by the broad phase, enabling or disabling the
+   * API instance accordingly. Called by the world subsystem.
+   */
+  void SetBroadPhaseCulled(bool bInBroadPhaseCulled);
+
+  /* Returns whether this interactable is currently culled by the broad phase */
+  bool IsBroadPhaseCulled() const
+  {
+    return bBroadPhaseCulled;
+  }
+
+  /**
+   * @brief Debug draws a pointer event this interactable raised. Called by the world subsystem
+   * from its batched pointer event dispatch, while interaction debug visuals are enabled.
+   */
+  virtual void DrawPointerEventDebug(const FIsdkInteractionPointerEvent& PointerEvent) {}
+
  protected:
   /**
    * @brief Called when the visibility of this component has changed, calls
@@ -180,7 +227,7 @@ class OCULUSINTERACTION_API UIsdkInteractableComponent : public USceneComponent,
 
   /**
    * @brief Determines if the instance of this interactable should be enabled within the API,
-   * determined by if it is active and visible.
+   * determined by if it is active, visible and not culled by the broad phase.
    * @return bool Whether or not the instance of this interactable should be enabled in the API
    */
   virtual bool ShouldApiInstanceBeEnabled() const;
@@ -199,6 +246,7 @@ class OCULUSINTERACTION_API UIsdkInteractableComponent : public USceneComponent,
   UPROPERTY(BlueprintReadOnly, BlueprintGetter = GetCurrentState, Category = InteractionSDK)
   EIsdkInteractableState CurrentState = EIsdkInteractableState::Disabled;
   int64 InteractableStateEventToken{};
+  bool bBroadPhaseCulled = false;
 
   /* Delegate broadcast when the interactable state changes */
   UPROPERTY(BlueprintAssignable, Category = InteractionSDK)
@@ -45,6 +45,17 @@ class FInteractorActiveStateImpl;
 } // namespace helper
 } // namespace isdk::api
 
+/**
+ * World space segment that an interactor can reach this frame, padded by Radius. Used by the
+ * world subsystem to cull interactables that no interactor is near.
+ */
+struct FIsdkInteractorBroadPhaseProbe
+{
+  FVector Start = FVector::ZeroVector;
+  FVector End = FVector::ZeroVector;
+  double Radius = 0.0;
+};
+
 /**
  * @class UIsdkInteractorComponent
  * @brief Abstract base class for interactors tracked by the API
@@ -195,6 +206,16 @@ class OCULUSINTERACTION_API UIsdkInteractorComponent : public USceneComponent,
    */
   bool HasInteractable() const;
 
+  /**
+   * @brief Gets the region this interactor can reach this frame, used to cull distant
+   * interactables. Returns false if the reach of this interactor is unknown, in which case none of
+   * the interactables it interacts with are culled.
+   */
+  virtual bool GetBroadPhaseProbe(FIsdkInteractorBroadPhaseProbe& OutProbe) const
+  {
+    return false;
+  }
+
   // GameplayTags used for labeling and driving interaction behavior. Returned by
   // IIsdkIGameplayTagContainer::GetGameplayTagContainer().
   UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = InteractionSDK)
@@ -125,6 +125,9 @@ class OCULUSINTERACTION_API UIsdkPokeInteractable : public UIsdkInteractableComp
   virtual isdk::api::IInteractable* GetApiIInteractable() const override;
   isdk::api::PokeInteractable* GetApiPokeInteractable() const;
 
+  virtual bool GetBroadPhaseBoundingSphere(FSphere& OutSphere) const override;
+  virtual UClass* GetBroadPhaseInteractorClass() const override;
+
   /* Returns a struct containing normal and tangent offsets */
   UFUNCTION(BlueprintGetter, Category = InteractionSDK)
   const FIsdkPokeInteractableConfigOffsets& GetConfigOffsets() const;
@@ -166,6 +169,8 @@ class OCULUSINTERACTION_API UIsdkPokeInteractable : public UIsdkInteractableComp
     return InteractorPointerEvent;
   }
 
+  virtual void DrawPointerEventDebug(const FIsdkInteractionPointerEvent& PointerEvent) override;
+
  private:
   void ApplyConfigToInstance() const;
 
@@ -196,7 +201,4 @@ class OCULUSINTERACTION_API UIsdkPokeInteractable : public UIsdkInteractableComp
 
   TPimplPtr<isdk::api::helper::FPokeInteractableImpl> PokeInteractableImpl{};
   int64 PointerEventToken{};
-
-  UFUNCTION()
-  void HandlePointerEvent(const FIsdkInteractionPointerEvent& PointerEvent);
 };
@@ -117,6 +117,8 @@ class OCULUSINTERACTION_API UIsdkPokeInteractor : public UIsdkInteractorComponen
   UFUNCTION(BlueprintSetter, Category = InteractionSDK)
   void SetConfig(const FIsdkPokeInteractor_Config& InConfig);
 
+  virtual bool GetBroadPhaseProbe(FIsdkInteractorBroadPhaseProbe& OutProbe) const override;
+
  protected:
   /**
    * @brief When true, disables debug visuals from being drawn, regardless of console variables
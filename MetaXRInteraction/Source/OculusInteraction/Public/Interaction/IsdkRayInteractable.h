@@ -66,6 +66,9 @@ class OCULUSINTERACTION_API UIsdkRayInteractable : public UIsdkInteractableCompo
   virtual isdk::api::IInteractable* GetApiIInteractable() const override;
   isdk::api::RayInteractable* GetApiRayInteractable() const;
 
+  virtual bool GetBroadPhaseBoundingSphere(FSphere& OutSphere) const override;
+  virtual UClass* GetBroadPhaseInteractorClass() const override;
+
   /* Returns the surface implementing IIsdkISurface that this Interactable is associated with */
   UFUNCTION(BlueprintGetter, Category = InteractionSDK)
   TScriptInterface<IIsdkISurface> GetSurface() const
@@ -96,6 +99,8 @@ class OCULUSINTERACTION_API UIsdkRayInteractable : public UIsdkInteractableCompo
     return InteractorPointerEvent;
   }
 
+  virtual void DrawPointerEventDebug(const FIsdkInteractionPointerEvent& PointerEvent) override;
+
  private:
   // Event for PointerEvents
   UPROPERTY(BlueprintAssignable, Category = InteractionSDK)
@@ -113,7 +118,4 @@ class OCULUSINTERACTION_API UIsdkRayInteractable : public UIsdkInteractableCompo
   // Internal Impl
   TPimplPtr<isdk::api::helper::FRayInteractableImpl> RayInteractableImpl;
   int64 PointerEventToken{};
-
-  UFUNCTION()
-  void HandlePointerEvent(const FIsdkInteractionPointerEvent& PointerEvent);
 };
@@ -106,6 +106,8 @@ class OCULUSINTERACTION_API UIsdkRayInteractor : public UIsdkInteractorComponent
    */
   void SetSelectStrength(float InSelectStrength);
 
+  virtual bool GetBroadPhaseProbe(FIsdkInteractorBroadPhaseProbe& OutProbe) const override;
+
   /* Returns the object implementing IIsdkIHandPointerPose that is the current pose used for
    * tracking the hand pointer pose */
   UFUNCTION(BlueprintGetter, Category = InteractionSDK)
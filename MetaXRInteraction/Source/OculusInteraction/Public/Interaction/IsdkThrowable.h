@@ -100,6 +100,7 @@ class OCULUSINTERACTION_API UIsdkThrowable : public USceneComponent
   GENERATED_BODY()
 
   friend class FIsdkThrowableTest;
+  friend class FIsdkThrowableRingBufferTest;
 
  public:
   UIsdkThrowable();
@@ -155,10 +156,70 @@ class OCULUSINTERACTION_API UIsdkThrowable : public USceneComponent
   const int32 Ransac_Iterations = 50;
   const float Ransac_Score_Threshold = 0.01f;
 
-  // Arrays to store the last tracked object positions and rotations
+  /* Running sums over the tracked positions, relative to a sample origin to keep precision. They
+   * are updated as samples enter and leave the ring buffer, so least squares and the outlier
+   * statistics don't need a pass over the history on release */
+  struct FRunningPositionSums
+  {
+    double SumTime = 0.0;
+    double SumTimeSquared = 0.0;
+    FVector SumPosition = FVector::ZeroVector;
+    FVector SumPositionSquared = FVector::ZeroVector;
+    FVector SumTimePosition = FVector::ZeroVector;
+    int32 Num = 0;
+
+    void Add(const FVector& Position, double Time, double Sign = 1.0)
+    {
+      SumTime += Sign * Time;
+      SumTimeSquared += Sign * Time * Time;
+      SumPosition += Sign * Position;
+      SumPositionSquared += Sign * Position * Position;
+      SumTimePosition += Sign * Time * Position;
+      Num += Sign > 0.0 ? 1 : -1;
+    }
+    void Remove(const FVector& Position, double Time)
+    {
+      Add(Position, Time, -1.0);
+    }
+    FVector GetLeastSquaresVelocity() const;
+  };
+
+  void ResetSamples(int32 Capacity);
+  void AddPositionSample(const FVector& Position, float Time);
+  void AddRotationSample(const FQuat& Rotation, float Time);
+  void RebuildRunningSums();
+  bool IsPositionOutlier(
+      const FVector& Position,
+      const FVector& Mean,
+      const FVector& StandardDeviation) const;
+
+  /* Sample I in chronological order (0 is the oldest) */
+  const TPair<FVector, float>& GetPositionSample(int32 I) const
+  {
+    return LastNPositions
+        [(CurrentPositionIndex - NumPositionSamples + I + LastNPositions.Num()) %
+         LastNPositions.Num()];
+  }
+  const TPair<FQuat, float>& GetRotationSample(int32 I) const
+  {
+    return LastNRotations
+        [(CurrentRotationIndex - NumRotationSamples + I + LastNRotations.Num()) %
+         LastNRotations.Num()];
+  }
+
+  // Fixed capacity ring buffers of the last tracked object positions and rotations. The next
+  // sample is written at the current index, overwriting the oldest one once the buffer is full
   TArray<TPair<FVector, float>> LastNPositions;
   TArray<TPair<FQuat, float>> LastNRotations;
-  void GetLastNPositions(int32 N, TArray<TPair<FVector, float>>& OutPositions) const;
+  int32 NumPositionSamples = 0;
+  int32 NumRotationSamples = 0;
+
+  FRunningPositionSums RunningSums;
+  FVector SampleOriginPosition = FVector::ZeroVector;
+  double SampleOriginTime = 0.0;
+
+  // Preallocated scratch space for the estimators that need the filtered samples
+  mutable TArray<TPair<FVector, float>> ScratchPositions;
 
   int32 CurrentPositionIndex = 0;
   int32 PreviousPositionIndex = 0;
@@ -46,4 +46,13 @@ class OCULUSINTERACTION_API IIsdkISurface
       PURE_VIRTUAL(IIsdkISurface::IsApiInstanceValid, return false;);
   virtual isdk::api::ISurface* GetApiISurface()
       PURE_VIRTUAL(IIsdkISurface::GetApiISurface, return nullptr;);
+
+  /**
+   * Gets a conservative world space bounding sphere of this surface, used as a broad phase before
+   * the precise surface tests. Returns false if the surface has no finite bounds.
+   */
+  virtual bool GetWorldBoundingSphere(FSphere& OutSphere) const
+  {
+    return false;
+  }
 };
@@ -72,6 +72,7 @@ class OCULUSINTERACTION_API UIsdkPointableBox : public USceneComponent,
   // IIsdkISurface Implementation
   virtual bool IsApiInstanceValid() const override;
   virtual isdk::api::ISurface* GetApiISurface() override;
+  virtual bool GetWorldBoundingSphere(FSphere& OutSphere) const override;
 
   // Getter
   UFUNCTION(BlueprintPure, BlueprintInternalUseOnly, Category = InteractionSDK)
@@ -92,5 +93,9 @@ class OCULUSINTERACTION_API UIsdkPointableBox : public USceneComponent,
   UPROPERTY(BlueprintGetter = GetSize, BlueprintSetter = SetSize, Category = InteractionSDK)
   FVector Size;
 
+  // World space bounds, rebuilt lazily after the transform or size changes
+  mutable FSphere CachedWorldBoundingSphere{ForceInit};
+  mutable bool bWorldBoundingSphereDirty = true;
+
   TPimplPtr<isdk::api::helper::FPointableOrientedBoxImpl> PointableBoxImpl;
 };
@@ -79,6 +79,7 @@ class OCULUSINTERACTION_API UIsdkPointablePlane : public USceneComponent,
   // IIsdkISurface Implementation
   virtual bool IsApiInstanceValid() const override;
   virtual isdk::api::ISurface* GetApiISurface() override;
+  virtual bool GetWorldBoundingSphere(FSphere& OutSphere) const override;
 
   /**
    * Gets the size of the plane, which defines its two-dimensional extent
@@ -100,5 +101,9 @@ class OCULUSINTERACTION_API UIsdkPointablePlane : public USceneComponent,
   UPROPERTY(BlueprintGetter = GetSize, BlueprintSetter = SetSize, Category = InteractionSDK)
   FVector2D Size;
 
+  // World space bounds, rebuilt lazily after the transform or size changes
+  mutable FSphere CachedWorldBoundingSphere{ForceInit};
+  mutable bool bWorldBoundingSphereDirty = true;
+
   TPimplPtr<isdk::api::helper::FPointablePlaneImpl> PointablePlaneImpl;
 };
@@ -211,6 +211,14 @@ class OCULUSINTERACTION_API UIsdkHandMeshComponent : public UPoseableMeshCompone
  private:
   int MappedBoneIndices[MappedBoneCount];
 
+  // Per skeleton bone: parent bone index and whether the bone is driven by hand data
+  TArray<int32> BoneParentIndices;
+  TBitArray<> MappedBoneMask;
+
+  // Scratch component space pose, valid between UpdateSkeleton and the end of TickComponent
+  mutable TArray<FTransform> ComponentSpaceBoneTransforms;
+  mutable bool bComponentSpaceBoneTransformsValid = false;
+
   UPROPERTY(
       VisibleAnywhere,
       Transient,
@@ -254,6 +262,18 @@ class OCULUSINTERACTION_API UIsdkHandMeshComponent : public UPoseableMeshCompone
 
   UObject* GetSkeletalMesh() const;
 
+  // Caches the parent index of every bone and which bones are driven by hand data, so the skeleton
+  // can be updated in a single pass over the hierarchy
+  bool CacheSkeletonHierarchy();
+
+  // Returns component space transforms of all bones, computed from BoneSpaceTransforms in one pass.
+  // Reuses the result of UpdateSkeleton while inside TickComponent.
+  const TArray<FTransform>& GetComponentSpaceBoneTransforms() const;
+
+  // Writes ComponentSpaceBoneTransforms of the mapped bones back to BoneSpaceTransforms, keeping the
+  // local transforms of all other bones
+  void ApplyComponentSpaceBoneTransforms();
+
   void InitializeSkeleton();
   void UpdateMappingState();
   void UpdateSkeleton();
@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * Licensed under the Oculus SDK License Agreement (the "License");
+ * you may not use the Oculus SDK except in compliance with the License,
+ * which is provided at the time of installation or download, or which
+ * otherwise accompanies this software in either electronic or hard copy form.
+ *
+ * You may obtain a copy of the License at
+ *
+ * https://developer.oculus.com/licenses/oculussdk/
+ *
+ * Unless required by applicable law or agreed to in writing, the Oculus SDK
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/World.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "IsdkGrabbableSubsystem.generated.h"
+
+class UIsdkGrabbableComponent;
+class UPrimitiveComponent;
+
+/**
+ * A grabbable returned by a UIsdkGrabbableSubsystem query. Distance is measured from the query
+ * origin to the grabbable's bounds.
+ */
+struct FIsdkGrabbableQueryHit
+{
+  UIsdkGrabbableComponent* Grabbable = nullptr;
+  UPrimitiveComponent* Collider = nullptr;
+  FBoxSphereBounds Bounds;
+  float Distance = 0.f;
+};
+
+/**
+ * Registry of all grabbables that have begun play in a world. Keeps a direct lookup from grab
+ * collider to grabbable, and a bounding volume hierarchy over the grab colliders' bounds which is
+ * rebuilt once per frame on first query. Grab detectors use it to find candidates with a cone or ray
+ * query instead of maintaining physics overlaps against every grabbable in the scene.
+ */
+UCLASS()
+class OCULUSINTERACTION_API UIsdkGrabbableSubsystem : public UWorldSubsystem
+{
+  GENERATED_BODY()
+
+ public:
+  virtual void Deinitialize() override;
+
+  /**
+   * Static helper function to try and get the grabbable registry from a world. Returns nullptr if
+   * the world has none.
+   */
+  static UIsdkGrabbableSubsystem* TryGet(const UWorld* InWorld)
+  {
+    return IsValid(InWorld) ? InWorld->GetSubsystem<UIsdkGrabbableSubsystem>() : nullptr;
+  }
+
+  void RegisterGrabbable(UIsdkGrabbableComponent* Grabbable);
+  void UnregisterGrabbable(UIsdkGrabbableComponent* Grabbable);
+
+  /* Re-reads the grab collider of an already registered grabbable */
+  void UpdateGrabCollider(UIsdkGrabbableComponent* Grabbable);
+
+  /* Returns the grabbable using Collider as its grab collider, or nullptr */
+  UIsdkGrabbableComponent* FindGrabbableByCollider(const UPrimitiveComponent* Collider) const;
+
+  /**
+   * Appends every grabbable whose bounding sphere intersects the cone, in no particular order.
+   * @param Apex origin of the cone
+   * @param Direction normalized axis of the cone
+   * @param Length distance from the apex at which the cone ends
+   * @param HalfAngleRadians half of the apex angle
+   */
+  void QueryCone(
+      const FVector& Apex,
+      const FVector& Direction,
+      float Length,
+      float HalfAngleRadians,
+      TArray<FIsdkGrabbableQueryHit>& OutHits);
+
+  /**
+   * Appends every grabbable whose bounding box is crossed by the segment, sorted by the distance
+   * at which the segment enters the box.
+   */
+  void QueryRay(const FVector& Start, const FVector& End, TArray<FIsdkGrabbableQueryHit>& OutHits);
+
+  int32 GetNumGrabbables() const
+  {
+    return Entries.Num();
+  }
+
+ private:
+  struct FEntry
+  {
+    TObjectKey<UIsdkGrabbableComponent> Key;
+    TWeakObjectPtr<UIsdkGrabbableComponent> Grabbable;
+    TWeakObjectPtr<UPrimitiveComponent> Collider;
+    FBoxSphereBounds Bounds;
+  };
+
+  struct FNode
+  {
+    FBox Box;
+    FSphere Sphere;
+    // Leaves reference Count entries of LeafEntries starting at First. Inner nodes have Count 0,
+    // their left child directly follows them and First is the index of the right child.
+    int32 First = 0;
+    int32 Count = 0;
+  };
+
+  void RefreshIfNeeded();
+  int32 BuildNode(int32 Begin, int32 End);
+  void RemoveEntryAt(int32 EntryIndex);
+  bool ResolveHit(int32 EntryIndex, float Distance, FIsdkGrabbableQueryHit& OutHit) const;
+
+  TArray<FEntry> Entries;
+  TMap<TObjectKey<UIsdkGrabbableComponent>, int32> EntryIndexByGrabbable;
+  TMap<TObjectKey<UPrimitiveComponent>, TWeakObjectPtr<UIsdkGrabbableComponent>>
+      GrabbableByCollider;
+
+  TArray<FNode> Nodes;
+  TArray<int32> LeafEntries;
+  TArray<int32> NodeStack;
+  uint64 LastRefreshFrame = MAX_uint64;
+  bool bStructureDirty = true;
+};
@@ -28,6 +28,7 @@
 #include "Materials/Material.h"
 #include "Engine/SkinnedAsset.h"
 #include "Engine/SkeletalMesh.h"
+#include "UObject/ObjectKey.h"
 #include "IsdkHandData.h"
 #include "IsdkHandPoseData.h"
 #include "Interaction/IsdkIInteractorState.h"
@@ -67,6 +68,48 @@ struct FIsdkHandPoseDataCache
   TArray<FName> CachedPoseNames;
 };
 
+// Precomputed lookup features of one pose variation, in the space of the owning actor
+struct FIsdkHandPoseIndexEntry
+{
+  FVector Location = FVector::ZeroVector;
+  FQuat Rotation = FQuat::Identity;
+  uint32 VariationIdx = 0;
+};
+
+/**
+ * Spatial index over the pose variations of one actor instance, one k-d tree per handedness.
+ * Each tree is stored implicitly: the node of a range is its median entry, split along
+ * (depth % 3). Queries are branch and bound on the location delta, so the rotation delta is only
+ * evaluated for variations that can still win.
+ */
+struct OCULUSINTERACTION_API FIsdkHandPoseVariationIndex
+{
+  static constexpr int32 NumHandedness = 2;
+
+  void Build(const TSet<uint32>& Variations, const FIsdkHandPoseDataCache& PoseDataCache);
+
+  /* Finds the variation minimizing squared location delta + rotation delta (in degrees) for a hand
+   * pose given in actor space. Returns INDEX_NONE if no variation supports the handedness */
+  int32 FindBestVariation(
+      EIsdkHandedness Handedness,
+      const FVector& LocalHandLocation,
+      const FQuat& LocalHandRotation) const;
+
+  bool bDirty = true;
+
+ private:
+  static void BuildNode(TArrayView<FIsdkHandPoseIndexEntry> Entries, int32 Depth);
+  static void FindBestInNode(
+      TConstArrayView<FIsdkHandPoseIndexEntry> Entries,
+      int32 Depth,
+      const FVector& LocalHandLocation,
+      const FQuat& LocalHandRotation,
+      float& InOutBestDelta,
+      int32& InOutBestVariation);
+
+  TArray<FIsdkHandPoseIndexEntry> Trees[NumHandedness];
+};
+
 USTRUCT()
 struct FIsdkHandPoseDataActorVariations
 {
@@ -75,6 +118,9 @@ struct FIsdkHandPoseDataActorVariations
   // Each entry is one index in the FIsdkHandPoseDataCache that is associated with this Actor
   UPROPERTY()
   TSet<uint32> Variations;
+
+  // Lookup structure over Variations, rebuilt lazily whenever Variations changes
+  FIsdkHandPoseVariationIndex Index;
 };
 
 USTRUCT()
@@ -189,6 +235,12 @@ class OCULUSINTERACTION_API UIsdkHandPoseSubsystem : public UTickableWorldSubsys
  private:
   FName GetActorClassNameFromComponent(USceneComponent* ComponentIn);
 
+  /* Marks the pose index of an actor instance for rebuild on its next lookup */
+  void MarkVariationsDirty(FName OuterActorName, AActor* ActorIn);
+
+  /* Destroys the components queued by RegisterHandPoseData */
+  void FlushHandGrabPoseDestroyQueue();
+
   /* Adds a new variation with the given properties to the ActorCacheMap. Returns the new variation
    * index or -1 if there was an issue */
   uint32 AddNewVariationToActorCacheMap(
@@ -221,5 +273,11 @@ class OCULUSINTERACTION_API UIsdkHandPoseSubsystem : public UTickableWorldSubsys
   UPROPERTY()
   TArray<TObjectPtr<USceneComponent>> HandGrabPoseDestroyQueue;
 
+  // Read position into HandGrabPoseDestroyQueue; entries before it have been destroyed already
+  int32 HandGrabPoseDestroyQueueHead = 0;
+
+  // Package names of actor classes, so lookups don't rebuild the class path every time
+  TMap<TObjectKey<UClass>, FName> ActorClassNameCache;
+
   int LastHandPoseMirroredSuffix = 1;
 };
@@ -23,6 +23,7 @@
 #include "CoreMinimal.h"
 #include "Engine/World.h"
 #include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
 #include "Widget/IsdkWidget.h"
 #include "IsdkWidgetSubsystem.generated.h"
 
@@ -87,6 +88,10 @@ class OCULUSINTERACTION_API UIsdkWidgetSubsystem : public UIsdkWidgetSubsystemBa
   UFUNCTION(BlueprintCallable, Category = InteractionSDK)
   const FIsdkVirtualUserInfo& GetVirtualUserInfo(UObject* Interactor);
 
+  /**
+   * Returns the Slate virtual user state bound to the event's interactor, binding a new one if
+   * there is none yet. The returned pointer is only valid until the next state is created.
+   */
   FIsdkWidgetVirtualUserState* FindOrCreateInteractorVirtualUserState(
       const FIsdkVirtualUserPointerEvent& PointerEvent);
   void DestroyInteractorVirtualUserState(UObject* Interactor);
@@ -103,7 +108,7 @@ class OCULUSINTERACTION_API UIsdkWidgetSubsystem : public UIsdkWidgetSubsystemBa
 #pragma endregion Debug Drawing
 
  private:
-  TArray<FIsdkWidgetVirtualUserState> VirtualUserIndexInteractors;
+  TMap<TObjectKey<UObject>, FIsdkWidgetVirtualUserState> VirtualUserIndexInteractors;
   TMap<UObject*, FIsdkVirtualUserInfo>
       VirtualUserInfoMap; // TODO: turn this into a ticketed collection
 };
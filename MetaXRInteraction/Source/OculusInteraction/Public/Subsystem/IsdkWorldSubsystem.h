@@ -26,6 +26,7 @@
 #include "CoreMinimal.h"
 #include "Engine/World.h"
 #include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
 #include "Interaction/IsdkIInteractorState.h"
 #include "Interaction/IsdkIInteractableState.h"
 #include "Interaction/IsdkInteractionEvents.h"
@@ -57,9 +58,34 @@ typedef struct isdk_IPayload_ isdk_IPayload;
 typedef struct isdk_IInteractable_ isdk_IInteractable;
 
 class UIsdkInteractorComponent;
+class USceneComponent;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FIsdkWorldFrameEventDelegate);
 
+// Native listeners receiving every event of one type that was dispatched during a frame
+DECLARE_MULTICAST_DELEGATE_OneParam(
+    FIsdkPointerEventBatchDelegate,
+    TConstArrayView<FIsdkInteractionPointerEvent>);
+DECLARE_MULTICAST_DELEGATE_OneParam(
+    FIsdkInteractorStateEventBatchDelegate,
+    TConstArrayView<FIsdkInteractorStateEvent>);
+DECLARE_MULTICAST_DELEGATE_OneParam(
+    FIsdkInteractableStateEventBatchDelegate,
+    TConstArrayView<FIsdkInteractableStateEvent>);
+
+/**
+ * Wall clock time spent in the stages of the last UIsdkWorldSubsystem frame, in seconds
+ */
+struct FIsdkWorldFrameTimings
+{
+  // Native interactors driving inside the IUpdate event
+  double InteractorUpdateSeconds = 0.0;
+  // Pointer and state events forwarded to their delegates
+  double EventDispatchSeconds = 0.0;
+  // Queued transforms being applied to their targets
+  double TransformCommitSeconds = 0.0;
+};
+
 /**
  *
  */
@@ -91,6 +117,11 @@ class OCULUSINTERACTION_API UIsdkWorldSubsystem : public UTickableWorldSubsystem
 
   isdk::api::ScaledTimeProvider* GetApiScaledTimeProvider() const;
 
+  const FIsdkWorldFrameTimings& GetLastFrameTimings() const
+  {
+    return LastFrameTimings;
+  }
+
   FIsdkWorldFrameEventDelegate& GetFrameStartingEventDelegate()
   {
     return FrameStartingEventDelegate;
@@ -100,6 +131,24 @@ class OCULUSINTERACTION_API UIsdkWorldSubsystem : public UTickableWorldSubsystem
     return FrameFinishedEventDelegate;
   }
 
+  /**
+   * Native listeners bound to these are invoked once per tick with all events of their type,
+   * grouped by the target that raised them. The per-target delegates passed to the Register*
+   * functions below still receive their events one at a time.
+   */
+  FIsdkPointerEventBatchDelegate& GetPointerEventBatchDelegate()
+  {
+    return PointerEventBatchDelegate;
+  }
+  FIsdkInteractorStateEventBatchDelegate& GetInteractorStateEventBatchDelegate()
+  {
+    return InteractorStateEventBatchDelegate;
+  }
+  FIsdkInteractableStateEventBatchDelegate& GetInteractableStateEventBatchDelegate()
+  {
+    return InteractableStateEventBatchDelegate;
+  }
+
   /**
    * Static helper function to try and get an Interaction SDK subsystem from a world.
    * Will return false if the subsystem does not exist on the given world. Use this in code
@@ -171,6 +220,38 @@ class OCULUSINTERACTION_API UIsdkWorldSubsystem : public UTickableWorldSubsystem
       const FIsdkIUpdateEventDelegate& UpdateEventDelegate);
   void UnregisterUpdateEventHandler(EventHandlerToken Token);
 
+  /**
+   * Queues a relative transform for Target. Queued transforms are applied together once this
+   * frame's interaction events have been dispatched, so a target moved by several grabs, throws
+   * or snaps in one frame only updates its hierarchy once. A later request for the same target
+   * replaces the earlier transform, but every OnCommitted queued for it is still executed once
+   * the final transform has been applied.
+   *
+   * Events are dispatched from this subsystem's tick, which runs after the physics tick groups,
+   * so physics sees a committed kinematic target on its next step, exactly as it would with an
+   * immediate SetRelativeTransform from an event handler.
+   */
+  void QueueTransformCommit(
+      USceneComponent* Target,
+      const FTransform& RelativeTransform,
+      FSimpleDelegate OnCommitted = {});
+
+  /**
+   * Returns the relative transform queued for Target, or nullptr if there is none
+   */
+  const FTransform* FindPendingTransformCommit(const USceneComponent* Target) const;
+
+  /**
+   * Drops the transform queued for Target without applying it
+   */
+  void DiscardPendingTransformCommit(const USceneComponent* Target);
+
+  /**
+   * Applies all queued transforms, parents before their children, then updates the world
+   * transform of each moved hierarchy once from its topmost queued component
+   */
+  void CommitPendingTransforms();
+
   UIsdkInteractorComponent* LookupInteractorFromPayload(const isdk_IPayload* InPayload)
   {
     return LookupInteractorFromPayload(this, InPayload);
@@ -194,6 +275,15 @@ class OCULUSINTERACTION_API UIsdkWorldSubsystem : public UTickableWorldSubsystem
   UPROPERTY(BlueprintAssignable, Category = InteractionSDK)
   FIsdkWorldFrameEventDelegate FrameFinishedEventDelegate;
 
+  FIsdkPointerEventBatchDelegate PointerEventBatchDelegate;
+  FIsdkInteractorStateEventBatchDelegate InteractorStateEventBatchDelegate;
+  FIsdkInteractableStateEventBatchDelegate InteractableStateEventBatchDelegate;
+
+  // Reused between ticks, so batched dispatch does not allocate once they have grown
+  TArray<FIsdkInteractionPointerEvent> PointerEventBatch;
+  TArray<FIsdkInteractorStateEvent> InteractorStateEventBatch;
+  TArray<FIsdkInteractableStateEvent> InteractableStateEventBatch;
+
   template <class TQueueImpl, typename TToken = EventHandlerToken>
   class EventQueueWrapper
   {
@@ -260,6 +350,30 @@ class OCULUSINTERACTION_API UIsdkWorldSubsystem : public UTickableWorldSubsystem
       }
     }
 
+    /**
+     * Drains every subscription into Batch and hands it to the native BatchDelegate in one call.
+     * Falls back to per-event dispatch when there are no native listeners.
+     */
+    template <typename TEvent, typename TBatchDelegate>
+    void TryHandleEventsBatched(TArray<TEvent>& Batch, const TBatchDelegate& BatchDelegate)
+    {
+      if (!BatchDelegate.IsBound())
+      {
+        TryHandleEvents();
+        return;
+      }
+
+      Batch.Reset();
+      for (const auto& Element : EventSubscriptions)
+      {
+        Element.Value->HandleEvents(&Batch);
+      }
+      if (Batch.Num() > 0)
+      {
+        BatchDelegate.Broadcast(Batch);
+      }
+    }
+
     void Reset()
     {
       PendingCreate.Empty();
@@ -305,6 +419,37 @@ class OCULUSINTERACTION_API UIsdkWorldSubsystem : public UTickableWorldSubsystem
   UPROPERTY()
   TArray<UIsdkInteractableComponent*> RegisteredInteractables{};
 
+  struct FPendingTransformCommit
+  {
+    TWeakObjectPtr<USceneComponent> Target;
+    TObjectKey<USceneComponent> TargetKey;
+    FTransform RelativeTransform;
+    TArray<FSimpleDelegate, TInlineAllocator<1>> OnCommitted;
+    int32 AttachDepth = 0;
+  };
+
+  // Transforms queued this frame, and an index into them by target
+  TArray<FPendingTransformCommit> PendingTransformCommits{};
+  TMap<TObjectKey<USceneComponent>, int32> PendingTransformCommitLookup{};
+
+  // Swapped with PendingTransformCommits while committing, keeps both allocations alive
+  TArray<FPendingTransformCommit> CommittingTransforms{};
+
+  // Scratch space for finding the topmost moved component of each hierarchy while committing
+  TSet<const USceneComponent*> CommittingTargets{};
+  TArray<USceneComponent*> CommittingRoots{};
+
+  FIsdkWorldFrameTimings LastFrameTimings{};
+
+  // Culls interactables that allow it while no interactor of theirs can reach them
+  void UpdateSurfaceBroadPhase();
+
+  FDelegateHandle WorldPostActorTickHandle;
+  void OnWorldPostActorTick(UWorld* InWorld, ELevelTick InTickType, float InDeltaSeconds);
+
+  // Pointer event batch listener, debug draws the events on the interactables that raised them
+  void DrawPointerEventsDebug(TConstArrayView<FIsdkInteractionPointerEvent> Events) const;
+
   static UIsdkInteractorComponent* LookupInteractorFromPayload(
       TWeakObjectPtr<UIsdkWorldSubsystem> InThis,
       const isdk_IPayload* InPayload);
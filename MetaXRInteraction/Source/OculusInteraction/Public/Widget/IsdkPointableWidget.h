@@ -40,6 +40,12 @@ class OCULUSINTERACTION_API UIsdkPointableWidget : public UActorComponent
  public:
   UIsdkPointableWidget();
 
+  virtual void TickComponent(
+      float DeltaTime,
+      ELevelTick TickType,
+      FActorComponentTickFunction* ThisTickFunction) override;
+  virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
   UPROPERTY(Transient, BlueprintReadWrite, Category = "InteractionSDK")
   TObjectPtr<UWidgetComponent> AttachedWidget;
 
@@ -56,7 +62,36 @@ class OCULUSINTERACTION_API UIsdkPointableWidget : public UActorComponent
   UPROPERTY(BlueprintReadWrite, Category = InteractionSDK, EditAnywhere)
   bool bStopBroadcastOnDrag = true;
 
+  /**
+   * If true, Hover and Move events are held until the end of the frame and only the latest Move of
+   * each interactor is routed to Slate. Any other event first flushes its interactor's held events,
+   * so Select/Unselect ordering is preserved.
+   */
+  UPROPERTY(BlueprintReadWrite, Category = InteractionSDK, EditAnywhere)
+  bool bCoalesceMoveEvents = true;
+
+  /**
+   * Routes all held Hover and Move events to Slate.
+   */
+  UFUNCTION(BlueprintCallable, Category = InteractionSDK)
+  void FlushPendingPointerEvents();
+
  private:
   UFUNCTION()
   void HandleInteractionPointerEvent(const FIsdkInteractionPointerEvent& PointerEvent);
+
+  void RouteVirtualUserPointerEvent(const FIsdkVirtualUserPointerEvent& VirtualUserPointerEvent);
+  void FlushPendingPointerEventsFor(const UObject* Interactor);
+
+  // Hover and Move events held back for one interactor this frame
+  struct FPendingPointerEvents
+  {
+    FIsdkVirtualUserPointerEvent Hover;
+    FIsdkVirtualUserPointerEvent Move;
+    bool bHasHover = false;
+    bool bHasMove = false;
+  };
+  void RoutePendingPointerEvents(const FPendingPointerEvents& Pending);
+
+  TArray<FPendingPointerEvents, TInlineAllocator<4>> PendingPointerEvents;
 };
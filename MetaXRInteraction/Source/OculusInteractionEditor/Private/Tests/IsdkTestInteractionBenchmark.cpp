@@ -0,0 +1,534 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * Licensed under the Oculus SDK License Agreement (the "License");
+ * you may not use the Oculus SDK except in compliance with the License,
+ * which is provided at the time of installation or download, or which
+ * otherwise accompanies this software in either electronic or hard copy form.
+ *
+ * You may obtain a copy of the License at
+ *
+ * https://developer.oculus.com/licenses/oculussdk/
+ *
+ * Unless required by applicable law or agreed to in writing, the Oculus SDK
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "IsdkTestInteractionBenchmark.h"
+#include "IsdkTestGrabInteraction.h"
+#include "IsdkTestRayInteraction.h"
+#include "Tests/IsdkCommonTestCommands.h"
+#include "Subsystem/IsdkWidgetSubsystem.h"
+#include "Subsystem/IsdkWorldSubsystem.h"
+#include "Algo/Transform.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/CommandLine.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Tests/AutomationCommon.h"
+#include "Tests/AutomationEditorCommon.h"
+
+namespace isdk::test
+{
+// Spacing of the interactable grid and height of each row, in cm
+constexpr float BenchmarkGridSpacing = 40.0f;
+constexpr double BenchmarkWidgetRowZ = 100.0;
+constexpr double BenchmarkGrabRowZ = -100.0;
+constexpr double BenchmarkRayRowZ = 400.0;
+
+// Frames between scripted pinch grabs and releases
+constexpr int32 BenchmarkGrabTogglePeriod = 30;
+
+// Per frame budgets of each stage, averaged over the measured frames of a run. Wall time depends
+// on the machine running the benchmark, so every budget is off by default and is meant to be set
+// for a known device, e.g. from the [ConsoleVariables] section of the test machine's config.
+TAutoConsoleVariable<float> CVar_Isdk_Benchmark_BudgetDataSourceReadMs(
+    TEXT("Meta.InteractionSDK.Benchmark.BudgetDataSourceReadMs"),
+    0.0f,
+    TEXT("Average per frame budget of the benchmark DataSourceRead stage in ms, 0 to disable"));
+TAutoConsoleVariable<float> CVar_Isdk_Benchmark_BudgetInteractorTickMs(
+    TEXT("Meta.InteractionSDK.Benchmark.BudgetInteractorTickMs"),
+    0.0f,
+    TEXT("Average per frame budget of the benchmark InteractorTick stage in ms, 0 to disable"));
+TAutoConsoleVariable<float> CVar_Isdk_Benchmark_BudgetEventDispatchMs(
+    TEXT("Meta.InteractionSDK.Benchmark.BudgetEventDispatchMs"),
+    0.0f,
+    TEXT("Average per frame budget of the benchmark EventDispatch stage in ms, 0 to disable"));
+TAutoConsoleVariable<float> CVar_Isdk_Benchmark_BudgetTransformApplyMs(
+    TEXT("Meta.InteractionSDK.Benchmark.BudgetTransformApplyMs"),
+    0.0f,
+    TEXT("Average per frame budget of the benchmark TransformApply stage in ms, 0 to disable"));
+TAutoConsoleVariable<float> CVar_Isdk_Benchmark_BudgetWorldTickMs(
+    TEXT("Meta.InteractionSDK.Benchmark.BudgetWorldTickMs"),
+    0.0f,
+    TEXT("Average per frame budget of the whole benchmark world tick in ms, 0 to disable"));
+
+struct FInteractionBenchmarkState
+{
+  TArray<FInteractionBenchmarkConfig> Configs;
+  TArray<FInteractionBenchmarkResult> Results;
+
+  // One of each per synthetic hand
+  TArray<TWeakObjectPtr<AIsdkTestBenchmarkHandActor>> TrackedHands;
+  TArray<TWeakObjectPtr<AIsdkTestPokeInteractorActor>> PokeHands;
+  TArray<TWeakObjectPtr<AIsdkTestRayInteractorActor>> RayHands;
+  TArray<TWeakObjectPtr<AIsdkTestGrabInteractorActor>> GrabHands;
+  TArray<TWeakObjectPtr<AActor>> Interactables;
+
+  TWeakObjectPtr<UWorld> World;
+  FDelegateHandle WorldTickStartHandle;
+  FDelegateHandle WorldTickEndHandle;
+  double WorldTickStartTime = 0.0;
+  int32 Frame = 0;
+  bool bMeasuring = false;
+  bool bGrabbing = false;
+};
+
+static UWorld* GetBenchmarkWorld()
+{
+  return GEditor->GetPIEWorldContext()->World();
+}
+
+template <typename TActor>
+static TActor* SpawnBenchmarkActor(UWorld* World, const FVector& Location)
+{
+  // No getting the level dirty
+  FActorSpawnParameters ActorParameters{};
+  ActorParameters.bNoFail = true;
+  return World->SpawnActor<TActor>(
+      TActor::StaticClass(), Location, FRotator::ZeroRotator, ActorParameters);
+}
+
+static FInteractionBenchmarkResult& GetCurrentResult(FInteractionBenchmarkState& State)
+{
+  return State.Results.Last();
+}
+
+static void OnBenchmarkWorldTickStart(
+    UWorld* World,
+    ELevelTick TickType,
+    float DeltaSeconds,
+    TSharedRef<FInteractionBenchmarkState> State)
+{
+  if (World == State->World.Get())
+  {
+    State->WorldTickStartTime = FPlatformTime::Seconds();
+  }
+}
+
+static void OnBenchmarkWorldTickEnd(
+    UWorld* World,
+    ELevelTick TickType,
+    float DeltaSeconds,
+    TSharedRef<FInteractionBenchmarkState> State)
+{
+  if (World != State->World.Get() || !State->bMeasuring)
+  {
+    return;
+  }
+
+  // The world subsystem commits late transforms from OnWorldPostActorTick. Listening there as well
+  // would run this before the subsystem, since multicast delegates broadcast in reverse
+  // registration order, so the timings are read once the whole world tick has ended instead
+  const double WorldTickTime = FPlatformTime::Seconds() - State->WorldTickStartTime;
+  const FIsdkWorldFrameTimings& Timings = UIsdkWorldSubsystem::Get(World).GetLastFrameTimings();
+  FInteractionBenchmarkStageTimes& Times = GetCurrentResult(*State).Times;
+  Times.InteractorTick += Timings.InteractorUpdateSeconds;
+  Times.EventDispatch += Timings.EventDispatchSeconds;
+  Times.TransformApply += Timings.TransformCommitSeconds;
+  Times.WorldTick += WorldTickTime;
+  Times.MaxWorldTick = FMath::Max(Times.MaxWorldTick, WorldTickTime);
+  ++GetCurrentResult(*State).NumMeasuredFrames;
+}
+
+// Moves every synthetic hand along its scripted path: the tracking input goes through the hand's
+// external data source into the native hand data, then the interactors are placed from the poses
+// read back through the data source interfaces
+static void UpdateScriptedHands(FInteractionBenchmarkState& State)
+{
+  const FInteractionBenchmarkConfig& Config = GetCurrentResult(State).Config;
+  const double GridLength = FMath::Max(1, Config.NumInteractables) * BenchmarkGridSpacing;
+
+  for (int32 HandIndex = 0; HandIndex < State.TrackedHands.Num(); ++HandIndex)
+  {
+    AIsdkTestBenchmarkHandActor* TrackedHand = State.TrackedHands[HandIndex].Get();
+    if (!TrackedHand)
+    {
+      continue;
+    }
+    UIsdkFakeHandDataSource* HandSource = TrackedHand->TestHandDataSource;
+
+    // Sweep across the grid while pressing in and out of the surfaces, hands are spread out so
+    // they don't all touch the same interactable
+    const double Phase = State.Frame * 0.1 + HandIndex * 1.7;
+    const double Y =
+        FMath::Fmod(State.Frame * 2.0 + HandIndex * GridLength / Config.NumHands, GridLength);
+    const double Depth = -1.5 + 2.0 * FMath::Sin(Phase);
+    const double PokeZ = (HandIndex % 2) == 0 ? 0.0 : BenchmarkWidgetRowZ;
+
+    HandSource->FakeRootPose = FTransform(FVector(Depth, Y, 0.0));
+    HandSource->FakePointerPoseRelative = FTransform(
+        FRotator(0.0, 10.0 * FMath::Sin(Phase), 0.0),
+        FVector(-100.0 - Depth, 0.0, BenchmarkRayRowZ));
+    if (State.bGrabbing)
+    {
+      HandSource->SetHandJointsToPalmGrabPose();
+    }
+    else
+    {
+      HandSource->SetHandJointsToPinchPose();
+    }
+
+    // Read back through the interfaces, the way the rig and interactors consume them
+    const bool bRootPoseValid = IIsdkIRootPose::Execute_IsRootPoseValid(HandSource);
+    const bool bJointsValid = IIsdkIHandJoints::Execute_IsHandJointDataValid(HandSource);
+    const UIsdkHandData* HandData = IIsdkIHandJoints::Execute_GetHandData(HandSource);
+    if (!bRootPoseValid || !bJointsValid || !IsValid(HandData) ||
+        HandData->GetJointPoses().IsEmpty())
+    {
+      continue;
+    }
+    const FVector HandLocation = IIsdkIRootPose::Execute_GetRootPose(HandSource).GetLocation();
+
+    if (AIsdkTestPokeInteractorActor* PokeHand = State.PokeHands[HandIndex].Get())
+    {
+      PokeHand->SetActorLocation(HandLocation + FVector(0.0, 0.0, PokeZ));
+    }
+
+    if (AIsdkTestGrabInteractorActor* GrabHand = State.GrabHands[HandIndex].Get())
+    {
+      GrabHand->SetActorLocation(HandLocation + FVector(0.0, 0.0, BenchmarkGrabRowZ));
+    }
+
+    if (AIsdkTestRayInteractorActor* RayHand = State.RayHands[HandIndex].Get())
+    {
+      // The ray interactor reads the same pointer pose from the data source during its tick
+      FTransform PointerPose;
+      bool bPointerPoseValid = false;
+      IIsdkIHandPointerPose::Execute_GetPointerPose(HandSource, PointerPose, bPointerPoseValid);
+      RayHand->SetActorLocation(PointerPose.GetLocation());
+    }
+  }
+}
+
+// Fails the test for every stage whose average per frame time is over its budget
+static void CheckStageBudgets(FAutomationTestBase* Test, const FInteractionBenchmarkResult& Result)
+{
+  const double ToAverageMs = 1000.0 / FMath::Max(1, Result.NumMeasuredFrames);
+  const FInteractionBenchmarkStageTimes& Times = Result.Times;
+  const TPair<const TCHAR*, TPair<double, float>> Stages[] = {
+      {TEXT("DataSourceRead"),
+       {Times.DataSourceRead, CVar_Isdk_Benchmark_BudgetDataSourceReadMs.GetValueOnGameThread()}},
+      {TEXT("InteractorTick"),
+       {Times.InteractorTick, CVar_Isdk_Benchmark_BudgetInteractorTickMs.GetValueOnGameThread()}},
+      {TEXT("EventDispatch"),
+       {Times.EventDispatch, CVar_Isdk_Benchmark_BudgetEventDispatchMs.GetValueOnGameThread()}},
+      {TEXT("TransformApply"),
+       {Times.TransformApply, CVar_Isdk_Benchmark_BudgetTransformApplyMs.GetValueOnGameThread()}},
+      {TEXT("WorldTick"),
+       {Times.WorldTick, CVar_Isdk_Benchmark_BudgetWorldTickMs.GetValueOnGameThread()}}};
+
+  for (const auto& Stage : Stages)
+  {
+    const double AverageMs = Stage.Value.Key * ToAverageMs;
+    const float BudgetMs = Stage.Value.Value;
+    if (BudgetMs > 0.0f && AverageMs > BudgetMs)
+    {
+      Test->AddError(FString::Printf(
+          TEXT("%s took %.4f ms per frame for %d hands x %d interactables, over its budget of "
+               "%.4f ms"),
+          Stage.Key,
+          AverageMs,
+          Result.Config.NumHands,
+          Result.Config.NumInteractables,
+          BudgetMs));
+    }
+  }
+}
+
+// Grabs and releases whatever the grab hands are hovering, so grab transforms are exercised
+static void ToggleScriptedGrabs(FInteractionBenchmarkState& State)
+{
+  if (State.Frame % BenchmarkGrabTogglePeriod != 0)
+  {
+    return;
+  }
+
+  State.bGrabbing = !State.bGrabbing;
+  for (const TWeakObjectPtr<AIsdkTestGrabInteractorActor>& GrabHand : State.GrabHands)
+  {
+    if (AIsdkTestGrabInteractorActor* Hand = GrabHand.Get())
+    {
+      if (State.bGrabbing)
+      {
+        Hand->PinchGrab();
+      }
+      else
+      {
+        Hand->PinchRelease();
+      }
+    }
+  }
+}
+
+static FString GetBenchmarkOutputFilename()
+{
+  FString OutputFilename;
+  if (!FParse::Value(FCommandLine::Get(), TEXT("IsdkBenchmarkOutput="), OutputFilename))
+  {
+    OutputFilename =
+        FPaths::Combine(FPaths::AutomationDir(), TEXT("IsdkInteractionBenchmark.csv"));
+  }
+  return OutputFilename;
+}
+} // namespace isdk::test
+
+using isdk::test::FInteractionBenchmarkState;
+
+// Command: Spawn the hands and interactables of one configuration
+DEFINE_LATENT_AUTOMATION_COMMAND_TWO_PARAMETER(
+    FIsdkBenchmarkSpawnScene,
+    TSharedRef<FInteractionBenchmarkState>,
+    State,
+    int32,
+    ConfigIndex);
+bool FIsdkBenchmarkSpawnScene::Update()
+{
+  using namespace isdk::test;
+
+  UWorld* World = GetBenchmarkWorld();
+  const FInteractionBenchmarkConfig& Config = State->Configs[ConfigIndex];
+  State->Results.Add({Config, {}, 0});
+  State->World = World;
+  State->Frame = 0;
+  State->bMeasuring = false;
+  State->bGrabbing = false;
+
+  UIsdkWidgetSubsystem& WidgetSubsystem = UIsdkWidgetSubsystem::Get(World);
+  for (int32 HandIndex = 0; HandIndex < Config.NumHands; ++HandIndex)
+  {
+    AIsdkTestBenchmarkHandActor* TrackedHand =
+        SpawnBenchmarkActor<AIsdkTestBenchmarkHandActor>(World, FVector::ZeroVector);
+    TrackedHand->TestHandDataSource->Handedness =
+        (HandIndex % 2) == 0 ? EIsdkHandedness::Left : EIsdkHandedness::Right;
+    State->TrackedHands.Add(TrackedHand);
+
+    AIsdkTestPokeInteractorActor* PokeHand =
+        SpawnBenchmarkActor<AIsdkTestPokeInteractorActor>(World, FVector::ZeroVector);
+    WidgetSubsystem.RegisterVirtualUserInfo(PokeHand->TestPokeInteractor, {HandIndex, 0});
+    State->PokeHands.Add(PokeHand);
+
+    AIsdkTestRayInteractorActor* RayHand =
+        SpawnBenchmarkActor<AIsdkTestRayInteractorActor>(World, FVector::ZeroVector);
+    RayHand->GetTestRayInteractor()->SetHandPointerPose(TrackedHand->TestHandDataSource);
+    State->RayHands.Add(RayHand);
+
+    State->GrabHands.Add(
+        SpawnBenchmarkActor<AIsdkTestGrabInteractorActor>(World, FVector::ZeroVector));
+  }
+
+  for (int32 Index = 0; Index < Config.NumInteractables; ++Index)
+  {
+    const double Y = Index * BenchmarkGridSpacing;
+
+    AIsdkTestPokeInteractableActor* Poke =
+        SpawnBenchmarkActor<AIsdkTestPokeInteractableActor>(World, FVector(0.0, Y, 0.0));
+    Poke->SetSingleClipper(FVector3f::ZeroVector, BenchmarkGridSpacing * 0.5f);
+    State->Interactables.Add(Poke);
+
+    AIsdkTestBenchmarkWidgetActor* Widget = SpawnBenchmarkActor<AIsdkTestBenchmarkWidgetActor>(
+        World, FVector(0.0, Y, BenchmarkWidgetRowZ));
+    Widget->SetSingleClipper(FVector3f::ZeroVector, BenchmarkGridSpacing * 0.5f);
+    State->Interactables.Add(Widget);
+
+    AIsdkTestGrabInteractableActor* Grab = SpawnBenchmarkActor<AIsdkTestGrabInteractableActor>(
+        World, FVector(0.0, Y, BenchmarkGrabRowZ));
+    Grab->SetColliderMode(EIsdkGrabbableColliderMode::Sphere, BenchmarkGridSpacing * 0.25f);
+    State->Interactables.Add(Grab);
+
+    State->Interactables.Add(SpawnBenchmarkActor<AIsdkTestRayInteractableActor>(
+        World, FVector(0.0, Y, BenchmarkRayRowZ)));
+  }
+
+  State->WorldTickStartHandle =
+      FWorldDelegates::OnWorldTickStart.AddStatic(&OnBenchmarkWorldTickStart, State);
+  State->WorldTickEndHandle =
+      FWorldDelegates::OnWorldTickEnd.AddStatic(&OnBenchmarkWorldTickEnd, State);
+  return true;
+}
+
+// Command: Drive the scripted hands, measuring once the warmup frames have passed
+DEFINE_LATENT_AUTOMATION_COMMAND_ONE_PARAMETER(
+    FIsdkBenchmarkRunFrames,
+    TSharedRef<FInteractionBenchmarkState>,
+    State);
+bool FIsdkBenchmarkRunFrames::Update()
+{
+  using namespace isdk::test;
+
+  FInteractionBenchmarkResult& Result = GetCurrentResult(*State);
+  if (State->Frame >= Result.Config.NumWarmupFrames + Result.Config.NumFrames)
+  {
+    State->bMeasuring = false;
+    return true;
+  }
+  State->bMeasuring = State->Frame >= Result.Config.NumWarmupFrames;
+
+  const double StartTime = FPlatformTime::Seconds();
+  UpdateScriptedHands(*State);
+  if (State->bMeasuring)
+  {
+    Result.Times.DataSourceRead += FPlatformTime::Seconds() - StartTime;
+  }
+
+  ToggleScriptedGrabs(*State);
+  ++State->Frame;
+  return false;
+}
+
+// Command: Tear down the scene of the current configuration
+DEFINE_LATENT_AUTOMATION_COMMAND_ONE_PARAMETER(
+    FIsdkBenchmarkDestroyScene,
+    TSharedRef<FInteractionBenchmarkState>,
+    State);
+bool FIsdkBenchmarkDestroyScene::Update()
+{
+  FWorldDelegates::OnWorldTickStart.Remove(State->WorldTickStartHandle);
+  FWorldDelegates::OnWorldTickEnd.Remove(State->WorldTickEndHandle);
+
+  UWorld* World = State->World.Get();
+  UIsdkWidgetSubsystem* WidgetSubsystem =
+      IsValid(World) ? World->GetSubsystem<UIsdkWidgetSubsystem>() : nullptr;
+  for (const TWeakObjectPtr<AIsdkTestPokeInteractorActor>& PokeHand : State->PokeHands)
+  {
+    if (PokeHand.IsValid() && IsValid(WidgetSubsystem))
+    {
+      WidgetSubsystem->UnregisterVirtualUserInfo(PokeHand->TestPokeInteractor);
+    }
+  }
+
+  TArray<AActor*> Actors;
+  Algo::Transform(State->TrackedHands, Actors, [](const auto& Actor) { return Actor.Get(); });
+  Algo::Transform(State->PokeHands, Actors, [](const auto& Actor) { return Actor.Get(); });
+  Algo::Transform(State->RayHands, Actors, [](const auto& Actor) { return Actor.Get(); });
+  Algo::Transform(State->GrabHands, Actors, [](const auto& Actor) { return Actor.Get(); });
+  Algo::Transform(State->Interactables, Actors, [](const auto& Actor) { return Actor.Get(); });
+  for (AActor* Actor : Actors)
+  {
+    if (IsValid(Actor))
+    {
+      Actor->Destroy();
+    }
+  }
+
+  State->TrackedHands.Reset();
+  State->PokeHands.Reset();
+  State->RayHands.Reset();
+  State->GrabHands.Reset();
+  State->Interactables.Reset();
+  return true;
+}
+
+// Command: Report per frame stage averages and write them out as CSV
+DEFINE_LATENT_AUTOMATION_COMMAND_TWO_PARAMETER(
+    FIsdkBenchmarkWriteResults,
+    FAutomationTestBase*,
+    Test,
+    TSharedRef<FInteractionBenchmarkState>,
+    State);
+bool FIsdkBenchmarkWriteResults::Update()
+{
+  using namespace isdk::test;
+
+  FString Csv = TEXT(
+      "Hands,Interactables,Frames,DataSourceReadMs,InteractorTickMs,EventDispatchMs,TransformApplyMs,WorldTickMs,MaxWorldTickMs\n");
+  for (const FInteractionBenchmarkResult& Result : State->Results)
+  {
+    const double ToAverageMs = 1000.0 / FMath::Max(1, Result.NumMeasuredFrames);
+    const FInteractionBenchmarkStageTimes& Times = Result.Times;
+    const FString Line = FString::Printf(
+        TEXT("%d,%d,%d,%.4f,%.4f,%.4f,%.4f,%.4f,%.4f"),
+        Result.Config.NumHands,
+        Result.Config.NumInteractables,
+        Result.NumMeasuredFrames,
+        Times.DataSourceRead * ToAverageMs,
+        Times.InteractorTick * ToAverageMs,
+        Times.EventDispatch * ToAverageMs,
+        Times.TransformApply * ToAverageMs,
+        Times.WorldTick * ToAverageMs,
+        Times.MaxWorldTick * 1000.0);
+    Test->AddInfo(Line);
+    Csv += Line + TEXT("\n");
+
+    Test->TestTrue(
+        *FString::Printf(
+            TEXT("Frames measured for %d hands x %d interactables"),
+            Result.Config.NumHands,
+            Result.Config.NumInteractables),
+        Result.NumMeasuredFrames > 0);
+    CheckStageBudgets(Test, Result);
+  }
+
+  const FString OutputFilename = GetBenchmarkOutputFilename();
+  Test->TestTrue(
+      *FString::Printf(TEXT("Write benchmark results to %s"), *OutputFilename),
+      FFileHelper::SaveStringToFile(Csv, *OutputFilename));
+  return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+    IsdkInteractionBenchmark,
+    "InteractionSDK.OculusInteraction.Source.OculusInteractionEditor.Private.Tests.IsdkInteractionBenchmark",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool IsdkInteractionBenchmark::RunTest(const FString& Parameters)
+{
+  using namespace isdk::test;
+
+  const TSharedRef<FInteractionBenchmarkState> State = MakeShared<FInteractionBenchmarkState>();
+
+  // A single configuration can be requested from the command line, otherwise sweep a few sizes
+  FInteractionBenchmarkConfig CommandLineConfig;
+  const bool bHasHands =
+      FParse::Value(FCommandLine::Get(), TEXT("IsdkBenchmarkHands="), CommandLineConfig.NumHands);
+  const bool bHasInteractables = FParse::Value(
+      FCommandLine::Get(), TEXT("IsdkBenchmarkInteractables="), CommandLineConfig.NumInteractables);
+  FParse::Value(FCommandLine::Get(), TEXT("IsdkBenchmarkFrames="), CommandLineConfig.NumFrames);
+  if (bHasHands || bHasInteractables)
+  {
+    CommandLineConfig.NumHands = FMath::Max(1, CommandLineConfig.NumHands);
+    CommandLineConfig.NumInteractables = FMath::Max(1, CommandLineConfig.NumInteractables);
+    State->Configs.Add(CommandLineConfig);
+  }
+  else
+  {
+    for (const FIntPoint& Size : {FIntPoint(2, 8), FIntPoint(4, 32), FIntPoint(8, 64)})
+    {
+      FInteractionBenchmarkConfig Config = CommandLineConfig;
+      Config.NumHands = Size.X;
+      Config.NumInteractables = Size.Y;
+      State->Configs.Add(Config);
+    }
+  }
+
+  AddInitPieTestSteps(this);
+
+  for (int32 ConfigIndex = 0; ConfigIndex < State->Configs.Num(); ++ConfigIndex)
+  {
+    ADD_LATENT_AUTOMATION_COMMAND(FIsdkBenchmarkSpawnScene(State, ConfigIndex));
+    ADD_LATENT_AUTOMATION_COMMAND(FWaitLatentCommand(OneFrameDelay));
+    ADD_LATENT_AUTOMATION_COMMAND(FIsdkBenchmarkRunFrames(State));
+    ADD_LATENT_AUTOMATION_COMMAND(FIsdkBenchmarkDestroyScene(State));
+    ADD_LATENT_AUTOMATION_COMMAND(FWaitLatentCommand(OneFrameDelay));
+  }
+
+  ADD_LATENT_AUTOMATION_COMMAND(FIsdkBenchmarkWriteResults(this, State));
+  ADD_LATENT_AUTOMATION_COMMAND(FEndPlayMapCommand);
+
+  return true;
+}
@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) Meta Platforms, Inc. and affiliates.
+ * All rights reserved.
+ *
+ * Licensed under the Oculus SDK License Agreement (the "License");
+ * you may not use the Oculus SDK except in compliance with the License,
+ * which is provided at the time of installation or download, or which
+ * otherwise accompanies this software in either electronic or hard copy form.
+ *
+ * You may obtain a copy of the License at
+ *
+ * https://developer.oculus.com/licenses/oculussdk/
+ *
+ * Unless required by applicable law or agreed to in writing, the Oculus SDK
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/WidgetComponent.h"
+#include "Engine/World.h"
+#include "Widget/IsdkPointableWidget.h"
+#include "IsdkTestFakes.h"
+#include "IsdkTestPokeInteraction.h"
+
+#include "IsdkTestInteractionBenchmark.generated.h"
+
+/**
+ * A poke interactable that also routes its pointer events into a widget, so that the benchmark
+ * covers the Slate path of UIsdkPointableWidget
+ */
+UCLASS()
+class OCULUSINTERACTIONEDITOR_API AIsdkTestBenchmarkWidgetActor
+    : public AIsdkTestPokeInteractableActor
+{
+  GENERATED_BODY()
+ public:
+  AIsdkTestBenchmarkWidgetActor()
+  {
+    TestWidgetComponent = CreateDefaultSubobject<UWidgetComponent>(TEXT("TestWidgetComponent"));
+    TestWidgetComponent->SetupAttachment(RootComponent);
+    TestWidgetComponent->SetDrawSize(FVector2D(256.0, 256.0));
+
+    TestPointableWidget =
+        CreateDefaultSubobject<UIsdkPointableWidget>(TEXT("TestPointableWidget"));
+  }
+
+  virtual void BeginPlay() override
+  {
+    Super::BeginPlay();
+    TestPointableWidget->Setup(TestWidgetComponent, TestPokeInteractable);
+  }
+
+  UPROPERTY()
+  UWidgetComponent* TestWidgetComponent{};
+  UPROPERTY()
+  UIsdkPointableWidget* TestPointableWidget{};
+};
+
+/**
+ * Tracking input of one synthetic benchmark hand. Scripted root poses and joints go through an
+ * external hand data source into the native hand data, and the hand's interactors read their poses
+ * back through the data source interfaces
+ */
+UCLASS()
+class OCULUSINTERACTIONEDITOR_API AIsdkTestBenchmarkHandActor : public AActor
+{
+  GENERATED_BODY()
+ public:
+  AIsdkTestBenchmarkHandActor()
+  {
+    SetRootComponent(CreateDefaultSubobject<USceneComponent>(TEXT("Root")));
+
+    TestHandDataSource =
+        CreateDefaultSubobject<UIsdkFakeHandDataSource>(TEXT("TestHandDataSource"));
+  }
+
+  UPROPERTY()
+  UIsdkFakeHandDataSource* TestHandDataSource{};
+};
+
+namespace isdk::test
+{
+/**
+ * Size of one benchmark run: every synthetic hand carries a poke, a ray and a grab interactor, and
+ * each kind of interactable (poke, ray, grab, widget) is spawned NumInteractables times
+ */
+struct FInteractionBenchmarkConfig
+{
+  int32 NumHands = 2;
+  int32 NumInteractables = 8;
+  int32 NumWarmupFrames = 10;
+  int32 NumFrames = 120;
+};
+
+/**
+ * Per-stage wall clock time accumulated over the measured frames of one run, in seconds
+ */
+struct FInteractionBenchmarkStageTimes
+{
+  // Scripted tracking pushed through the external hand data sources and read back by the hands
+  double DataSourceRead = 0.0;
+  // Native interactor drive in UIsdkWorldSubsystem
+  double InteractorTick = 0.0;
+  // Pointer and state event dispatch in UIsdkWorldSubsystem
+  double EventDispatch = 0.0;
+  // Deferred grab transform commits
+  double TransformApply = 0.0;
+  // All actor and subsystem ticking of the world, for scale
+  double WorldTick = 0.0;
+  // Slowest single world tick
+  double MaxWorldTick = 0.0;
+};
+
+struct FInteractionBenchmarkResult
+{
+  FInteractionBenchmarkConfig Config;
+  FInteractionBenchmarkStageTimes Times;
+  int32 NumMeasuredFrames = 0;
+};
+} // namespace isdk::test
@@ -10,6 +10,8 @@ FOculusXRAnchorEventDelegates::FOculusXRSpaceQueryResultsDelegate FOculusXRAncho
 
 FOculusXRAnchorEventDelegates::FOculusXRSpaceQueryResultDelegate FOculusXRAnchorEventDelegates::OculusSpaceQueryResult;
 
+FOculusXRAnchorEventDelegates::FOculusXRSpaceQueryResultBatchDelegate FOculusXRAnchorEventDelegates::OculusSpaceQueryResultBatch;
+
 FOculusXRAnchorEventDelegates::FOculusXRSpaceQueryCompleteDelegate FOculusXRAnchorEventDelegates::OculusSpaceQueryComplete;
 
 FOculusXRAnchorEventDelegates::FOculusXRSpaceSaveCompleteDelegate FOculusXRAnchorEventDelegates::OculusSpaceSaveComplete;
@@ -0,0 +1,573 @@
+// Copyright (c) Meta Platforms, Inc. and affiliates.
+
+#include "OculusXRAnchorFunctionsLoopback.h"
+
+#include "OculusXRAnchorDelegates.h"
+#include "OculusXRAnchorManager.h"
+#include "OculusXRAnchorsModule.h"
+
+FOculusXRLoopbackEventQueue::FOculusXRLoopbackEventQueue(const FOculusXRLoopbackSettings& InSettings)
+{
+	SetSettings(InSettings);
+}
+
+FOculusXRLoopbackEventQueue::~FOculusXRLoopbackEventQueue()
+{
+	if (TickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+	}
+}
+
+void FOculusXRLoopbackEventQueue::SetSettings(const FOculusXRLoopbackSettings& InSettings)
+{
+	Settings = InSettings;
+	Settings.LatencySeconds = FMath::Max(Settings.LatencySeconds, 0.0f);
+	Settings.LatencyJitterSeconds = FMath::Max(Settings.LatencyJitterSeconds, 0.0f);
+	Settings.FailureRate = FMath::Clamp(Settings.FailureRate, 0.0f, 1.0f);
+	Random.Initialize(Settings.RandomSeed);
+}
+
+bool FOculusXRLoopbackEventQueue::ShouldFail()
+{
+	return Settings.FailureRate > 0.0f && Random.FRand() < Settings.FailureRate;
+}
+
+FOculusXRUUID FOculusXRLoopbackEventQueue::NewUuid()
+{
+	FOculusXRUUID Uuid;
+	for (uint8& Byte : Uuid.UUIDBytes)
+	{
+		Byte = static_cast<uint8>(Random.RandHelper(256));
+	}
+
+	// Random (version 4) UUID, which also guarantees it is never the all zero invalid UUID
+	Uuid.UUIDBytes[6] = (Uuid.UUIDBytes[6] & 0x0F) | 0x40;
+	Uuid.UUIDBytes[8] = (Uuid.UUIDBytes[8] & 0x3F) | 0x80;
+	return Uuid;
+}
+
+void FOculusXRLoopbackEventQueue::Deliver(TFunction<void()>&& Event)
+{
+	const float Jitter = Settings.LatencyJitterSeconds > 0.0f ? Random.FRandRange(0.0f, Settings.LatencyJitterSeconds) : 0.0f;
+	PendingEvents.HeapPush({ FPlatformTime::Seconds() + Settings.LatencySeconds + Jitter, ++LastSequence, MoveTemp(Event) });
+
+	if (!TickerHandle.IsValid())
+	{
+		TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FOculusXRLoopbackEventQueue::Tick));
+	}
+}
+
+void FOculusXRLoopbackEventQueue::Reset()
+{
+	PendingEvents.Reset();
+}
+
+bool FOculusXRLoopbackEventQueue::Tick(float DeltaTime)
+{
+	const double Now = FPlatformTime::Seconds();
+	while (PendingEvents.Num() > 0 && PendingEvents.HeapTop().DueTime <= Now)
+	{
+		FPendingEvent Pending;
+		PendingEvents.HeapPop(Pending, EAllowShrinking::No);
+
+		// May queue more events, which are delivered on a later tick at the earliest when they have no latency
+		Pending.Event();
+	}
+
+	if (PendingEvents.Num() == 0)
+	{
+		TickerHandle.Reset();
+		return false;
+	}
+	return true;
+}
+
+FOculusXRAnchorFunctionsLoopback::FOculusXRAnchorFunctionsLoopback(const FOculusXRLoopbackSettings& Settings)
+	: Events(Settings)
+{
+}
+
+EOculusXRAnchorResult::Type FOculusXRAnchorFunctionsLoopback::RollResult()
+{
+	return Events.ShouldFail() ? EOculusXRAnchorResult::Failure_SpaceNetworkRequestFailed : EOculusXRAnchorResult::Success;
+}
+
+bool FOculusXRAnchorFunctionsLoopback::AreAnchorsLoaded(const TArray<uint64>& AnchorHandles) const
+{
+	for (uint64 Handle : AnchorHandles)
+	{
+		if (!LoadedAnchors.Contains(Handle))
+		{
+			return false;
+		}
+	}
+	return AnchorHandles.Num() > 0;
+}
+
+uint64 FOculusXRAnchorFunctionsLoopback::LoadAnchor(const FOculusXRUUID& Uuid, const FTransform& Transform)
+{
+	for (const auto& It : LoadedAnchors)
+	{
+		if (It.Value.Uuid == Uuid)
+		{
+			return It.Key;
+		}
+	}
+
+	const uint64 Handle = ++LastAnchorHandle;
+	LoadedAnchors.Add(Handle, { Uuid, Transform, { EOculusXRSpaceComponentType::Locatable, EOculusXRSpaceComponentType::Storable, EOculusXRSpaceComponentType::Sharable } });
+	return Handle;
+}
+
+EOculusXRAnchorResult::Type FOculusXRAnchorFunctionsLoopback::CreateAnchor(const FTransform& InTransform, uint64& OutRequestId, const FTransform& CameraTransform)
+{
+	OutRequestId = Events.NextRequestId();
+	const EOculusXRAnchorResult::Type Result = RollResult();
+
+	uint64 Handle = 0;
+	FOculusXRUUID Uuid;
+	if (Result == EOculusXRAnchorResult::Success)
+	{
+		Uuid = Events.NewUuid();
+		Handle = ++LastAnchorHandle;
+		LoadedAnchors.Add(Handle, { Uuid, InTransform, { EOculusXRSpaceComponentType::Locatable } });
+	}
+
+	Events.Deliver([RequestId = OutRequestId, Result, Handle, Uuid]() {
+		FOculusXRAnchorEventDelegates::OculusSpatialAnchorCreateComplete.Broadcast(RequestId, Result, Handle, Uuid);
+	});
+	return EOculusXRAnchorResult::Success;
+}
+
+EOculusXRAnchorResult::Type FOculusXRAnchorFunctionsLoopback::DestroyAnchor(uint64 AnchorHandle)
+{
+	return LoadedAnchors.Remove(AnchorHandle) > 0 ? EOculusXRAnchorResult::Success : EOculusXRAnchorResult::Failure_InvalidParameter;
+}
+
+EOculusXRAnchorResult::Type FOculusXRAnchorFunctionsLoopback::TryGetAnchorTransform(uint64 AnchorHandle, FTransform& OutTransform, FOculusXRAnchorLocationFlags& OutLocationFlags, EOculusXRAnchorSpace Space)
+{
+	const FLoopbackAnchor* Anchor = LoadedAnchors.Find(AnchorHandle);
+	if (Anchor == nullptr)
+	{
+		return EOculusXRAnchorResult::Failure_InvalidParameter;
+	}
+
+	// There is no tracking origin to account for, anchors stay where they were created
+	OutTransform = Anchor->Transform;
+	OutLocationFlags = FOculusXRAnchorLocationFlags(0xF);
+	return EOculusXRAnchorResult::Success;
+}
+
+EOculusXRAnchorResult::Type FOculusXRAnchorFunctionsLoopback::SetAnchorComponentStatus(uint64 AnchorHandle, EOculusXRSpaceComponentType ComponentType, bool Enable, float Timeout, uint64& OutRequestId)
+{
+	FLoopbackAnchor* Anchor = LoadedAnchors.Find(AnchorHandle);
+	if (Anchor == nullptr)
+	{
+		return EOculusXRAnchorResult::Failure_InvalidParameter;
+	}
+	if (ComponentType != EOculusXRSpaceComponentType::Locatable && ComponentType != EOculusXRSpaceComponentType::Storable && ComponentType != EOculusXRSpaceComponentType::Sharable)
+	{
+		return EOculusXRAnchorResult::Failure_Unsupported;
+	}
+
+	OutRequestId = Events.NextRequestId();
+	const EOculusXRAnchorResult::Type Result = RollResult();
+	if (Result == EOculusXRAnchorResult::Success)
+	{
+		if (Enable)
+		{
+			Anchor->EnabledComponents.Add(ComponentType);
+		}
+		else
+		{
+			Anchor->EnabledComponents.Remove(ComponentType);
+		}
+	}
+
+	Events.Deliver([RequestId = OutRequestId, Result, AnchorHandle, Uuid = Anchor->Uuid, ComponentType, Enable]() {
+		FOculusXRAnchorEventDelegates::OculusSpaceSetComponentStatusComplete.Broadcast(RequestId, Result, AnchorHandle, Uuid, ComponentType, Enable);
+	});
+	return EOculusXRAnchorResult::Success;
+}
+
+EOculusXRAnchorResult::Type FOculusXRAnchorFunctionsLoopback::GetAnchorComponentStatus(uint64 AnchorHandle, EOculusXRSpaceComponentType ComponentType, bool& OutEnabled, bool& OutChangePending)
+{
+	const FLoopbackAnchor* Anchor = LoadedAnchors.Find(AnchorHandle);
+	if (Anchor == nullptr)
+	{
+		return EOculusXRAnchorResult::Failure_InvalidParameter;
+	}
+
+	OutEnabled = Anchor->EnabledComponents.Contains(ComponentType);
+	OutChangePending = false;
+	return EOculusXRAnchorResult::Success;
+}
+
+EOculusXRAnchorResult::Type FOculusXRAnchorFunctionsLoopback::GetSupportedAnchorComponents(uint64 AnchorHandle, TArray<EOculusXRSpaceComponentType>& OutSupportedTypes)
+{
+	if (!LoadedAnchors.Contains(AnchorHandle))
+	{
+		return EOculusXRAnchorResult::Failure_InvalidParameter;
+	}
+
+	OutSupportedTypes = { EOculusXRSpaceComponentType::Locatable, EOculusXRSpaceComponentType::Storable, EOculusXRSpaceComponentType::Sharable };
+	return EOculusXRAnchorResult::Success;
+}
+
+EOculusXRAnchorResult::Type FOculusXRAnchorFunctionsLoopback::GetAnchorContainerUUIDs(uint64 AnchorHandle, TArray<FOculusXRUUID>& OutUUIDs)
+{
+	// Scene containers are not simulated
+	return EOculusXRAnchorResult::Failure_Unsupported;
+}
+
+EOculusXRAnchorResult::Type FOculusXRAnchorFunctionsLoopback::SaveAnchor(uint64 AnchorHandle, EOculusXRSpaceStorageLocation StorageLocation, EOculusXRSpaceStoragePersistenceMode StoragePersistenceMode, uint64& OutRequestId)
+{
+	const FLoopbackAnchor* Anchor = LoadedAnchors.Find(AnchorHandle);
+	if (Anchor == nullptr)
+	{
+		return EOculusXRAnchorResult::Failure_InvalidParameter;
+	}
+
+	OutRequestId = Events.NextRequestId();
+	const EOculusXRAnchorResult::Type Result = RollResult();
+	if (Result == EOculusXRAnchorResult::Success)
+	{
+		StoredAnchors.Add(Anchor->Uuid, Anchor->Transform);
+	}
+
+	Events.Deliver([RequestId = OutRequestId, AnchorHandle, Result, Uuid = Anchor->Uuid]() {
+		FOculusXRAnchorEventDelegates::OculusSpaceSaveComplete.Broadcast(RequestId, AnchorHandle, Result == EOculusXRAnchorResult::Success, Result, Uuid);
+	});
+	return EOculusXRAnchorResult::Success;
+}
+
+EOculusXRAnchorResult::Type FOculusXRAnchorFunctionsLoopback::SaveAnchorList(const TArray<uint64>& AnchorHandles, EOculusXRSpaceStorageLocation StorageLocation, uint64& OutRequestId)
+{
+	if (!AreAnchorsLoaded(AnchorHandles))
+	{
+		return EOculusXRAnchorResult::Failure_InvalidParameter;
+	}
+
+	OutRequestId = Events.NextRequestId();
+	const EOculusXRAnchorResult::Type Result = RollResult();
+	if (Result == EOculusXRAnchorResult::Success)
+	{
+		for (uint64 Handle : AnchorHandles)
+		{
+			const FLoopbackAnchor& Anchor = LoadedAnchors[Handle];
+			StoredAnchors.Add(Anchor.Uuid, Anchor.Transform);
+		}
+	}
+
+	Events.Deliver([RequestId = OutRequestId, Result]() {
+		FOculusXRAnchorEventDelegates::OculusSpaceListSaveComplete.Broadcast(RequestId, Result);
+	});
+	return EOculusXRAnchorResult::Success;
+}
+
+EOculusXRAnchorResult::Type FOculusXRAnchorFunctionsLoopback::SaveAnchors(const TArray<uint64>& AnchorHandles, uint64& OutRequestId)
+{
+	if (!AreAnchorsLoaded(AnchorHandles))
+	{
+		return EOculusXRAnchorResult::Failure_InvalidParameter;
+	}
+
+	OutRequestId = Events.NextRequestId();
+	const EOculusXRAnchorResult::Type Result = RollResult();
+	if (Result == EOculusXRAnchorResult::Success)
+	{
+		for (uint64 Handle : AnchorHandles)
+		{
+			const FLoopbackAnchor& Anchor = LoadedAnchors[Handle];
+			StoredAnchors.Add(Anchor.Uuid, Anchor.Transform);
+		}
+	}
+
+	Events.Deliver([RequestId = OutRequestId, Result]() {
+		FOculusXRAnchorEventDelegates::OculusAnchorsSaveComplete.Broadcast(RequestId, Result);
+	});
+	return EOculusXRAnchorResult::Success;
+}
+
+void FOculusXRAnchorFunctionsLoopback::DeliverQueryResults(uint64 RequestId, EOculusXRAnchorResult::Type Result, const TArray<FOculusXRUUID>& Uuids, bool bDiscovery)
+{
+	TArray<FOculusXRAnchorsDiscoverResult> Results;
+	if (Result == EOculusXRAnchorResult::Success)
+	{
+		Results.Reserve(Uuids.Num());
+		for (const FOculusXRUUID& Uuid : Uuids)
+		{
+			Results.Emplace(LoadAnchor(Uuid, StoredAnchors[Uuid]), Uuid);
+		}
+	}
+
+	Events.Deliver([RequestId, Result, Results = MoveTemp(Results), bDiscovery]() {
+		if (bDiscovery)
+		{
+			if (Results.Num() > 0)
+			{
+				FOculusXRAnchorEventDelegates::OculusAnchorsDiscoverResults.Broadcast(RequestId, Results);
+			}
+			FOculusXRAnchorEventDelegates::OculusAnchorsDiscoverComplete.Broadcast(RequestId, Result);
+			return;
+		}
+
+		if (Results.Num() > 0)
+		{
+			FOculusXRAnchorEventDelegates::OculusSpaceQueryResults.Broadcast(RequestId);
+			FOculusXRAnchorEventDelegates::OculusSpaceQueryResultBatch.Broadcast(RequestId, Results);
+			for (const FOculusXRAnchorsDiscoverResult& It : Results)
+			{
+				FOculusXRAnchorEventDelegates::OculusSpaceQueryResult.Broadcast(RequestId, It.Space, It.UUID);
+			}
+		}
+		FOculusXRAnchorEventDelegates::OculusSpaceQueryComplete.Broadcast(RequestId, Result);
+	});
+}
+
+EOculusXRAnchorResult::Type FOculusXRAnchorFunctionsLoopback::DiscoverAnchors(const FOculusXRSpaceDiscoveryInfo& DiscoveryInfo, uint64& OutRequestId)
+{
+	TSet<FOculusXRUUID> IdFilter;
+	for (const UOculusXRSpaceDiscoveryFilterBase* Filter : DiscoveryInfo.Filters)
+	{
+		if (const UOculusXRSpaceDiscoveryIdsFilter* IdsFilter = Cast<UOculusXRSpaceDiscoveryIdsFilter>(Filter))
+		{
+			IdFilter.Append(IdsFilter->Uuids);
+		}
+	}
+
+	TArray<FOculusXRUUID> Uuids;
+	for (const auto& It : StoredAnchors)
+	{
+		if (IdFilter.Num() == 0 || IdFilter.Contains(It.Key))
+		{
+			Uuids.Add(It.Key);
+		}
+	}
+
+	OutRequestId = Events.NextRequestId();
+	DeliverQueryResults(OutRequestId, RollResult(), Uuids, true);
+	return EOculusXRAnchorResult::Success;
+}
+
+EOculusXRAnchorResult::Type FOculusXRAnchorFunctionsLoopback::QueryAnchors(const FOculusXRSpaceQueryInfo& QueryInfo, uint64& OutRequestId)
+{
+	TArray<FOculusXRUUID> Uuids;
+	switch (QueryInfo.FilterType)
+	{
+		case EOculusXRSpaceQueryFilterType::FilterByGroup:
+			if (const TArray<FOculusXRUUID>* Shared = GroupShares.Find(QueryInfo.GroupUUIDFilter))
+			{
+				for (const FOculusXRUUID& Uuid : *Shared)
+				{
+					if (QueryInfo.IDFilter.Num() == 0 || QueryInfo.IDFilter.Contains(Uuid))
+					{
+						Uuids.Add(Uuid);
+					}
+				}
+			}
+			break;
+		case EOculusXRSpaceQueryFilterType::FilterByIds:
+			for (const FOculusXRUUID& Uuid : QueryInfo.IDFilter)
+			{
+				if (StoredAnchors.Contains(Uuid))
+				{
+					Uuids.AddUnique(Uuid);
+				}
+			}
+			break;
+		default:
+			// Every stored anchor supports the simulated components, so a component filter matches all of them
+			StoredAnchors.GenerateKeyArray(Uuids);
+			break;
+	}
+
+	if (QueryInfo.MaxQuerySpaces > 0 && Uuids.Num() > QueryInfo.MaxQuerySpaces)
+	{
+		Uuids.SetNum(QueryInfo.MaxQuerySpaces);
+	}
+
+	OutRequestId = Events.NextRequestId();
+	DeliverQueryResults(OutRequestId, RollResult(), Uuids, false);
+	return EOculusXRAnchorResult::Success;
+}
+
+EOculusXRAnchorResult::Type FOculusXRAnchorFunctionsLoopback::ShareAnchors(const TArray<uint64>& AnchorHandles, const TArray<uint64>& UserIds, uint64& OutRequestId)
+{
+	if (!AreAnchorsLoaded(AnchorHandles) || UserIds.Num() == 0)
+	{
+		return EOculusXRAnchorResult::Failure_InvalidParameter;
+	}
+
+	// Users are not simulated, a successful share only makes the anchors available to queries
+	OutRequestId = Events.NextRequestId();
+	const EOculusXRAnchorResult::Type Result = RollResult();
+	if (Result == EOculusXRAnchorResult::Success)
+	{
+		for (uint64 Handle : AnchorHandles)
+		{
+			const FLoopbackAnchor& Anchor = LoadedAnchors[Handle];
+			StoredAnchors.Add(Anchor.Uuid, Anchor.Transform);
+		}
+	}
+
+	Events.Deliver([RequestId = OutRequestId, Result]() {
+		FOculusXRAnchorEventDelegates::OculusSpaceShareComplete.Broadcast(RequestId, Result);
+	});
+	return EOculusXRAnchorResult::Success;
+}
+
+EOculusXRAnchorResult::Type FOculusXRAnchorFunctionsLoopback::ShareAnchors(const TArray<uint64>& AnchorHandles, const TArray<FOculusXRUUID>& Groups, uint64& OutRequestId)
+{
+	if (!AreAnchorsLoaded(AnchorHandles) || Groups.Num() == 0)
+	{
+		return EOculusXRAnchorResult::Failure_InvalidParameter;
+	}
+
+	OutRequestId = Events.NextRequestId();
+	const EOculusXRAnchorResult::Type Result = RollResult();
+	if (Result == EOculusXRAnchorResult::Success)
+	{
+		for (uint64 Handle : AnchorHandles)
+		{
+			const FLoopbackAnchor& Anchor = LoadedAnchors[Handle];
+			StoredAnchors.Add(Anchor.Uuid, Anchor.Transform);
+			for (const FOculusXRUUID& Group : Groups)
+			{
+				GroupShares.FindOrAdd(Group).AddUnique(Anchor.Uuid);
+			}
+		}
+	}
+
+	Events.Deliver([RequestId = OutRequestId, Result]() {
+		FOculusXRAnchorEventDelegates::OculusShareAnchorsComplete.Broadcast(RequestId, Result);
+	});
+	return EOculusXRAnchorResult::Success;
+}
+
+EOculusXRAnchorResult::Type FOculusXRAnchorFunctionsLoopback::EraseAnchor(uint64 AnchorHandle, EOculusXRSpaceStorageLocation StorageLocation, uint64& OutRequestId)
+{
+	const FLoopbackAnchor* Anchor = LoadedAnchors.Find(AnchorHandle);
+	if (Anchor == nullptr)
+	{
+		return EOculusXRAnchorResult::Failure_InvalidParameter;
+	}
+
+	OutRequestId = Events.NextRequestId();
+	const EOculusXRAnchorResult::Type Result = RollResult();
+	if (Result == EOculusXRAnchorResult::Success)
+	{
+		StoredAnchors.Remove(Anchor->Uuid);
+	}
+
+	Events.Deliver([RequestId = OutRequestId, Result, Uuid = Anchor->Uuid, StorageLocation]() {
+		FOculusXRAnchorEventDelegates::OculusSpaceEraseComplete.Broadcast(RequestId, Result, Uuid, StorageLocation);
+	});
+	return EOculusXRAnchorResult::Success;
+}
+
+EOculusXRAnchorResult::Type FOculusXRAnchorFunctionsLoopback::EraseAnchors(const TArray<FOculusXRUInt64>& AnchorHandles, const TArray<FOculusXRUUID>& UUIDs, uint64& OutRequestId)
+{
+	TArray<FOculusXRUUID> ToErase = UUIDs;
+	for (const FOculusXRUInt64& Handle : AnchorHandles)
+	{
+		const FLoopbackAnchor* Anchor = LoadedAnchors.Find(Handle.Value);
+		if (Anchor == nullptr)
+		{
+			return EOculusXRAnchorResult::Failure_InvalidParameter;
+		}
+		ToErase.Add(Anchor->Uuid);
+	}
+
+	OutRequestId = Events.NextRequestId();
+	const EOculusXRAnchorResult::Type Result = RollResult();
+	if (Result == EOculusXRAnchorResult::Success)
+	{
+		for (const FOculusXRUUID& Uuid : ToErase)
+		{
+			StoredAnchors.Remove(Uuid);
+		}
+	}
+
+	Events.Deliver([RequestId = OutRequestId, Result]() {
+		FOculusXRAnchorEventDelegates::OculusAnchorsEraseComplete.Broadcast(RequestId, Result);
+	});
+	return EOculusXRAnchorResult::Success;
+}
+
+FOculusXRUUID FOculusXRAnchorFunctionsLoopback::AddSimulatedSharedAnchor(const FOculusXRUUID& Group, const FTransform& Transform)
+{
+	const FOculusXRUUID Uuid = Events.NewUuid();
+	StoredAnchors.Add(Uuid, Transform);
+	GroupShares.FindOrAdd(Group).Add(Uuid);
+	return Uuid;
+}
+
+void FOculusXRAnchorFunctionsLoopback::Reset()
+{
+	Events.Reset();
+	LoadedAnchors.Reset();
+	StoredAnchors.Reset();
+	GroupShares.Reset();
+}
+
+namespace OculusXRAnchors
+{
+	static TSharedPtr<FOculusXRAnchorFunctionsLoopback> Loopback;
+
+	void FAnchorsLoopback::Enable(const FOculusXRLoopbackSettings& Settings)
+	{
+		if (!Loopback.IsValid())
+		{
+			Loopback = MakeShared<FOculusXRAnchorFunctionsLoopback>(Settings);
+		}
+		else
+		{
+			Loopback->SetSettings(Settings);
+		}
+
+		FOculusXRAnchorManager::AnchorFunctionsImpl = Loopback;
+		UE_LOG(LogOculusXRAnchors, Log, TEXT("Anchor functions routed through the loopback backend."));
+	}
+
+	void FAnchorsLoopback::Disable()
+	{
+		if (IsEnabled())
+		{
+			// Selected again from the active XR system on next use
+			FOculusXRAnchorManager::AnchorFunctionsImpl.Reset();
+		}
+		Loopback.Reset();
+	}
+
+	bool FAnchorsLoopback::IsEnabled()
+	{
+		return Loopback.IsValid() && FOculusXRAnchorManager::AnchorFunctionsImpl == Loopback;
+	}
+
+	void FAnchorsLoopback::SetSettings(const FOculusXRLoopbackSettings& Settings)
+	{
+		if (Loopback.IsValid())
+		{
+			Loopback->SetSettings(Settings);
+		}
+	}
+
+	FOculusXRUUID FAnchorsLoopback::AddSimulatedSharedAnchor(const FOculusXRUUID& Group, const FTransform& Transform)
+	{
+		if (!ensureMsgf(Loopback.IsValid(), TEXT("The anchors loopback backend is not enabled.")))
+		{
+			return FOculusXRUUID();
+		}
+		return Loopback->AddSimulatedSharedAnchor(Group, Transform);
+	}
+
+	void FAnchorsLoopback::Reset()
+	{
+		if (Loopback.IsValid())
+		{
+			Loopback->Reset();
+		}
+	}
+} // namespace OculusXRAnchors
@@ -12,6 +12,7 @@
 
 #include "OculusXRAnchorFunctionsOVR.h"
 #include "OculusXRAnchorFunctionsOpenXR.h"
+#include "OculusXRAnchorsLoopback.h"
 
 namespace OculusXRAnchors
 {
@@ -103,6 +104,11 @@ namespace OculusXRAnchors
 	TSharedPtr<IOculusXRAnchorFunctions> FOculusXRAnchorManager::AnchorFunctionsImpl = nullptr;
 	TSharedPtr<IOculusXRAnchorFunctions> FOculusXRAnchorManager::GetOculusXRAnchorFunctionsImpl()
 	{
+		if (AnchorFunctionsImpl == nullptr && FParse::Param(FCommandLine::Get(), TEXT("OculusXRLoopback")))
+		{
+			FAnchorsLoopback::Enable();
+		}
+
 		if (AnchorFunctionsImpl == nullptr)
 		{
 			const FName SystemName(TEXT("OpenXR"));
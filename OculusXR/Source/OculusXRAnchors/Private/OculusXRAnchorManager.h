@@ -36,6 +36,8 @@ namespace OculusXRAnchors
 		static EOculusXRAnchorResult::Type EraseAnchors(const TArray<FOculusXRUInt64>& AnchorHandles, const TArray<FOculusXRUUID>& UUIDs, uint64& OutRequestId);
 
 	private:
+		friend class FAnchorsLoopback;
+
 		static TSharedPtr<IOculusXRAnchorFunctions> GetOculusXRAnchorFunctionsImpl();
 		static TSharedPtr<IOculusXRAnchorFunctions> AnchorFunctionsImpl;
 	};
@@ -61,13 +61,13 @@ namespace OculusXRAnchors
 		, RequestedAnchors(WantedAnchors)
 	{
 		CallbackHandleComplete = FOculusXRAnchorEventDelegates::OculusSpaceQueryComplete.AddStatic(&FGetAnchorsSharedWithGroup::OnQueryComplete);
-		CallbackHandleResults = FOculusXRAnchorEventDelegates::OculusSpaceQueryResult.AddStatic(&FGetAnchorsSharedWithGroup::OnQueryResultAvailable);
+		CallbackHandleResults = FOculusXRAnchorEventDelegates::OculusSpaceQueryResultBatch.AddStatic(&FGetAnchorsSharedWithGroup::OnQueryResultsAvailable);
 	}
 
 	FGetAnchorsSharedWithGroup::~FGetAnchorsSharedWithGroup()
 	{
 		FOculusXRAnchorEventDelegates::OculusSpaceQueryComplete.Remove(CallbackHandleComplete);
-		FOculusXRAnchorEventDelegates::OculusSpaceQueryResult.Remove(CallbackHandleResults);
+		FOculusXRAnchorEventDelegates::OculusSpaceQueryResultBatch.Remove(CallbackHandleResults);
 	}
 
 	void FGetAnchorsSharedWithGroup::OnResultsAvailable(const TArray<FOculusXRAnchor>& Results)
@@ -114,7 +114,7 @@ namespace OculusXRAnchors
 		}
 	}
 
-	void FGetAnchorsSharedWithGroup::OnQueryResultAvailable(FOculusXRUInt64 RequestId, FOculusXRUInt64 AnchorHandle, FOculusXRUUID AnchorUuid)
+	void FGetAnchorsSharedWithGroup::OnQueryResultsAvailable(FOculusXRUInt64 RequestId, const TArray<FOculusXRAnchorsDiscoverResult>& Results)
 	{
 		auto taskPtr = OculusXR::FAsyncRequestSystem::GetRequest<FGetAnchorsSharedWithGroup>(
 			OculusXR::FAsyncRequestBase::RequestId{ RequestId.GetValue() });
@@ -122,27 +122,37 @@ namespace OculusXRAnchors
 		if (taskPtr.IsValid())
 		{
 			TArray<EOculusXRSpaceComponentType> supportedTypes;
-			UE_LOG(LogOculusXRAnchors, Verbose, TEXT("	Found Element: Space: %llu  --  UUID: %s"), AnchorHandle.Value, *AnchorUuid.ToString());
+			TArray<FOculusXRAnchor> anchors;
+			anchors.Reserve(Results.Num());
 
-			uint64 tempOut;
-			FOculusXRAnchorManager::GetSupportedAnchorComponents(AnchorHandle, supportedTypes);
-
-			if (supportedTypes.Contains(EOculusXRSpaceComponentType::Locatable))
+			for (const FOculusXRAnchorsDiscoverResult& result : Results)
 			{
-				FOculusXRAnchorManager::SetAnchorComponentStatus(AnchorHandle, EOculusXRSpaceComponentType::Locatable, true, 0.0f, tempOut);
-			}
+				const FOculusXRUInt64& AnchorHandle = result.Space;
+				UE_LOG(LogOculusXRAnchors, Verbose, TEXT("	Found Element: Space: %llu  --  UUID: %s"), AnchorHandle.Value, *result.UUID.ToString());
 
-			if (supportedTypes.Contains(EOculusXRSpaceComponentType::Sharable))
-			{
-				FOculusXRAnchorManager::SetAnchorComponentStatus(AnchorHandle, EOculusXRSpaceComponentType::Sharable, true, 0.0f, tempOut);
-			}
+				uint64 tempOut;
+				supportedTypes.Reset();
+				FOculusXRAnchorManager::GetSupportedAnchorComponents(AnchorHandle, supportedTypes);
 
-			if (supportedTypes.Contains(EOculusXRSpaceComponentType::Storable))
-			{
-				FOculusXRAnchorManager::SetAnchorComponentStatus(AnchorHandle, EOculusXRSpaceComponentType::Storable, true, 0.0f, tempOut);
+				if (supportedTypes.Contains(EOculusXRSpaceComponentType::Locatable))
+				{
+					FOculusXRAnchorManager::SetAnchorComponentStatus(AnchorHandle, EOculusXRSpaceComponentType::Locatable, true, 0.0f, tempOut);
+				}
+
+				if (supportedTypes.Contains(EOculusXRSpaceComponentType::Sharable))
+				{
+					FOculusXRAnchorManager::SetAnchorComponentStatus(AnchorHandle, EOculusXRSpaceComponentType::Sharable, true, 0.0f, tempOut);
+				}
+
+				if (supportedTypes.Contains(EOculusXRSpaceComponentType::Storable))
+				{
+					FOculusXRAnchorManager::SetAnchorComponentStatus(AnchorHandle, EOculusXRSpaceComponentType::Storable, true, 0.0f, tempOut);
+				}
+
+				anchors.Add(FOculusXRAnchor(AnchorHandle, result.UUID));
 			}
 
-			taskPtr->OnResultsAvailable({ FOculusXRAnchor(AnchorHandle, AnchorUuid) });
+			taskPtr->OnResultsAvailable(anchors);
 
 			return;
 		}
@@ -23,7 +23,7 @@ namespace OculusXRAnchors
 		DelegateHandleSetComponentStatus = FOculusXRAnchorEventDelegates::OculusSpaceSetComponentStatusComplete.AddRaw(this, &FOculusXRAnchors::HandleSetComponentStatusComplete);
 		DelegateHandleAnchorSave = FOculusXRAnchorEventDelegates::OculusSpaceSaveComplete.AddRaw(this, &FOculusXRAnchors::HandleAnchorSaveComplete);
 		DelegateHandleAnchorSaveList = FOculusXRAnchorEventDelegates::OculusSpaceListSaveComplete.AddRaw(this, &FOculusXRAnchors::HandleAnchorSaveListComplete);
-		DelegateHandleQueryResultElement = FOculusXRAnchorEventDelegates::OculusSpaceQueryResult.AddRaw(this, &FOculusXRAnchors::HandleAnchorQueryResultElement);
+		DelegateHandleQueryResultBatch = FOculusXRAnchorEventDelegates::OculusSpaceQueryResultBatch.AddRaw(this, &FOculusXRAnchors::HandleAnchorQueryResultBatch);
 		DelegateHandleQueryComplete = FOculusXRAnchorEventDelegates::OculusSpaceQueryComplete.AddRaw(this, &FOculusXRAnchors::HandleAnchorQueryComplete);
 		DelegateHandleAnchorShare = FOculusXRAnchorEventDelegates::OculusSpaceShareComplete.AddRaw(this, &FOculusXRAnchors::HandleAnchorSharingComplete);
 		DelegateHandleAnchorsSave = FOculusXRAnchorEventDelegates::OculusAnchorsSaveComplete.AddRaw(this, &FOculusXRAnchors::HandleAnchorsSaveComplete);
@@ -39,7 +39,7 @@ namespace OculusXRAnchors
 		FOculusXRAnchorEventDelegates::OculusSpaceSetComponentStatusComplete.Remove(DelegateHandleSetComponentStatus);
 		FOculusXRAnchorEventDelegates::OculusSpaceSaveComplete.Remove(DelegateHandleAnchorSave);
 		FOculusXRAnchorEventDelegates::OculusSpaceListSaveComplete.Remove(DelegateHandleAnchorSaveList);
-		FOculusXRAnchorEventDelegates::OculusSpaceQueryResult.Remove(DelegateHandleQueryResultElement);
+		FOculusXRAnchorEventDelegates::OculusSpaceQueryResultBatch.Remove(DelegateHandleQueryResultBatch);
 		FOculusXRAnchorEventDelegates::OculusSpaceQueryComplete.Remove(DelegateHandleQueryComplete);
 		FOculusXRAnchorEventDelegates::OculusSpaceShareComplete.Remove(DelegateHandleAnchorShare);
 		FOculusXRAnchorEventDelegates::OculusAnchorsSaveComplete.Remove(DelegateHandleAnchorsSave);
@@ -843,17 +843,25 @@ namespace OculusXRAnchors
 		AnchorSaveListBindings.Remove(RequestId.GetValue());
 	}
 
-	void FOculusXRAnchors::HandleAnchorQueryResultElement(FOculusXRUInt64 RequestId, FOculusXRUInt64 Space, FOculusXRUUID UUID)
+	void FOculusXRAnchors::HandleAnchorQueryResultBatch(FOculusXRUInt64 RequestId, const TArray<FOculusXRAnchorsDiscoverResult>& Results)
 	{
 		AnchorQueryBinding* QueryResultPtr = AnchorQueryBindings.Find(RequestId.GetValue());
 		GetSharedAnchorsBinding* GetSharedResultPtr = GetSharedAnchorsBindings.Find(RequestId.GetValue());
 		if (QueryResultPtr)
 		{
-			UpdateQuerySpacesBinding(QueryResultPtr, RequestId, Space, UUID);
+			QueryResultPtr->Results.Reserve(QueryResultPtr->Results.Num() + Results.Num());
+			for (const FOculusXRAnchorsDiscoverResult& Result : Results)
+			{
+				UpdateQuerySpacesBinding(QueryResultPtr, RequestId, Result.Space, Result.UUID);
+			}
 		}
 		else if (GetSharedResultPtr)
 		{
-			UpdateGetSharedAnchorsBinding(GetSharedResultPtr, RequestId, Space, UUID);
+			GetSharedResultPtr->Results.Reserve(GetSharedResultPtr->Results.Num() + Results.Num());
+			for (const FOculusXRAnchorsDiscoverResult& Result : Results)
+			{
+				UpdateGetSharedAnchorsBinding(GetSharedResultPtr, RequestId, Result.Space, Result.UUID);
+			}
 		}
 		else
 		{
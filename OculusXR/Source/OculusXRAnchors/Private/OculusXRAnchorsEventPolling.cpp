@@ -13,52 +13,38 @@
 
 namespace OculusXRAnchors
 {
-	template <typename T>
-	void GetEventDataAs(ovrpEventDataBuffer& Buffer, T& OutEventData)
+	void FOculusXRAnchorsEventPolling::RegisterEventDelegates(OculusXRHMD::FOculusXRHMD& HMD)
 	{
-		memcpy(&OutEventData, reinterpret_cast<uint8*>(&Buffer), sizeof(T));
-	}
-
-	// For template specializations that use the legacy event padding
-	constexpr size_t LegacyOffset = 8;
-	template <typename T>
-	void GetLegacyEventDataAs(ovrpEventDataBuffer& Buffer, T& OutEventData)
-	{
-		OutEventData.EventType = Buffer.EventType;
-		memcpy(((uint8*)&OutEventData) + LegacyOffset, Buffer.EventData, sizeof(T) - LegacyOffset);
-	}
-
-#define DECLARE_EVENT_DATA_CAST_SPECIALIZATION(T)                     \
-	template <>                                                       \
-	void GetEventDataAs(ovrpEventDataBuffer& Buffer, T& OutEventData) \
-	{                                                                 \
-		GetLegacyEventDataAs<T>(Buffer, OutEventData);                \
+		// Most anchor events use the legacy layout, the runtime packs their payload right after EventType
+		const TPair<ovrpEventType, SIZE_T> Events[] = {
+			{ ovrpEventType_SpatialAnchorCreateComplete, sizeof(ovrpEventDataSpatialAnchorCreateComplete) },
+			{ ovrpEventType_SpaceSetComponentStatusComplete, sizeof(ovrpEventDataSpaceSetStatusComplete) },
+			{ ovrpEventType_SpaceQueryResults, sizeof(ovrpEventSpaceQueryResults) },
+			{ ovrpEventType_SpaceQueryComplete, sizeof(ovrpEventSpaceQueryComplete) },
+			{ ovrpEventType_SpaceSaveComplete, sizeof(ovrpEventSpaceStorageSaveResult) },
+			{ ovrpEventType_SpaceListSaveResult, sizeof(ovrpEventSpaceListSaveResult) },
+			{ ovrpEventType_SpaceEraseComplete, sizeof(ovrpEventSpaceStorageEraseResult) },
+			{ ovrpEventType_SpaceShareResult, sizeof(ovrpEventSpaceShareResult) },
+			{ ovrpEventType_SpaceDiscoveryComplete, sizeof(ovrpEventDataSpaceDiscoveryComplete) },
+			{ ovrpEventType_SpaceDiscoveryResultsAvailable, sizeof(ovrpEventSpaceDiscoveryResults) },
+			{ ovrpEventType_SpacesSaveResult, sizeof(ovrpEventSpacesSaveResult) },
+			{ ovrpEventType_SpacesEraseResult, sizeof(ovrpEventSpacesEraseResult) },
+			{ ovrpEventType_ShareSpacesComplete, 0 },
+		};
+
+		for (const TPair<ovrpEventType, SIZE_T>& Event : Events)
+		{
+			HMD.AddEventDelegate(Event.Key, OculusXRHMD::FOculusXRHMDEventDelegate::CreateStatic(&FOculusXRAnchorsEventPolling::OnEvent), Event.Value);
+		}
 	}
 
-	DECLARE_EVENT_DATA_CAST_SPECIALIZATION(ovrpEventDataSpatialAnchorCreateComplete);
-	DECLARE_EVENT_DATA_CAST_SPECIALIZATION(ovrpEventDataSpaceSetStatusComplete);
-	DECLARE_EVENT_DATA_CAST_SPECIALIZATION(ovrpEventSpaceQueryResults);
-	DECLARE_EVENT_DATA_CAST_SPECIALIZATION(ovrpEventSpaceQueryComplete);
-	DECLARE_EVENT_DATA_CAST_SPECIALIZATION(ovrpEventSpaceStorageSaveResult);
-	DECLARE_EVENT_DATA_CAST_SPECIALIZATION(ovrpEventSpaceListSaveResult);
-	DECLARE_EVENT_DATA_CAST_SPECIALIZATION(ovrpEventSpaceStorageEraseResult);
-	DECLARE_EVENT_DATA_CAST_SPECIALIZATION(ovrpEventSpaceShareResult);
-	DECLARE_EVENT_DATA_CAST_SPECIALIZATION(ovrpEventDataSpaceDiscoveryComplete);
-	DECLARE_EVENT_DATA_CAST_SPECIALIZATION(ovrpEventSpaceDiscoveryResults);
-	DECLARE_EVENT_DATA_CAST_SPECIALIZATION(ovrpEventSpacesSaveResult);
-	DECLARE_EVENT_DATA_CAST_SPECIALIZATION(ovrpEventSpacesEraseResult);
-
-	void FOculusXRAnchorsEventPolling::OnPollEvent(ovrpEventDataBuffer* EventDataBuffer, bool& EventPollResult)
+	void FOculusXRAnchorsEventPolling::OnEvent(const ovrpEventDataBuffer& buf)
 	{
-		ovrpEventDataBuffer& buf = *EventDataBuffer;
-		EventPollResult = true;
-
 		switch (buf.EventType)
 		{
 			case ovrpEventType_SpatialAnchorCreateComplete:
 			{
-				ovrpEventDataSpatialAnchorCreateComplete AnchorCreateEvent;
-				GetEventDataAs(buf, AnchorCreateEvent);
+				const ovrpEventDataSpatialAnchorCreateComplete& AnchorCreateEvent = OculusXRHMD::GetEventData<ovrpEventDataSpatialAnchorCreateComplete>(buf);
 
 				const FOculusXRUInt64 RequestId(AnchorCreateEvent.requestId);
 				const FOculusXRUInt64 Space(AnchorCreateEvent.space);
@@ -80,8 +66,7 @@ namespace OculusXRAnchors
 			}
 			case ovrpEventType_SpaceSetComponentStatusComplete:
 			{
-				ovrpEventDataSpaceSetStatusComplete SetStatusEvent;
-				GetEventDataAs(buf, SetStatusEvent);
+				const ovrpEventDataSpaceSetStatusComplete& SetStatusEvent = OculusXRHMD::GetEventData<ovrpEventDataSpaceSetStatusComplete>(buf);
 
 				// translate to BP types
 				const FOculusXRUInt64 RequestId(SetStatusEvent.requestId);
@@ -109,13 +94,13 @@ namespace OculusXRAnchors
 			}
 			case ovrpEventType_SpaceQueryResults:
 			{
-				ovrpEventSpaceQueryResults QueryEvent;
-				GetEventDataAs(buf, QueryEvent);
+				const ovrpEventSpaceQueryResults& QueryEvent = OculusXRHMD::GetEventData<ovrpEventSpaceQueryResults>(buf);
 
 				UE_LOG(LogOculusXRAnchors, Verbose, TEXT("ovrpEventType_SpaceQueryResults  Request ID: %llu"), QueryEvent.requestId);
 
+				ovrpUInt64 QueryRequestId = QueryEvent.requestId;
 				ovrpUInt32 ovrpOutCapacity = 0;
-				auto getCapacityResult = FOculusXRHMDModule::GetPluginWrapper().RetrieveSpaceQueryResults(&QueryEvent.requestId, 0, &ovrpOutCapacity, nullptr);
+				auto getCapacityResult = FOculusXRHMDModule::GetPluginWrapper().RetrieveSpaceQueryResults(&QueryRequestId, 0, &ovrpOutCapacity, nullptr);
 
 				UE_LOG(LogOculusXRAnchors, Verbose, TEXT("Space Query Results: Capacity Request -- Request ID: %llu  --  Capacity: %d  --  Result: %s"),
 					QueryEvent.requestId,
@@ -123,7 +108,7 @@ namespace OculusXRAnchors
 					*GetStringFromResult(GetResultFromOVRResult(getCapacityResult)));
 
 				std::vector<ovrpSpaceQueryResult> spaceQueryResults(ovrpOutCapacity);
-				auto getQueryResult = FOculusXRHMDModule::GetPluginWrapper().RetrieveSpaceQueryResults(&QueryEvent.requestId, spaceQueryResults.size(), &ovrpOutCapacity, spaceQueryResults.data());
+				auto getQueryResult = FOculusXRHMDModule::GetPluginWrapper().RetrieveSpaceQueryResults(&QueryRequestId, spaceQueryResults.size(), &ovrpOutCapacity, spaceQueryResults.data());
 
 				UE_LOG(LogOculusXRAnchors, Verbose, TEXT("Space Query Results: Retrieved Elements -- Request ID: %llu  --  Result: %s"),
 					QueryEvent.requestId,
@@ -138,6 +123,8 @@ namespace OculusXRAnchors
 				FOculusXRUInt64 RequestId(QueryEvent.requestId);
 				FOculusXRAnchorEventDelegates::OculusSpaceQueryResults.Broadcast(RequestId);
 
+				TArray<FOculusXRAnchorsDiscoverResult> queryResults;
+				queryResults.Reserve(spaceQueryResults.size());
 				for (const auto& queryResultElement : spaceQueryResults)
 				{
 					FOculusXRUInt64 anchorHandle(queryResultElement.space);
@@ -145,15 +132,20 @@ namespace OculusXRAnchors
 
 					UE_LOG(LogOculusXRAnchors, Verbose, TEXT("ovrpEventType_SpaceQueryResult -- Space: %llu -- UUID: %s"), anchorHandle.Value, *uuid.ToString());
 
-					FOculusXRAnchorEventDelegates::OculusSpaceQueryResult.Broadcast(RequestId, anchorHandle, uuid);
+					queryResults.Add(FOculusXRAnchorsDiscoverResult(anchorHandle, uuid));
+				}
+
+				FOculusXRAnchorEventDelegates::OculusSpaceQueryResultBatch.Broadcast(RequestId, queryResults);
+				for (const FOculusXRAnchorsDiscoverResult& queryResult : queryResults)
+				{
+					FOculusXRAnchorEventDelegates::OculusSpaceQueryResult.Broadcast(RequestId, queryResult.Space, queryResult.UUID);
 				}
 
 				break;
 			}
 			case ovrpEventType_SpaceQueryComplete:
 			{
-				ovrpEventSpaceQueryComplete QueryCompleteEvent;
-				GetEventDataAs(buf, QueryCompleteEvent);
+				const ovrpEventSpaceQueryComplete& QueryCompleteEvent = OculusXRHMD::GetEventData<ovrpEventSpaceQueryComplete>(buf);
 
 				UE_LOG(LogOculusXRAnchors, Verbose, TEXT("ovrpEventType_SpaceQueryComplete Request ID: %llu  --  Result: %d"), QueryCompleteEvent.requestId, QueryCompleteEvent.result);
 
@@ -169,8 +161,7 @@ namespace OculusXRAnchors
 			}
 			case ovrpEventType_SpaceSaveComplete:
 			{
-				ovrpEventSpaceStorageSaveResult StorageResult;
-				GetEventDataAs(buf, StorageResult);
+				const ovrpEventSpaceStorageSaveResult& StorageResult = OculusXRHMD::GetEventData<ovrpEventSpaceStorageSaveResult>(buf);
 
 				// translate to BP types
 				const FOculusXRUUID uuid(StorageResult.uuid.data);
@@ -191,8 +182,7 @@ namespace OculusXRAnchors
 			}
 			case ovrpEventType_SpaceListSaveResult:
 			{
-				ovrpEventSpaceListSaveResult SpaceListSaveResult;
-				GetEventDataAs(buf, SpaceListSaveResult);
+				const ovrpEventSpaceListSaveResult& SpaceListSaveResult = OculusXRHMD::GetEventData<ovrpEventSpaceListSaveResult>(buf);
 
 				FOculusXRUInt64 RequestId(SpaceListSaveResult.requestId);
 
@@ -205,8 +195,7 @@ namespace OculusXRAnchors
 			}
 			case ovrpEventType_SpaceEraseComplete:
 			{
-				ovrpEventSpaceStorageEraseResult SpaceEraseEvent;
-				GetEventDataAs(buf, SpaceEraseEvent);
+				const ovrpEventSpaceStorageEraseResult& SpaceEraseEvent = OculusXRHMD::GetEventData<ovrpEventSpaceStorageEraseResult>(buf);
 
 				// translate to BP types
 				const FOculusXRUUID uuid(SpaceEraseEvent.uuid.data);
@@ -227,8 +216,7 @@ namespace OculusXRAnchors
 			}
 			case ovrpEventType_SpaceShareResult:
 			{
-				ovrpEventSpaceShareResult SpaceShareSpaceResult;
-				GetEventDataAs(buf, SpaceShareSpaceResult);
+				const ovrpEventSpaceShareResult& SpaceShareSpaceResult = OculusXRHMD::GetEventData<ovrpEventSpaceShareResult>(buf);
 
 				FOculusXRUInt64 RequestId(SpaceShareSpaceResult.requestId);
 
@@ -244,8 +232,7 @@ namespace OculusXRAnchors
 			}
 			case ovrpEventType_SpaceDiscoveryComplete:
 			{
-				ovrpEventDataSpaceDiscoveryComplete SpaceDiscoveryCompleteEvent;
-				GetEventDataAs(buf, SpaceDiscoveryCompleteEvent);
+				const ovrpEventDataSpaceDiscoveryComplete& SpaceDiscoveryCompleteEvent = OculusXRHMD::GetEventData<ovrpEventDataSpaceDiscoveryComplete>(buf);
 
 				FOculusXRUInt64 RequestId(SpaceDiscoveryCompleteEvent.requestId);
 
@@ -261,8 +248,7 @@ namespace OculusXRAnchors
 			}
 			case ovrpEventType_SpaceDiscoveryResultsAvailable:
 			{
-				ovrpEventSpaceDiscoveryResults SpaceDiscoveryResultsEvent;
-				GetEventDataAs(buf, SpaceDiscoveryResultsEvent);
+				const ovrpEventSpaceDiscoveryResults& SpaceDiscoveryResultsEvent = OculusXRHMD::GetEventData<ovrpEventSpaceDiscoveryResults>(buf);
 
 				FOculusXRUInt64 RequestId(SpaceDiscoveryResultsEvent.requestId);
 
@@ -296,8 +282,7 @@ namespace OculusXRAnchors
 			}
 			case ovrpEventType_SpacesSaveResult:
 			{
-				ovrpEventSpacesSaveResult SpacesSaveEvent;
-				GetEventDataAs(buf, SpacesSaveEvent);
+				const ovrpEventSpacesSaveResult& SpacesSaveEvent = OculusXRHMD::GetEventData<ovrpEventSpacesSaveResult>(buf);
 
 				FOculusXRUInt64 RequestId(SpacesSaveEvent.requestId);
 
@@ -313,8 +298,7 @@ namespace OculusXRAnchors
 			}
 			case ovrpEventType_SpacesEraseResult:
 			{
-				ovrpEventSpacesEraseResult SpacesEraseEvent;
-				GetEventDataAs(buf, SpacesEraseEvent);
+				const ovrpEventSpacesEraseResult& SpacesEraseEvent = OculusXRHMD::GetEventData<ovrpEventSpacesEraseResult>(buf);
 
 				FOculusXRUInt64 RequestId(SpacesEraseEvent.requestId);
 				FOculusXRUInt64 Result(SpacesEraseEvent.result);
@@ -331,8 +315,7 @@ namespace OculusXRAnchors
 			}
 			case ovrpEventType_ShareSpacesComplete:
 			{
-				ovrpEventShareSpacesComplete EventData;
-				GetEventDataAs(buf, EventData);
+				const ovrpEventShareSpacesComplete& EventData = OculusXRHMD::GetEventData<ovrpEventShareSpacesComplete>(buf);
 
 				UE_LOG(LogOculusXRAnchors, Verbose, TEXT("ovrpEventType_ShareSpacesComplete  Request ID: %llu  --  Result: %s"),
 					EventData.RequestId,
@@ -344,10 +327,8 @@ namespace OculusXRAnchors
 
 				break;
 			}
-			case ovrpEventType_None:
 			default:
 			{
-				EventPollResult = false;
 				break;
 			}
 		}
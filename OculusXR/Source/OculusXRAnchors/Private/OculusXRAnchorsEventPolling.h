@@ -5,12 +5,20 @@
 #include "OculusXRAnchorTypes.h"
 #include "OculusXRPluginWrapper.h"
 
+namespace OculusXRHMD
+{
+	class FOculusXRHMD;
+}
+
 namespace OculusXRAnchors
 {
 	struct FOculusXRAnchorsEventPolling
 	{
 	public:
-		static void OnPollEvent(ovrpEventDataBuffer* EventDataBuffer, bool& EventPollResult);
+		static void RegisterEventDelegates(OculusXRHMD::FOculusXRHMD& HMD);
+
+	private:
+		static void OnEvent(const ovrpEventDataBuffer& buf);
 	};
 
 } // namespace OculusXRAnchors
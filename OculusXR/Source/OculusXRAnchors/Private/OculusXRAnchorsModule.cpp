@@ -52,7 +52,7 @@ void FOculusXRAnchorsModule::OnPostEngineInit()
 		return;
 	}
 
-	HMD->AddEventPollingDelegate(OculusXRHMD::FOculusXRHMDEventPollingDelegate::CreateStatic(&OculusXRAnchors::FOculusXRAnchorsEventPolling::OnPollEvent));
+	OculusXRAnchors::FOculusXRAnchorsEventPolling::RegisterEventDelegates(*HMD);
 }
 
 void FOculusXRAnchorsModule::AddCreateAnchorComponentInterface(IOculusXRCreateAnchorComponent* CastInterface)
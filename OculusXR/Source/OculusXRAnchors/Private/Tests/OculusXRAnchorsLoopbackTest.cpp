@@ -0,0 +1,200 @@
+// Copyright (c) Meta Platforms, Inc. and affiliates.
+
+#include "Misc/AutomationTest.h"
+#include "OculusXRAnchorFunctionsLoopback.h"
+#include "OculusXRAnchors.h"
+#include "OculusXRAnchorsLoopback.h"
+#include "OculusXRAnchorDelegates.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace OculusXRAnchorsLoopbackTest
+{
+	// Delivers the events queued with no latency
+	static void PumpEvents()
+	{
+		FTSTicker::GetCoreTicker().Tick(0.0f);
+	}
+} // namespace OculusXRAnchorsLoopbackTest
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FOculusXRAnchorsLoopbackShareWithGroupTest,
+	"OculusXR.Anchors.Loopback.ShareWithGroup",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FOculusXRAnchorsLoopbackShareWithGroupTest::RunTest(const FString& Parameters)
+{
+	using namespace OculusXRAnchorsLoopbackTest;
+
+	FOculusXRAnchorFunctionsLoopback Loopback(FOculusXRLoopbackSettings{});
+	const FTransform AnchorTransform(FVector(100, 0, 50));
+
+	uint64 CreatedHandle = 0;
+	const FDelegateHandle CreateHandle = FOculusXRAnchorEventDelegates::OculusSpatialAnchorCreateComplete.AddLambda(
+		[&CreatedHandle](FOculusXRUInt64 RequestId, EOculusXRAnchorResult::Type Result, FOculusXRUInt64 Space, FOculusXRUUID Uuid) {
+			CreatedHandle = Result == EOculusXRAnchorResult::Success ? Space.GetValue() : 0;
+		});
+
+	uint64 RequestId = 0;
+	TestTrue(TEXT("Create starts"), Loopback.CreateAnchor(AnchorTransform, RequestId, FTransform::Identity) == EOculusXRAnchorResult::Success);
+	TestEqual(TEXT("Create completes on a later tick"), CreatedHandle, uint64(0));
+	PumpEvents();
+	FOculusXRAnchorEventDelegates::OculusSpatialAnchorCreateComplete.Remove(CreateHandle);
+	if (!TestNotEqual(TEXT("Created anchor handle"), CreatedHandle, uint64(0)))
+	{
+		return false;
+	}
+
+	FOculusXRUUID Group;
+	Group.UUIDBytes[0] = 1;
+	TestTrue(TEXT("Share starts"), Loopback.ShareAnchors({ CreatedHandle }, TArray<FOculusXRUUID>{ Group }, RequestId) == EOculusXRAnchorResult::Success);
+	PumpEvents();
+
+	const FOculusXRUUID PeerAnchor = Loopback.AddSimulatedSharedAnchor(Group, FTransform::Identity);
+	TestTrue(TEXT("Simulated anchor UUID is valid"), PeerAnchor.IsValidUUID());
+
+	TArray<FOculusXRAnchorsDiscoverResult> QueryResults;
+	EOculusXRAnchorResult::Type QueryResult = EOculusXRAnchorResult::Failure;
+	const FDelegateHandle BatchHandle = FOculusXRAnchorEventDelegates::OculusSpaceQueryResultBatch.AddLambda(
+		[&QueryResults](FOculusXRUInt64 RequestId, const TArray<FOculusXRAnchorsDiscoverResult>& Results) {
+			QueryResults.Append(Results);
+		});
+	const FDelegateHandle CompleteHandle = FOculusXRAnchorEventDelegates::OculusSpaceQueryComplete.AddLambda(
+		[&QueryResult](FOculusXRUInt64 RequestId, EOculusXRAnchorResult::Type Result) {
+			QueryResult = Result;
+		});
+
+	FOculusXRSpaceQueryInfo QueryInfo;
+	QueryInfo.FilterType = EOculusXRSpaceQueryFilterType::FilterByGroup;
+	QueryInfo.GroupUUIDFilter = Group;
+	TestTrue(TEXT("Query starts"), Loopback.QueryAnchors(QueryInfo, RequestId) == EOculusXRAnchorResult::Success);
+	PumpEvents();
+
+	FOculusXRAnchorEventDelegates::OculusSpaceQueryResultBatch.Remove(BatchHandle);
+	FOculusXRAnchorEventDelegates::OculusSpaceQueryComplete.Remove(CompleteHandle);
+
+	TestTrue(TEXT("Query result"), QueryResult == EOculusXRAnchorResult::Success);
+	TestEqual(TEXT("Anchors shared with the group"), QueryResults.Num(), 2);
+	for (const FOculusXRAnchorsDiscoverResult& Result : QueryResults)
+	{
+		FTransform Transform;
+		FOculusXRAnchorLocationFlags Flags;
+		TestTrue(TEXT("Query result is loaded"), Loopback.TryGetAnchorTransform(Result.Space, Transform, Flags, EOculusXRAnchorSpace::World) == EOculusXRAnchorResult::Success);
+		if (Result.Space.GetValue() == CreatedHandle)
+		{
+			TestTrue(TEXT("Own anchor keeps its transform"), Transform.Equals(AnchorTransform));
+		}
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FOculusXRAnchorsLoopbackFailureTest,
+	"OculusXR.Anchors.Loopback.FailureRate",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FOculusXRAnchorsLoopbackFailureTest::RunTest(const FString& Parameters)
+{
+	using namespace OculusXRAnchorsLoopbackTest;
+
+	FOculusXRLoopbackSettings Settings;
+	Settings.FailureRate = 1.0f;
+	FOculusXRAnchorFunctionsLoopback Loopback(Settings);
+
+	EOculusXRAnchorResult::Type CreateResult = EOculusXRAnchorResult::Success;
+	const FDelegateHandle CreateHandle = FOculusXRAnchorEventDelegates::OculusSpatialAnchorCreateComplete.AddLambda(
+		[&CreateResult](FOculusXRUInt64 RequestId, EOculusXRAnchorResult::Type Result, FOculusXRUInt64 Space, FOculusXRUUID Uuid) {
+			CreateResult = Result;
+		});
+
+	uint64 RequestId = 0;
+	TestTrue(TEXT("Create starts"), Loopback.CreateAnchor(FTransform::Identity, RequestId, FTransform::Identity) == EOculusXRAnchorResult::Success);
+	PumpEvents();
+	FOculusXRAnchorEventDelegates::OculusSpatialAnchorCreateComplete.Remove(CreateHandle);
+
+	TestTrue(TEXT("Create fails"), CreateResult == EOculusXRAnchorResult::Failure_SpaceNetworkRequestFailed);
+	TestTrue(TEXT("Unknown handles fail synchronously"), Loopback.SaveAnchors({ 1 }, RequestId) == EOculusXRAnchorResult::Failure_InvalidParameter);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FOculusXRAnchorsLoopbackPublicApiTest,
+	"OculusXR.Anchors.Loopback.PublicApiRoundTrip",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FOculusXRAnchorsLoopbackPublicApiTest::RunTest(const FString& Parameters)
+{
+	using namespace OculusXRAnchors;
+	using namespace OculusXRAnchorsLoopbackTest;
+
+	const bool bWasEnabled = FAnchorsLoopback::IsEnabled();
+	FAnchorsLoopback::Enable();
+	FAnchorsLoopback::Reset();
+
+	FOculusXRUUID PeerGroup;
+	PeerGroup.UUIDBytes[0] = 1;
+	FOculusXRUUID OwnGroup;
+	OwnGroup.UUIDBytes[0] = 2;
+	const FOculusXRUUID PeerAnchor = FAnchorsLoopback::AddSimulatedSharedAnchor(PeerGroup, FTransform(FVector(0, 100, 0)));
+
+	// Retrieves the anchors shared with a group through FOculusXRAnchors, returns false if the request did not succeed
+	auto GetSharedAnchors = [this](const FOculusXRUUID& Group, TArray<FOculusXRAnchor>& OutAnchors) {
+		bool bCompleted = false;
+		bool bSucceeded = false;
+		FOculusXRAnchors::GetSharedAnchorsAsync(Group, {}, FGetAnchorsSharedWithGroup::FCompleteDelegate::CreateLambda([&](const FGetAnchorsSharedWithGroup::FResultType& Result) {
+			bCompleted = true;
+			bSucceeded = Result.IsSuccess();
+			if (bSucceeded)
+			{
+				OutAnchors = Result.GetValue();
+			}
+		}));
+		PumpEvents();
+		TestTrue(TEXT("Get shared anchors completes"), bCompleted);
+		return bSucceeded;
+	};
+
+	// Anchor shared by a peer
+	TArray<FOculusXRAnchor> PeerAnchors;
+	TestTrue(TEXT("Get anchors shared with the peer group"), GetSharedAnchors(PeerGroup, PeerAnchors));
+	if (!TestEqual(TEXT("Anchors shared with the peer group"), PeerAnchors.Num(), 1))
+	{
+		FAnchorsLoopback::Reset();
+		if (!bWasEnabled)
+		{
+			FAnchorsLoopback::Disable();
+		}
+		return false;
+	}
+	TestTrue(TEXT("Retrieved the peer anchor"), PeerAnchors[0].Uuid == PeerAnchor);
+
+	// Shared again with another group
+	bool bShareCompleted = false;
+	bool bShareSucceeded = false;
+	FOculusXRAnchors::ShareAnchorsAsync({ PeerAnchors[0].AnchorHandle }, { OwnGroup }, FShareAnchorsWithGroups::FCompleteDelegate::CreateLambda([&](const FShareAnchorsWithGroups::FResultType& Result) {
+		bShareCompleted = true;
+		bShareSucceeded = Result.IsSuccess();
+	}));
+	TestFalse(TEXT("Share completes on a later tick"), bShareCompleted);
+	PumpEvents();
+	TestTrue(TEXT("Share completes"), bShareCompleted);
+	TestTrue(TEXT("Share result"), bShareSucceeded);
+
+	// And retrieved from it
+	TArray<FOculusXRAnchor> OwnAnchors;
+	TestTrue(TEXT("Get anchors shared with the own group"), GetSharedAnchors(OwnGroup, OwnAnchors));
+	TestEqual(TEXT("Anchors shared with the own group"), OwnAnchors.Num(), 1);
+	TestTrue(TEXT("Round trip keeps the anchor UUID"), OwnAnchors.Num() == 1 && OwnAnchors[0].Uuid == PeerAnchor);
+
+	FAnchorsLoopback::Reset();
+	if (!bWasEnabled)
+	{
+		FAnchorsLoopback::Disable();
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,92 @@
+// Copyright (c) Meta Platforms, Inc. and affiliates.
+
+#include "OculusXRAnchorMetadataCache.h"
+
+namespace XRAnchors
+{
+	FAnchorMetadata& FAnchorMetadataCache::FindOrAdd(uint64 Handle, const FOculusXRUUID& Uuid)
+	{
+		FAnchorMetadata& entry = FindOrAdd(Handle);
+		if (entry.Uuid != Uuid)
+		{
+			if (entry.Uuid.IsValidUUID())
+			{
+				HandlesByUuid.Remove(entry.Uuid);
+			}
+			entry.Uuid = Uuid;
+			HandlesByUuid.Add(Uuid, Handle);
+		}
+		return entry;
+	}
+
+	FAnchorMetadata& FAnchorMetadataCache::FindOrAdd(uint64 Handle)
+	{
+		FAnchorMetadata* entry = Entries.Find(Handle);
+		if (entry == nullptr)
+		{
+			entry = &Entries.Add(Handle);
+			entry->Handle = Handle;
+		}
+		return *entry;
+	}
+
+	FAnchorMetadata* FAnchorMetadataCache::Find(uint64 Handle)
+	{
+		return Entries.Find(Handle);
+	}
+
+	FAnchorMetadata* FAnchorMetadataCache::FindByUuid(const FOculusXRUUID& Uuid)
+	{
+		const uint64* handle = HandlesByUuid.Find(Uuid);
+		return handle ? Entries.Find(*handle) : nullptr;
+	}
+
+	void FAnchorMetadataCache::Remove(uint64 Handle)
+	{
+		FAnchorMetadata entry;
+		if (Entries.RemoveAndCopyValue(Handle, entry) && entry.Uuid.IsValidUUID())
+		{
+			HandlesByUuid.Remove(entry.Uuid);
+		}
+	}
+
+	void FAnchorMetadataCache::RemoveByUuid(const FOculusXRUUID& Uuid)
+	{
+		uint64 handle;
+		if (HandlesByUuid.RemoveAndCopyValue(Uuid, handle))
+		{
+			Entries.Remove(handle);
+		}
+	}
+
+	void FAnchorMetadataCache::SetComponentStatus(uint64 Handle, EOculusXRSpaceComponentType ComponentType, bool bEnabled, bool bChangePending)
+	{
+		FAnchorComponentStatus& status = FindOrAdd(Handle).ComponentStatus.FindOrAdd(ComponentType);
+		status.bEnabled = bEnabled;
+		status.bChangePending = bChangePending;
+	}
+
+	void FAnchorMetadataCache::InvalidateComponentStatus(uint64 Handle, EOculusXRSpaceComponentType ComponentType)
+	{
+		if (FAnchorMetadata* entry = Entries.Find(Handle))
+		{
+			entry->ComponentStatus.Remove(ComponentType);
+		}
+	}
+
+	void FAnchorMetadataCache::InvalidateSceneData()
+	{
+		for (auto& it : Entries)
+		{
+			it.Value.SemanticLabels.Reset();
+			it.Value.PlaneBounds.Reset();
+			it.Value.VolumeBounds.Reset();
+		}
+	}
+
+	void FAnchorMetadataCache::Reset()
+	{
+		Entries.Reset();
+		HandlesByUuid.Reset();
+	}
+} // namespace XRAnchors
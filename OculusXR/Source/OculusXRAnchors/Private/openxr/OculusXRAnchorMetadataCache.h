@@ -0,0 +1,63 @@
+// Copyright (c) Meta Platforms, Inc. and affiliates.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "OculusXRAnchorTypes.h"
+
+namespace XRAnchors
+{
+	struct FAnchorComponentStatus
+	{
+		bool bEnabled = false;
+		bool bChangePending = false;
+	};
+
+	// Everything we know locally about one anchor. Unset optionals have not been read from the runtime yet.
+	struct FAnchorMetadata
+	{
+		uint64 Handle = 0;
+		FOculusXRUUID Uuid;
+
+		TOptional<TArray<EOculusXRSpaceComponentType>> SupportedComponents;
+		TMap<EOculusXRSpaceComponentType, FAnchorComponentStatus> ComponentStatus;
+
+		TOptional<TArray<FString>> SemanticLabels;
+
+		// Scene plane/volume bounds in UE coordinates, as returned by the scene functions
+		TOptional<TPair<FVector, FVector>> PlaneBounds;
+		TOptional<TPair<FVector, FVector>> VolumeBounds;
+
+		TOptional<FTransform> LastPose;
+	};
+
+	/**
+	 * Per session cache of anchor metadata, keyed by handle and UUID. Filled when query or discovery results arrive
+	 * so listeners can read components, labels and bounds without a runtime round trip per anchor. Game thread only.
+	 */
+	class OCULUSXRANCHORS_API FAnchorMetadataCache
+	{
+	public:
+		FAnchorMetadata& FindOrAdd(uint64 Handle, const FOculusXRUUID& Uuid);
+		FAnchorMetadata& FindOrAdd(uint64 Handle);
+		FAnchorMetadata* Find(uint64 Handle);
+		FAnchorMetadata* FindByUuid(const FOculusXRUUID& Uuid);
+
+		void Remove(uint64 Handle);
+		void RemoveByUuid(const FOculusXRUUID& Uuid);
+
+		void SetComponentStatus(uint64 Handle, EOculusXRSpaceComponentType ComponentType, bool bEnabled, bool bChangePending);
+		void InvalidateComponentStatus(uint64 Handle, EOculusXRSpaceComponentType ComponentType);
+
+		// Drops labels and bounds of every anchor, used when the scene model changes
+		void InvalidateSceneData();
+
+		void Reset();
+
+		int32 Num() const { return Entries.Num(); }
+
+	private:
+		TMap<uint64, FAnchorMetadata> Entries;
+		TMap<FOculusXRUUID, uint64> HandlesByUuid;
+	};
+} // namespace XRAnchors
@@ -135,6 +135,10 @@ namespace XRAnchors
 	void FAnchorsXR::OnDestroySession(XrSession InSession)
 	{
 		OpenXRHMD = nullptr;
+
+		// Handles are only valid for the session that created them
+		MetadataCache.Reset();
+		PendingErases.Reset();
 	}
 
 	void FAnchorsXR::OnEvent(XrSession InSession, const XrEventDataBaseHeader* InHeader)
@@ -175,6 +179,15 @@ namespace XRAnchors
 			UE_LOG(LogOculusXRAnchors, Verbose, TEXT("						Type:      %d"), event->componentType);
 			UE_LOG(LogOculusXRAnchors, Verbose, TEXT("						Enabled:   %d"), event->enabled);
 
+			if (XR_SUCCEEDED(event->result))
+			{
+				MetadataCache.SetComponentStatus((uint64)event->space, OculusXRAnchors::ToComponentType(event->componentType), (bool)event->enabled, false);
+			}
+			else
+			{
+				MetadataCache.InvalidateComponentStatus((uint64)event->space, OculusXRAnchors::ToComponentType(event->componentType));
+			}
+
 			FOculusXRAnchorEventDelegates::OculusSpaceSetComponentStatusComplete.Broadcast(
 				event->requestId,
 				OculusXRAnchors::GetResultFromXrResult(event->result),
@@ -240,6 +253,11 @@ namespace XRAnchors
 			UE_LOG(LogOculusXRAnchors, Verbose, TEXT("						Uuid:      %s"), *FOculusXRUUID(event->uuid.data).ToString());
 			UE_LOG(LogOculusXRAnchors, Verbose, TEXT("						Location:  %d"), event->location);
 
+			if (XR_SUCCEEDED(event->result))
+			{
+				MetadataCache.RemoveByUuid(event->uuid.data);
+			}
+
 			FOculusXRAnchorEventDelegates::OculusSpaceEraseComplete.Broadcast(
 				event->requestId,
 				OculusXRAnchors::GetResultFromXrResult(event->result),
@@ -255,6 +273,19 @@ namespace XRAnchors
 			UE_LOG(LogOculusXRAnchors, Verbose, TEXT("						RequestId: %llu"), event->requestId);
 			UE_LOG(LogOculusXRAnchors, Verbose, TEXT("						Result:    %d"), event->result);
 
+			FPendingErase pendingErase;
+			if (PendingErases.RemoveAndCopyValue(event->requestId, pendingErase) && XR_SUCCEEDED(event->result))
+			{
+				for (const FOculusXRUInt64& handle : pendingErase.Handles)
+				{
+					MetadataCache.Remove(handle.GetValue());
+				}
+				for (const FOculusXRUUID& uuid : pendingErase.Uuids)
+				{
+					MetadataCache.RemoveByUuid(uuid);
+				}
+			}
+
 			FOculusXRAnchorEventDelegates::OculusAnchorsEraseComplete.Broadcast(
 				event->requestId,
 				OculusXRAnchors::GetResultFromXrResult(event->result));
@@ -316,16 +347,25 @@ namespace XRAnchors
 			UE_LOG(LogOculusXRAnchors, Verbose, TEXT("    RequestId: %llu"), event->requestId);
 			UE_LOG(LogOculusXRAnchors, Verbose, TEXT("    Result: %d"), getDataResult);
 
-			FOculusXRAnchorEventDelegates::OculusSpaceQueryResults.Broadcast(event->requestId);
+			TArray<FOculusXRAnchorsDiscoverResult> outputArray;
+			outputArray.Reserve(resultArray.Num());
 			for (const auto& it : resultArray)
 			{
 				UE_LOG(LogOculusXRAnchors, Verbose, TEXT("    Anchor(%llu / %s)"),
 					it.space, *FOculusXRUUID(it.uuid.data).ToString());
+				outputArray.Add(FOculusXRAnchorsDiscoverResult((uint64)it.space, it.uuid.data));
+			}
 
-				FOculusXRAnchorEventDelegates::OculusSpaceQueryResult.Broadcast(
-					event->requestId,
-					(uint64)it.space,
-					it.uuid.data);
+			if (XR_SUCCEEDED(getDataResult))
+			{
+				CacheQueryResults(outputArray);
+			}
+
+			FOculusXRAnchorEventDelegates::OculusSpaceQueryResults.Broadcast(event->requestId);
+			FOculusXRAnchorEventDelegates::OculusSpaceQueryResultBatch.Broadcast(event->requestId, outputArray);
+			for (const auto& it : outputArray)
+			{
+				FOculusXRAnchorEventDelegates::OculusSpaceQueryResult.Broadcast(event->requestId, it.Space, it.UUID);
 			}
 		}
 		else if (InHeader->type == XR_TYPE_EVENT_DATA_SPACE_DISCOVERY_COMPLETE_META)
@@ -390,6 +430,8 @@ namespace XRAnchors
 				return;
 			}
 
+			CacheQueryResults(outputArray);
+
 			FOculusXRAnchorEventDelegates::OculusAnchorsDiscoverResults.Broadcast(
 				event->requestId,
 				outputArray);
@@ -488,6 +530,8 @@ namespace XRAnchors
 			return XR_ERROR_VALIDATION_FAILURE;
 		}
 
+		MetadataCache.Remove(AnchorHandle);
+
 		return xrDestroySpace((XrSpace)AnchorHandle);
 	}
 
@@ -528,6 +572,8 @@ namespace XRAnchors
 				FQuat outOrientation = baseOrientation.Inverse() * inOrientation;
 				outOrientation.Normalize();
 
+				MetadataCache.FindOrAdd(AnchorHandle).LastPose = FTransform(outOrientation, outPosition);
+
 				switch (Space)
 				{
 					case EOculusXRAnchorSpace::World:
@@ -589,6 +635,11 @@ namespace XRAnchors
 		{
 			UE_LOG(LogOculusXRAnchors, Warning, TEXT("[SetAnchorComponentStatus] Set space component status failed. Result: %d"), result);
 		}
+		else
+		{
+			// Pending until the set status complete event arrives, so repeated requests for the same state stay local
+			MetadataCache.SetComponentStatus(AnchorHandle, ComponentType, !Enable, true);
+		}
 
 		return result;
 	}
@@ -607,6 +658,15 @@ namespace XRAnchors
 			return XR_ERROR_VALIDATION_FAILURE;
 		}
 
+		const FAnchorMetadata* metadata = MetadataCache.Find(AnchorHandle);
+		const FAnchorComponentStatus* cachedStatus = metadata ? metadata->ComponentStatus.Find(ComponentType) : nullptr;
+		if (cachedStatus != nullptr)
+		{
+			OutEnabled = cachedStatus->bEnabled;
+			OutChangePending = cachedStatus->bChangePending;
+			return XR_SUCCESS;
+		}
+
 		XrSpaceComponentStatusFB status{ XR_TYPE_SPACE_COMPONENT_STATUS_FB, nullptr };
 		auto result = xrGetSpaceComponentStatusFB((XrSpace)AnchorHandle, OculusXRAnchors::ToComponentType(ComponentType), &status);
 		if (!XR_SUCCEEDED(result))
@@ -617,6 +677,12 @@ namespace XRAnchors
 		{
 			OutEnabled = (bool)status.enabled;
 			OutChangePending = (bool)status.changePending;
+
+			// A change we did not request ourselves has no completion event to clear it, so only settled states are cached
+			if (!OutChangePending)
+			{
+				MetadataCache.SetComponentStatus(AnchorHandle, ComponentType, OutEnabled, false);
+			}
 		}
 
 		return result;
@@ -636,6 +702,13 @@ namespace XRAnchors
 			return XR_ERROR_VALIDATION_FAILURE;
 		}
 
+		const FAnchorMetadata* metadata = MetadataCache.Find(AnchorHandle);
+		if (metadata != nullptr && metadata->SupportedComponents.IsSet())
+		{
+			OutSupportedTypes.Append(metadata->SupportedComponents.GetValue());
+			return XR_SUCCESS;
+		}
+
 		uint32 input = 0;
 		uint32 output = 0;
 
@@ -656,11 +729,18 @@ namespace XRAnchors
 		auto dataResult = xrEnumerateSpaceSupportedComponentsFB((XrSpace)AnchorHandle, input, &output, components.GetData());
 		UE_LOG(LogOculusXRAnchors, Verbose, TEXT("[GetSupportedAnchorComponents] -- Data Retrieval"));
 		UE_LOG(LogOculusXRAnchors, Verbose, TEXT("    Result: %d"), dataResult);
+		TArray<EOculusXRSpaceComponentType> supportedTypes;
 		for (auto& it : components)
 		{
 			auto ueComponentType = OculusXRAnchors::ToComponentType(it);
 			UE_LOG(LogOculusXRAnchors, Verbose, TEXT("    Component Type: %s"), *OculusXRAnchors::ToString(ueComponentType));
-			OutSupportedTypes.Add(ueComponentType);
+			supportedTypes.Add(ueComponentType);
+		}
+
+		OutSupportedTypes.Append(supportedTypes);
+		if (XR_SUCCEEDED(dataResult))
+		{
+			MetadataCache.FindOrAdd(AnchorHandle).SupportedComponents = MoveTemp(supportedTypes);
 		}
 
 		return dataResult;
@@ -1267,10 +1347,30 @@ namespace XRAnchors
 		{
 			UE_LOG(LogOculusXRAnchors, Warning, TEXT("[EraseAnchors] Erase anchors failed. Result: %d"), result);
 		}
+		else
+		{
+			PendingErases.Add(OutRequestId, { AnchorHandles, UUIDs });
+		}
 
 		return result;
 	}
 
+	void FAnchorsXR::CacheQueryResults(const TArray<FOculusXRAnchorsDiscoverResult>& Results)
+	{
+		// Enumerate the supported components once per anchor as it arrives so the listeners enabling
+		// components on every result are served from the cache
+		TArray<EOculusXRSpaceComponentType> supportedTypes;
+		for (const FOculusXRAnchorsDiscoverResult& it : Results)
+		{
+			const FAnchorMetadata& metadata = MetadataCache.FindOrAdd(it.Space.GetValue(), it.UUID);
+			if (!metadata.SupportedComponents.IsSet())
+			{
+				supportedTypes.Reset();
+				GetSupportedAnchorComponents(it.Space.GetValue(), supportedTypes);
+			}
+		}
+	}
+
 	void FAnchorsXR::InitOpenXRFunctions(XrInstance InInstance)
 	{
 		// XR_FB_Spatial_Entity
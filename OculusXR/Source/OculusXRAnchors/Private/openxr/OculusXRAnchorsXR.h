@@ -5,6 +5,7 @@
 #include "OculusXRAnchorsXRIncludes.h"
 #include "IOpenXRExtensionPlugin.h"
 #include "OculusXRAnchorTypes.h"
+#include "OculusXRAnchorMetadataCache.h"
 
 #define LOCTEXT_NAMESPACE "OculusXRAnchors"
 
@@ -87,8 +88,17 @@ namespace XRAnchors
 		XrResult EraseAnchor(uint64 AnchorHandle, EOculusXRSpaceStorageLocation StorageLocation, uint64& OutRequestId);
 		XrResult EraseAnchors(const TArray<FOculusXRUInt64>& AnchorHandles, const TArray<FOculusXRUUID>& UUIDs, uint64& OutRequestId);
 
+		FAnchorMetadataCache& GetMetadataCache() { return MetadataCache; }
+
 	private:
 		void InitOpenXRFunctions(XrInstance InInstance);
+		void CacheQueryResults(const TArray<FOculusXRAnchorsDiscoverResult>& Results);
+
+		struct FPendingErase
+		{
+			TArray<FOculusXRUInt64> Handles;
+			TArray<FOculusXRUUID> Uuids;
+		};
 
 		bool bExtAnchorsEnabled;
 		bool bExtContainerEnabled;
@@ -103,6 +113,9 @@ namespace XRAnchors
 		bool bExtGroupSharingEnabled;
 
 		FOpenXRHMD* OpenXRHMD;
+
+		FAnchorMetadataCache MetadataCache;
+		TMap<uint64, FPendingErase> PendingErases;
 	};
 
 } // namespace XRAnchors
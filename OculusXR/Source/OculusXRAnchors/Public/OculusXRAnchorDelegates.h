@@ -53,6 +53,19 @@ public:
 	DECLARE_MULTICAST_DELEGATE_ThreeParams(FOculusXRSpaceQueryResultDelegate, FOculusXRUInt64 /*requestId*/, FOculusXRUInt64 /* space*/, FOculusXRUUID /*uuid*/);
 	static OCULUSXRANCHORS_API FOculusXRSpaceQueryResultDelegate OculusSpaceQueryResult;
 
+	/* SpaceQueryResultBatch (no ovrp event type)
+	 *
+	 *        SpaceQueryResultBatch
+	 * Prefix:
+	 * FOculusXRSpaceQueryResultBatch
+	 * Suffix:
+	 * FOculusXRSpaceQueryResultBatchDelegate
+	 *
+	 * All results of one SpaceQueryResults event, broadcast before the per result OculusSpaceQueryResult.
+	 */
+	DECLARE_MULTICAST_DELEGATE_TwoParams(FOculusXRSpaceQueryResultBatchDelegate, FOculusXRUInt64 /*requestId*/, const TArray<FOculusXRAnchorsDiscoverResult>& /*results*/);
+	static OCULUSXRANCHORS_API FOculusXRSpaceQueryResultBatchDelegate OculusSpaceQueryResultBatch;
+
 	/* ovrpEventType_SpaceQueryComplete
 	 *
 	 *        SpaceQueryComplete
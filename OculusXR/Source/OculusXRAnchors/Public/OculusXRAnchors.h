@@ -73,7 +73,7 @@ namespace OculusXRAnchors
 		void HandleAnchorSaveComplete(FOculusXRUInt64 RequestId, FOculusXRUInt64 Space, bool Success, EOculusXRAnchorResult::Type Result, FOculusXRUUID UUID);
 		void HandleAnchorSaveListComplete(FOculusXRUInt64 RequestId, EOculusXRAnchorResult::Type Result);
 
-		void HandleAnchorQueryResultElement(FOculusXRUInt64 RequestId, FOculusXRUInt64 Space, FOculusXRUUID UUID);
+		void HandleAnchorQueryResultBatch(FOculusXRUInt64 RequestId, const TArray<FOculusXRAnchorsDiscoverResult>& Results);
 		void UpdateQuerySpacesBinding(AnchorQueryBinding* Binding, FOculusXRUInt64 RequestId, FOculusXRUInt64 Space, FOculusXRUUID UUID);
 		void UpdateGetSharedAnchorsBinding(GetSharedAnchorsBinding* Binding, FOculusXRUInt64 RequestId, FOculusXRUInt64 Space, FOculusXRUUID UUID);
 
@@ -194,7 +194,7 @@ namespace OculusXRAnchors
 		FDelegateHandle DelegateHandleAnchorSave;
 		FDelegateHandle DelegateHandleAnchorSaveList;
 		FDelegateHandle DelegateHandleQueryResultsBegin;
-		FDelegateHandle DelegateHandleQueryResultElement;
+		FDelegateHandle DelegateHandleQueryResultBatch;
 		FDelegateHandle DelegateHandleQueryComplete;
 		FDelegateHandle DelegateHandleAnchorShare;
 		FDelegateHandle DelegateHandleAnchorsSave;
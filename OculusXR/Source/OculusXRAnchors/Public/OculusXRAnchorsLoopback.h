@@ -0,0 +1,97 @@
+// Copyright (c) Meta Platforms, Inc. and affiliates.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "Math/RandomStream.h"
+#include "OculusXRAnchorTypes.h"
+
+// Simulated runtime behavior of the in-process loopback backends
+struct FOculusXRLoopbackSettings
+{
+	// Delay before the events of a request are delivered
+	float LatencySeconds = 0.0f;
+
+	// Random extra delay, up to this value, added to LatencySeconds
+	float LatencyJitterSeconds = 0.0f;
+
+	// Probability in [0, 1] that an asynchronous request completes with a failure
+	float FailureRate = 0.0f;
+
+	// Seed of the random stream so failures, jitter and generated UUIDs are reproducible
+	int32 RandomSeed = 0;
+};
+
+/**
+ * Delivers simulated runtime events from the core ticker once their latency has elapsed.
+ * All events of one request are delivered by one callback so they keep their order. Game thread only.
+ */
+class OCULUSXRANCHORS_API FOculusXRLoopbackEventQueue
+{
+public:
+	explicit FOculusXRLoopbackEventQueue(const FOculusXRLoopbackSettings& InSettings);
+	~FOculusXRLoopbackEventQueue();
+
+	void SetSettings(const FOculusXRLoopbackSettings& InSettings);
+	const FOculusXRLoopbackSettings& GetSettings() const { return Settings; }
+
+	// Rolls whether the next request fails according to the failure rate
+	bool ShouldFail();
+	uint64 NextRequestId() { return ++LastRequestId; }
+	FOculusXRUUID NewUuid();
+
+	void Deliver(TFunction<void()>&& Event);
+
+	// Drops events that were not delivered yet
+	void Reset();
+	int32 NumPending() const { return PendingEvents.Num(); }
+
+private:
+	struct FPendingEvent
+	{
+		double DueTime;
+		uint64 Sequence;
+		TFunction<void()> Event;
+
+		bool operator<(const FPendingEvent& Other) const
+		{
+			return DueTime < Other.DueTime || (DueTime == Other.DueTime && Sequence < Other.Sequence);
+		}
+	};
+
+	bool Tick(float DeltaTime);
+
+	FOculusXRLoopbackSettings Settings;
+	FRandomStream Random;
+	uint64 LastRequestId = 0;
+	uint64 LastSequence = 0;
+	TArray<FPendingEvent> PendingEvents;
+	FTSTicker::FDelegateHandle TickerHandle;
+};
+
+namespace OculusXRAnchors
+{
+	/**
+	 * In-process anchor backend that needs no runtime or headset. Anchors created, saved and shared through FOculusXRAnchors
+	 * are kept in memory and their events are delivered after the configured latency, so sharing flows can run in automation tests.
+	 * It can also be selected at startup with the -OculusXRLoopback command line switch.
+	 */
+	class OCULUSXRANCHORS_API FAnchorsLoopback
+	{
+	public:
+		// Routes FOculusXRAnchors through the loopback backend until Disable() is called
+		static void Enable(const FOculusXRLoopbackSettings& Settings = FOculusXRLoopbackSettings());
+
+		// Must not be called from a handler of a loopback event
+		static void Disable();
+		static bool IsEnabled();
+		static void SetSettings(const FOculusXRLoopbackSettings& Settings);
+
+		// Adds an anchor shared with a group by a simulated peer, returned by queries filtered by that group
+		static FOculusXRUUID AddSimulatedSharedAnchor(const FOculusXRUUID& Group, const FTransform& Transform);
+
+		// Drops all anchors, shares and undelivered events
+		static void Reset();
+	};
+} // namespace OculusXRAnchors
@@ -54,7 +54,7 @@ namespace OculusXRAnchors
 
 	private:
 		static void OnQueryComplete(FOculusXRUInt64 RequestId, EOculusXRAnchorResult::Type Result);
-		static void OnQueryResultAvailable(FOculusXRUInt64 RequestId, FOculusXRUInt64 AnchorHandle, FOculusXRUUID AnchorUuid);
+		static void OnQueryResultsAvailable(FOculusXRUInt64 RequestId, const TArray<FOculusXRAnchorsDiscoverResult>& Results);
 
 		FOculusXRUUID Group;
 		TArray<FOculusXRUUID> RequestedAnchors;
@@ -4,8 +4,8 @@
 #include "OculusXRColocationModule.h"
 #include "OculusXRColocationTypes.h"
 #include "OculusXRColocationUtil.h"
+#include "OculusXRColocationFunctions.h"
 #include "OculusXRAsyncRequestSystem.h"
-#include "OculusXRHMDModule.h"
 
 namespace OculusXRColocation
 {
@@ -22,10 +22,9 @@ namespace OculusXRColocation
 	EColocationResult FColocation::StopDiscoverSessions(TSharedPtr<FDiscoverSessionsRequest> Request)
 	{
 		uint64 requestId = Request->GetRequestId().Id;
-		ovrpResult result = FOculusXRHMDModule::GetPluginWrapper().StopColocationDiscovery(&requestId);
-		UE_LOG(LogOculusXRColocation, Log, TEXT("Stopping colocation session discovery. RequestID: %llu, Launch async result: %d"), Request->GetRequestId().Id, result);
+		EColocationResult colocationResult = IOculusXRColocationFunctions::GetOculusXRColocationFunctionsImpl()->StopColocationDiscovery(requestId);
+		UE_LOG(LogOculusXRColocation, Log, TEXT("Stopping colocation session discovery. RequestID: %llu, Launch async result: %s"), Request->GetRequestId().Id, *ToString(colocationResult));
 
-		EColocationResult colocationResult = GetResult(result);
 		if (colocationResult != EColocationResult::Success)
 		{
 			UE_LOG(LogOculusXRColocation, Warning, TEXT("Failed to stop local group discovery."));
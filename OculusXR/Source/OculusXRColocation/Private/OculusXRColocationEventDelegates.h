@@ -27,6 +27,6 @@ public:
 	DECLARE_MULTICAST_DELEGATE_TwoParams(FStopColocationDiscoveryComplete, FOculusXRUInt64 /*requestId*/, EColocationResult /*result*/);
 	static OCULUSXRCOLOCATION_API FStopColocationDiscoveryComplete StopColocationDiscoveryComplete;
 
-	DECLARE_MULTICAST_DELEGATE_ThreeParams(FColocationDiscoveryResultAvailable, FOculusXRUInt64 /*requestId*/, FOculusXRUUID /*resultUuid*/, const TArray<uint8>& /*metadata*/);
+	DECLARE_MULTICAST_DELEGATE_ThreeParams(FColocationDiscoveryResultAvailable, FOculusXRUInt64 /*requestId*/, FOculusXRUUID /*resultUuid*/, TConstArrayView<uint8> /*metadata*/);
 	static OCULUSXRCOLOCATION_API FColocationDiscoveryResultAvailable ColocationDiscoveryResultAvailable;
 };
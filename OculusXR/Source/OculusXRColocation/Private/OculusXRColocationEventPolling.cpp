@@ -6,30 +6,37 @@
 #include "OculusXRColocationSubsystem.h"
 #include "OculusXRColocationUtil.h"
 #include "OculusXRColocationEventDelegates.h"
-#include "OculusXRHMDPrivate.h"
+#include "OculusXRHMD.h"
 #include "OculusXRHMDModule.h"
 #include "Engine/Engine.h"
 
 namespace OculusXRColocation
 {
-	template <typename T>
-	void GetEventDataAs(ovrpEventDataBuffer& Buffer, T& OutEventData)
+	void FColocationEventPolling::RegisterEventDelegates(OculusXRHMD::FOculusXRHMD& HMD)
 	{
-		memcpy(&OutEventData, reinterpret_cast<uint8*>(&Buffer), sizeof(T));
+		const ovrpEventType EventTypes[] = {
+			ovrpEventType_StartColocationAdvertisementComplete,
+			ovrpEventType_ColocationAdvertisementComplete,
+			ovrpEventType_StopColocationAdvertisementComplete,
+			ovrpEventType_StartColocationDiscoveryComplete,
+			ovrpEventType_ColocationDiscoveryResult,
+			ovrpEventType_ColocationDiscoveryComplete,
+			ovrpEventType_StopColocationDiscoveryComplete,
+		};
+
+		for (ovrpEventType EventType : EventTypes)
+		{
+			HMD.AddEventDelegate(EventType, OculusXRHMD::FOculusXRHMDEventDelegate::CreateStatic(&FColocationEventPolling::OnEvent));
+		}
 	}
 
-	void FColocationEventPolling::OnPollEvent(ovrpEventDataBuffer* EventDataBuffer, bool& EventPollResult)
+	void FColocationEventPolling::OnEvent(const ovrpEventDataBuffer& buf)
 	{
-		ovrpEventDataBuffer& buf = *EventDataBuffer;
-
-		EventPollResult = true;
-
 		switch (buf.EventType)
 		{
 			case ovrpEventType_StartColocationAdvertisementComplete:
 			{
-				ovrpEventStartColocationAdvertisementComplete eventData;
-				GetEventDataAs(buf, eventData);
+				const ovrpEventStartColocationAdvertisementComplete& eventData = OculusXRHMD::GetEventData<ovrpEventStartColocationAdvertisementComplete>(buf);
 
 				UE_LOG(LogOculusXRColocation, Log, TEXT("ovrpEventStartColocationAdvertisementComplete: Request ID: %llu  --  SessionUuid: %s  --  Result: %s"),
 					eventData.AdvertisementRequestId,
@@ -42,8 +49,7 @@ namespace OculusXRColocation
 			}
 			case ovrpEventType_ColocationAdvertisementComplete:
 			{
-				ovrpEventColocationAdvertisementComplete eventData;
-				GetEventDataAs(buf, eventData);
+				const ovrpEventColocationAdvertisementComplete& eventData = OculusXRHMD::GetEventData<ovrpEventColocationAdvertisementComplete>(buf);
 
 				UE_LOG(LogOculusXRColocation, Log, TEXT("ovrpEventColocationAdvertisementComplete: Request ID: %llu  --  Result: %s"),
 					eventData.AdvertisementRequestId,
@@ -55,8 +61,7 @@ namespace OculusXRColocation
 			}
 			case ovrpEventType_StopColocationAdvertisementComplete:
 			{
-				ovrpEventStopColocationAdvertisementComplete eventData;
-				GetEventDataAs(buf, eventData);
+				const ovrpEventStopColocationAdvertisementComplete& eventData = OculusXRHMD::GetEventData<ovrpEventStopColocationAdvertisementComplete>(buf);
 
 				FOculusXRColocationEventDelegates::StopColocationAdvertisementComplete.Broadcast(eventData.RequestId, GetResult(eventData.Result));
 
@@ -64,8 +69,7 @@ namespace OculusXRColocation
 			}
 			case ovrpEventType_StartColocationDiscoveryComplete:
 			{
-				ovrpEventStartColocationDiscoveryComplete eventData;
-				GetEventDataAs(buf, eventData);
+				const ovrpEventStartColocationDiscoveryComplete& eventData = OculusXRHMD::GetEventData<ovrpEventStartColocationDiscoveryComplete>(buf);
 
 				UE_LOG(LogOculusXRColocation, Log, TEXT("ovrpEventStartColocationDiscoveryComplete: Request ID: %llu  --  Result: %s"),
 					eventData.DiscoveryRequestId,
@@ -77,22 +81,21 @@ namespace OculusXRColocation
 			}
 			case ovrpEventType_ColocationDiscoveryResult:
 			{
-				ovrpEventColocationDiscoveryResult eventData;
-				GetEventDataAs(buf, eventData);
+				const ovrpEventColocationDiscoveryResult& eventData = OculusXRHMD::GetEventData<ovrpEventColocationDiscoveryResult>(buf);
 
 				UE_LOG(LogOculusXRColocation, Log, TEXT("ovrpEventColocationDiscoveryResult: Request ID: %llu  --  FoundSessionUuid: %s"),
 					eventData.DiscoveryRequestId,
 					*FOculusXRUUID(eventData.AdvertisementUuid.data).ToString());
 
-				TArray<uint8> metaData(eventData.Buffer, eventData.BufferSize);
+				// Listeners copy the metadata only when they keep it
+				TConstArrayView<uint8> metaData(eventData.Buffer, eventData.BufferSize);
 				FOculusXRColocationEventDelegates::ColocationDiscoveryResultAvailable.Broadcast(eventData.DiscoveryRequestId, eventData.AdvertisementUuid.data, metaData);
 
 				break;
 			}
 			case ovrpEventType_ColocationDiscoveryComplete:
 			{
-				ovrpEventColocationDiscoveryComplete eventData;
-				GetEventDataAs(buf, eventData);
+				const ovrpEventColocationDiscoveryComplete& eventData = OculusXRHMD::GetEventData<ovrpEventColocationDiscoveryComplete>(buf);
 
 				UE_LOG(LogOculusXRColocation, Log, TEXT("ovrpEventColocationDiscoveryComplete: Request ID: %llu  --  Result: %s"),
 					eventData.DiscoveryRequestId,
@@ -104,8 +107,7 @@ namespace OculusXRColocation
 			}
 			case ovrpEventType_StopColocationDiscoveryComplete:
 			{
-				ovrpEventStopColocationDiscoveryComplete eventData;
-				GetEventDataAs(buf, eventData);
+				const ovrpEventStopColocationDiscoveryComplete& eventData = OculusXRHMD::GetEventData<ovrpEventStopColocationDiscoveryComplete>(buf);
 
 				UE_LOG(LogOculusXRColocation, Log, TEXT("ovrpEventType_StopColocationDiscoveryComplete: Request ID: %llu  --  Result: %s"),
 					eventData.RequestId,
@@ -119,7 +121,6 @@ namespace OculusXRColocation
 
 			default:
 			{
-				EventPollResult = false;
 				return;
 			}
 		}
@@ -4,11 +4,19 @@
 
 #include "OculusXRPluginWrapper.h"
 
+namespace OculusXRHMD
+{
+	class FOculusXRHMD;
+}
+
 namespace OculusXRColocation
 {
 	struct FColocationEventPolling
 	{
 	public:
-		static void OnPollEvent(ovrpEventDataBuffer* EventDataBuffer, bool& EventPollResult);
+		static void RegisterEventDelegates(OculusXRHMD::FOculusXRHMD& HMD);
+
+	private:
+		static void OnEvent(const ovrpEventDataBuffer& buf);
 	};
 } // namespace OculusXRColocation
@@ -16,3 +16,13 @@ void UOculusXRColocationFunctionLibrary::StopColocationSessionDiscovery()
 
 	OculusXRColocation::FColocation::StopDiscoverSessions(request);
 }
+
+TArray<FOculusXRColocationSession> UOculusXRColocationFunctionLibrary::GetDiscoveredColocationSessions()
+{
+	TArray<FOculusXRColocationSession> sessions;
+	if (UOculusXRColocationSubsystem* subsystem = UOculusXRColocationSubsystem::Get())
+	{
+		subsystem->GetDiscoveredSessions(sessions);
+	}
+	return sessions;
+}
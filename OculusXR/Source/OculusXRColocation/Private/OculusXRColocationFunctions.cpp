@@ -3,12 +3,18 @@
 #include "OculusXRColocationFunctions.h"
 #include "OculusXRColocationFunctionsOVR.h"
 #include "OculusXRColocationFunctionsOpenXR.h"
+#include "OculusXRColocationLoopback.h"
 #include "IOpenXRHMD.h"
 #include "OculusXRHMD.h"
 
 TSharedPtr<IOculusXRColocationFunctions> IOculusXRColocationFunctions::ColocationFunctionsImpl = nullptr;
 TSharedPtr<IOculusXRColocationFunctions> IOculusXRColocationFunctions::GetOculusXRColocationFunctionsImpl()
 {
+	if (ColocationFunctionsImpl == nullptr && FParse::Param(FCommandLine::Get(), TEXT("OculusXRLoopback")))
+	{
+		OculusXRColocation::FColocationLoopback::Enable();
+	}
+
 	if (ColocationFunctionsImpl == nullptr)
 	{
 		const FName SystemName(TEXT("OpenXR"));
@@ -0,0 +1,279 @@
+// Copyright (c) Meta Platforms, Inc. and affiliates.
+
+#include "OculusXRColocationFunctionsLoopback.h"
+#include "OculusXRColocationLoopback.h"
+#include "OculusXRColocationEventDelegates.h"
+#include "OculusXRColocationModule.h"
+
+FOculusXRColocationFunctionsLoopback::FOculusXRColocationFunctionsLoopback(const FOculusXRLoopbackSettings& Settings)
+	: Events(Settings)
+{
+}
+
+FOculusXRColocationFunctionsLoopback::~FOculusXRColocationFunctionsLoopback()
+{
+	StopReadvertising();
+}
+
+EColocationResult FOculusXRColocationFunctionsLoopback::StartColocationDiscovery(uint64& OutRequestId)
+{
+	if (DiscoveryRequestId != 0)
+	{
+		OutRequestId = DiscoveryRequestId;
+		return EColocationResult::Success_AlreadyDiscovering;
+	}
+
+	OutRequestId = Events.NextRequestId();
+	if (Events.ShouldFail())
+	{
+		Events.Deliver([RequestId = OutRequestId]() {
+			FOculusXRColocationEventDelegates::StartColocationDiscoveryComplete.Broadcast(RequestId, EColocationResult::NetworkRequestFailed);
+		});
+		return EColocationResult::Success;
+	}
+
+	DiscoveryRequestId = OutRequestId;
+	Events.Deliver([RequestId = OutRequestId]() {
+		FOculusXRColocationEventDelegates::StartColocationDiscoveryComplete.Broadcast(RequestId, EColocationResult::Success);
+	});
+	for (const auto& It : SimulatedPeers)
+	{
+		DeliverPeer(It.Key, It.Value);
+	}
+	StartReadvertising();
+
+	UE_LOG(LogOculusXRColocation, Log, TEXT("[Loopback::StartColocationDiscovery] RequestID: %llu, simulated peers: %d"), OutRequestId, SimulatedPeers.Num());
+	return EColocationResult::Success;
+}
+
+EColocationResult FOculusXRColocationFunctionsLoopback::StopColocationDiscovery(uint64& OutRequestId)
+{
+	if (DiscoveryRequestId == 0)
+	{
+		return EColocationResult::Failure;
+	}
+
+	OutRequestId = Events.NextRequestId();
+	StopReadvertising();
+
+	Events.Deliver([RequestId = OutRequestId, DiscoveryId = DiscoveryRequestId]() {
+		FOculusXRColocationEventDelegates::StopColocationDiscoveryComplete.Broadcast(RequestId, EColocationResult::Success);
+		FOculusXRColocationEventDelegates::ColocationDiscoveryComplete.Broadcast(DiscoveryId, EColocationResult::Success);
+	});
+	DiscoveryRequestId = 0;
+
+	UE_LOG(LogOculusXRColocation, Log, TEXT("[Loopback::StopColocationDiscovery] RequestID: %llu"), OutRequestId);
+	return EColocationResult::Success;
+}
+
+EColocationResult FOculusXRColocationFunctionsLoopback::StartColocationAdvertisement(const TArray<uint8>& MetaData, uint64& OutRequestId)
+{
+	if (AdvertisementRequestId != 0)
+	{
+		OutRequestId = AdvertisementRequestId;
+		return EColocationResult::Success_AlreadyAdvertising;
+	}
+
+	OutRequestId = Events.NextRequestId();
+	if (Events.ShouldFail())
+	{
+		Events.Deliver([RequestId = OutRequestId]() {
+			FOculusXRColocationEventDelegates::StartColocationAdvertisementComplete.Broadcast(RequestId, FOculusXRUUID(), EColocationResult::NetworkRequestFailed);
+		});
+		return EColocationResult::Success;
+	}
+
+	// The local advertisement is never reported to the local discovery, as on device
+	AdvertisementRequestId = OutRequestId;
+	AdvertisementUuid = Events.NewUuid();
+	Events.Deliver([RequestId = OutRequestId, Uuid = AdvertisementUuid]() {
+		FOculusXRColocationEventDelegates::StartColocationAdvertisementComplete.Broadcast(RequestId, Uuid, EColocationResult::Success);
+	});
+
+	UE_LOG(LogOculusXRColocation, Log, TEXT("[Loopback::StartColocationAdvertisement] RequestID: %llu, Session: %s"), OutRequestId, *AdvertisementUuid.ToString());
+	return EColocationResult::Success;
+}
+
+EColocationResult FOculusXRColocationFunctionsLoopback::StopColocationAdvertisement(uint64& OutRequestId)
+{
+	if (AdvertisementRequestId == 0)
+	{
+		return EColocationResult::Failure;
+	}
+
+	OutRequestId = Events.NextRequestId();
+	Events.Deliver([RequestId = OutRequestId, AdvertisementId = AdvertisementRequestId]() {
+		FOculusXRColocationEventDelegates::StopColocationAdvertisementComplete.Broadcast(RequestId, EColocationResult::Success);
+		FOculusXRColocationEventDelegates::ColocationAdvertisementComplete.Broadcast(AdvertisementId, EColocationResult::Success);
+	});
+	AdvertisementRequestId = 0;
+	AdvertisementUuid = FOculusXRUUID();
+
+	UE_LOG(LogOculusXRColocation, Log, TEXT("[Loopback::StopColocationAdvertisement] RequestID: %llu"), OutRequestId);
+	return EColocationResult::Success;
+}
+
+void FOculusXRColocationFunctionsLoopback::SetReadvertiseInterval(float Seconds)
+{
+	ReadvertiseInterval = FMath::Max(Seconds, 0.01f);
+	if (ReadvertiseHandle.IsValid())
+	{
+		StopReadvertising();
+		StartReadvertising();
+	}
+}
+
+FOculusXRUUID FOculusXRColocationFunctionsLoopback::AddSimulatedPeer(const TArray<uint8>& Metadata)
+{
+	const FOculusXRUUID Uuid = Events.NewUuid();
+	SimulatedPeers.Add(Uuid, Metadata);
+	if (DiscoveryRequestId != 0)
+	{
+		DeliverPeer(Uuid, Metadata);
+	}
+	return Uuid;
+}
+
+bool FOculusXRColocationFunctionsLoopback::UpdateSimulatedPeer(const FOculusXRUUID& Uuid, const TArray<uint8>& Metadata)
+{
+	TArray<uint8>* Peer = SimulatedPeers.Find(Uuid);
+	if (Peer == nullptr)
+	{
+		return false;
+	}
+
+	*Peer = Metadata;
+	if (DiscoveryRequestId != 0)
+	{
+		DeliverPeer(Uuid, Metadata);
+	}
+	return true;
+}
+
+bool FOculusXRColocationFunctionsLoopback::RemoveSimulatedPeer(const FOculusXRUUID& Uuid)
+{
+	// Discovery has no lost event, listeners notice the peer is gone when it stops re-advertising
+	return SimulatedPeers.Remove(Uuid) > 0;
+}
+
+void FOculusXRColocationFunctionsLoopback::Reset()
+{
+	StopReadvertising();
+	Events.Reset();
+	SimulatedPeers.Reset();
+	DiscoveryRequestId = 0;
+	AdvertisementRequestId = 0;
+	AdvertisementUuid = FOculusXRUUID();
+}
+
+void FOculusXRColocationFunctionsLoopback::DeliverPeer(const FOculusXRUUID& Uuid, const TArray<uint8>& Metadata)
+{
+	Events.Deliver([RequestId = DiscoveryRequestId, Uuid, Metadata]() {
+		FOculusXRColocationEventDelegates::ColocationDiscoveryResultAvailable.Broadcast(RequestId, Uuid, Metadata);
+	});
+}
+
+void FOculusXRColocationFunctionsLoopback::StartReadvertising()
+{
+	if (!ReadvertiseHandle.IsValid())
+	{
+		ReadvertiseHandle = FTSTicker::GetCoreTicker().AddTicker(
+			FTickerDelegate::CreateRaw(this, &FOculusXRColocationFunctionsLoopback::Readvertise), ReadvertiseInterval);
+	}
+}
+
+void FOculusXRColocationFunctionsLoopback::StopReadvertising()
+{
+	if (ReadvertiseHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(ReadvertiseHandle);
+		ReadvertiseHandle.Reset();
+	}
+}
+
+bool FOculusXRColocationFunctionsLoopback::Readvertise(float DeltaTime)
+{
+	for (const auto& It : SimulatedPeers)
+	{
+		DeliverPeer(It.Key, It.Value);
+	}
+	return true;
+}
+
+namespace OculusXRColocation
+{
+	static TSharedPtr<FOculusXRColocationFunctionsLoopback> Loopback;
+
+	void FColocationLoopback::Enable(const FOculusXRLoopbackSettings& Settings)
+	{
+		if (!Loopback.IsValid())
+		{
+			Loopback = MakeShared<FOculusXRColocationFunctionsLoopback>(Settings);
+		}
+		else
+		{
+			Loopback->SetSettings(Settings);
+		}
+
+		IOculusXRColocationFunctions::ColocationFunctionsImpl = Loopback;
+		UE_LOG(LogOculusXRColocation, Log, TEXT("Colocation functions routed through the loopback backend."));
+	}
+
+	void FColocationLoopback::Disable()
+	{
+		if (IsEnabled())
+		{
+			// Selected again from the active XR system on next use
+			IOculusXRColocationFunctions::ColocationFunctionsImpl.Reset();
+		}
+		Loopback.Reset();
+	}
+
+	bool FColocationLoopback::IsEnabled()
+	{
+		return Loopback.IsValid() && IOculusXRColocationFunctions::ColocationFunctionsImpl == Loopback;
+	}
+
+	void FColocationLoopback::SetSettings(const FOculusXRLoopbackSettings& Settings)
+	{
+		if (Loopback.IsValid())
+		{
+			Loopback->SetSettings(Settings);
+		}
+	}
+
+	FOculusXRUUID FColocationLoopback::AddSimulatedPeer(const TArray<uint8>& Metadata)
+	{
+		if (!ensureMsgf(Loopback.IsValid(), TEXT("The colocation loopback backend is not enabled.")))
+		{
+			return FOculusXRUUID();
+		}
+		return Loopback->AddSimulatedPeer(Metadata);
+	}
+
+	bool FColocationLoopback::UpdateSimulatedPeer(const FOculusXRUUID& Uuid, const TArray<uint8>& Metadata)
+	{
+		return Loopback.IsValid() && Loopback->UpdateSimulatedPeer(Uuid, Metadata);
+	}
+
+	bool FColocationLoopback::RemoveSimulatedPeer(const FOculusXRUUID& Uuid)
+	{
+		return Loopback.IsValid() && Loopback->RemoveSimulatedPeer(Uuid);
+	}
+
+	void FColocationLoopback::SetReadvertiseInterval(float Seconds)
+	{
+		if (Loopback.IsValid())
+		{
+			Loopback->SetReadvertiseInterval(Seconds);
+		}
+	}
+
+	void FColocationLoopback::Reset()
+	{
+		if (Loopback.IsValid())
+		{
+			Loopback->Reset();
+		}
+	}
+} // namespace OculusXRColocation
@@ -0,0 +1,47 @@
+// Copyright (c) Meta Platforms, Inc. and affiliates.
+
+#pragma once
+
+#include "OculusXRColocationFunctions.h"
+#include "OculusXRAnchorsLoopback.h"
+
+class OCULUSXRCOLOCATION_API FOculusXRColocationFunctionsLoopback : public IOculusXRColocationFunctions
+{
+public:
+	explicit FOculusXRColocationFunctionsLoopback(const FOculusXRLoopbackSettings& Settings);
+	virtual ~FOculusXRColocationFunctionsLoopback();
+
+	virtual EColocationResult StartColocationDiscovery(uint64& OutRequestId) override;
+	virtual EColocationResult StopColocationDiscovery(uint64& OutRequestId) override;
+
+	virtual EColocationResult StartColocationAdvertisement(const TArray<uint8>& MetaData, uint64& OutRequestId) override;
+	virtual EColocationResult StopColocationAdvertisement(uint64& OutRequestId) override;
+
+	void SetSettings(const FOculusXRLoopbackSettings& Settings) { Events.SetSettings(Settings); }
+	void SetReadvertiseInterval(float Seconds);
+
+	FOculusXRUUID AddSimulatedPeer(const TArray<uint8>& Metadata);
+	bool UpdateSimulatedPeer(const FOculusXRUUID& Uuid, const TArray<uint8>& Metadata);
+	bool RemoveSimulatedPeer(const FOculusXRUUID& Uuid);
+
+	void Reset();
+
+private:
+	void DeliverPeer(const FOculusXRUUID& Uuid, const TArray<uint8>& Metadata);
+	void StartReadvertising();
+	void StopReadvertising();
+	bool Readvertise(float DeltaTime);
+
+	FOculusXRLoopbackEventQueue Events;
+	TMap<FOculusXRUUID, TArray<uint8>> SimulatedPeers;
+
+	// Request of the running discovery, 0 when not discovering
+	uint64 DiscoveryRequestId = 0;
+
+	// Request and session of the local advertisement, 0 when not advertising
+	uint64 AdvertisementRequestId = 0;
+	FOculusXRUUID AdvertisementUuid;
+
+	float ReadvertiseInterval = 1.0f;
+	FTSTicker::FDelegateHandle ReadvertiseHandle;
+};
@@ -43,11 +43,11 @@ void FOculusXRColocationModule::OnPostEngineInit()
 	OculusXRHMD::FOculusXRHMD* HMD = OculusXRHMD::FOculusXRHMD::GetOculusXRHMD();
 	if (!HMD)
 	{
-		UE_LOG(LogOculusXRColocation, Warning, TEXT("Unable to retrieve OculusXRHMD, cannot add event polling delegate."));
+		UE_LOG(LogOculusXRColocation, Warning, TEXT("Unable to retrieve OculusXRHMD, cannot add event delegates."));
 		return;
 	}
 
-	HMD->AddEventPollingDelegate(OculusXRHMD::FOculusXRHMDEventPollingDelegate::CreateStatic(&OculusXRColocation::FColocationEventPolling::OnPollEvent));
+	OculusXRColocation::FColocationEventPolling::RegisterEventDelegates(*HMD);
 }
 
 #endif // OCULUS_HMD_SUPPORTED_PLATFORMS
@@ -22,7 +22,7 @@ namespace OculusXRColocation
 		OnStopCompleteHandle = FOculusXRColocationEventDelegates::StopColocationDiscoveryComplete.AddStatic(
 			&FDiscoverSessionsRequest::OnDiscoveryComplete);
 
-		OnDiscoveryCompleteHandle = FOculusXRColocationEventDelegates::StopColocationDiscoveryComplete.AddStatic(
+		OnDiscoveryCompleteHandle = FOculusXRColocationEventDelegates::ColocationDiscoveryComplete.AddStatic(
 			&FDiscoverSessionsRequest::OnDiscoveryComplete);
 	}
 
@@ -37,7 +37,21 @@ namespace OculusXRColocation
 
 	void FDiscoverSessionsRequest::OnSessionFound(FOculusXRColocationSession&& Session)
 	{
-		auto index = FoundSessions.Emplace(Session);
+		const uint32 metadataHash = FCrc::MemCrc32(Session.Metadata.GetData(), Session.Metadata.Num());
+
+		int32 index;
+		if (FFoundSessionEntry* entry = FoundSessionEntries.Find(Session.Uuid))
+		{
+			index = entry->Index;
+			entry->MetadataHash = metadataHash;
+			FoundSessions[index] = MoveTemp(Session);
+		}
+		else
+		{
+			index = FoundSessions.Emplace(MoveTemp(Session));
+			FoundSessionEntries.Add(FoundSessions[index].Uuid, { index, metadataHash });
+		}
+
 		OnFoundSessionCallback.ExecuteIfBound(FoundSessions[index]);
 	}
 
@@ -73,7 +87,7 @@ namespace OculusXRColocation
 			FDiscoverSessionsRequest::FResultType::FromError(Result));
 	}
 
-	void FDiscoverSessionsRequest::OnResultAvailable(FOculusXRUInt64 RequestId, FOculusXRUUID Uuid, const TArray<uint8>& Metadata)
+	void FDiscoverSessionsRequest::OnResultAvailable(FOculusXRUInt64 RequestId, FOculusXRUUID Uuid, TConstArrayView<uint8> Metadata)
 	{
 		auto taskPtr = OculusXR::FAsyncRequestSystem::GetRequest<FDiscoverSessionsRequest>(
 			OculusXR::FAsyncRequestBase::RequestId{ RequestId.GetValue() });
@@ -83,9 +97,21 @@ namespace OculusXRColocation
 			return;
 		}
 
+		// Skip re-advertisements of a session we already reported with the same metadata
+		if (const FFoundSessionEntry* entry = taskPtr->FoundSessionEntries.Find(Uuid))
+		{
+			const TArray<uint8>& knownMetadata = taskPtr->FoundSessions[entry->Index].Metadata;
+			if (entry->MetadataHash == FCrc::MemCrc32(Metadata.GetData(), Metadata.Num())
+				&& knownMetadata.Num() == Metadata.Num()
+				&& FMemory::Memcmp(knownMetadata.GetData(), Metadata.GetData(), Metadata.Num()) == 0)
+			{
+				return;
+			}
+		}
+
 		FOculusXRColocationSession session;
 		session.Uuid = Uuid;
-		session.Metadata = Metadata;
+		session.Metadata = TArray<uint8>(Metadata.GetData(), Metadata.Num());
 
 		taskPtr->OnSessionFound(std::move(session));
 	}
@@ -161,7 +187,7 @@ namespace OculusXRColocation
 	FStopSessionAdvertisementRequest::~FStopSessionAdvertisementRequest()
 	{
 		FOculusXRColocationEventDelegates::StopColocationAdvertisementComplete.Remove(OnStopCompleteHandle);
-		FOculusXRColocationEventDelegates::StopColocationAdvertisementComplete.Remove(OnCompleteHandle);
+		FOculusXRColocationEventDelegates::ColocationAdvertisementComplete.Remove(OnCompleteHandle);
 	}
 
 	void FStopSessionAdvertisementRequest::OnInitRequest()
@@ -7,6 +7,13 @@
 #include "OculusXRColocationRequests.h"
 #include <Engine/GameInstance.h>
 #include "Engine/Engine.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<float> CVarOculusXRColocationSessionExpiry(
+	TEXT("ovr.ColocationSessionExpiry"),
+	10.0f,
+	TEXT("Seconds after its last advertisement a discovered colocation session is dropped.\n")
+		TEXT("<=0: sessions are kept until the discovered sessions are cleared\n"));
 
 UOculusXRColocationSubsystem::UOculusXRColocationSubsystem() {}
 
@@ -37,12 +44,15 @@ void UOculusXRColocationSubsystem::Initialize(FSubsystemCollectionBase& Collecti
 {
 	OnAdvertisementStartHandle = FOculusXRColocationEventDelegates::StartColocationAdvertisementComplete.AddUObject(this, &UOculusXRColocationSubsystem::OnColocationAdvertisementStart);
 	OnAdvertisementStoppedHandle = FOculusXRColocationEventDelegates::ColocationAdvertisementComplete.AddUObject(this, &UOculusXRColocationSubsystem::OnColocationAdvertisementStopped);
+	OnDiscoveryResultHandle = FOculusXRColocationEventDelegates::ColocationDiscoveryResultAvailable.AddUObject(this, &UOculusXRColocationSubsystem::OnColocationDiscoveryResult);
 }
 
 void UOculusXRColocationSubsystem::Deinitialize()
 {
 	FOculusXRColocationEventDelegates::StartColocationAdvertisementComplete.Remove(OnAdvertisementStartHandle);
 	FOculusXRColocationEventDelegates::StartColocationAdvertisementComplete.Remove(OnAdvertisementStoppedHandle);
+	FOculusXRColocationEventDelegates::ColocationDiscoveryResultAvailable.Remove(OnDiscoveryResultHandle);
+	ClearDiscoveredSessions();
 }
 
 void UOculusXRColocationSubsystem::AssignLocalColocationSessionData(const FOculusXRUUID& Uuid, const TArray<uint8>& Data)
@@ -87,6 +97,100 @@ TSharedPtr<OculusXRColocation::FDiscoverSessionsRequest> UOculusXRColocationSubs
 	return DiscoverSessionsRequest;
 }
 
+bool UOculusXRColocationSubsystem::FindDiscoveredSession(const FOculusXRUUID& Uuid, FOculusXRColocationSession& OutSession) const
+{
+	const FDiscoveredSession* entry = DiscoveredSessions.Find(Uuid);
+	if (entry == nullptr || !IsDiscoveredSessionLive(*entry, FPlatformTime::Seconds()))
+	{
+		return false;
+	}
+
+	OutSession = entry->Session;
+	return true;
+}
+
+void UOculusXRColocationSubsystem::GetDiscoveredSessions(TArray<FOculusXRColocationSession>& OutSessions) const
+{
+	const double now = FPlatformTime::Seconds();
+
+	OutSessions.Reset(DiscoveredSessions.Num());
+	for (const auto& it : DiscoveredSessions)
+	{
+		if (IsDiscoveredSessionLive(it.Value, now))
+		{
+			OutSessions.Add(it.Value.Session);
+		}
+	}
+}
+
+int32 UOculusXRColocationSubsystem::GetNumDiscoveredSessions() const
+{
+	const double now = FPlatformTime::Seconds();
+
+	int32 count = 0;
+	for (const auto& it : DiscoveredSessions)
+	{
+		count += IsDiscoveredSessionLive(it.Value, now) ? 1 : 0;
+	}
+	return count;
+}
+
+void UOculusXRColocationSubsystem::ClearDiscoveredSessions()
+{
+	DiscoveredSessions.Empty();
+}
+
+bool UOculusXRColocationSubsystem::IsDiscoveredSessionLive(const FDiscoveredSession& Entry, double Now) const
+{
+	const float expiry = CVarOculusXRColocationSessionExpiry.GetValueOnGameThread();
+	return expiry <= 0.0f || Now - Entry.LastSeenTime <= expiry;
+}
+
+void UOculusXRColocationSubsystem::PurgeExpiredSessions(double Now)
+{
+	const float expiry = CVarOculusXRColocationSessionExpiry.GetValueOnGameThread();
+
+	// Queries already filter on expiry, purging only bounds the table so it does not need to run per event
+	if (expiry <= 0.0f || Now - LastPurgeTime < expiry)
+	{
+		return;
+	}
+	LastPurgeTime = Now;
+
+	for (auto it = DiscoveredSessions.CreateIterator(); it; ++it)
+	{
+		if (!IsDiscoveredSessionLive(it.Value(), Now))
+		{
+			it.RemoveCurrent();
+		}
+	}
+}
+
+void UOculusXRColocationSubsystem::OnColocationDiscoveryResult(FOculusXRUInt64 RequestId, FOculusXRUUID Uuid, TConstArrayView<uint8> Metadata)
+{
+	const double now = FPlatformTime::Seconds();
+	PurgeExpiredSessions(now);
+
+	const uint32 metadataHash = FCrc::MemCrc32(Metadata.GetData(), Metadata.Num());
+
+	FDiscoveredSession& entry = DiscoveredSessions.FindOrAdd(Uuid);
+	entry.LastSeenTime = now;
+
+	// Re-advertisements with unchanged metadata only refresh the timestamp
+	const bool bUnchanged = entry.Session.Uuid == Uuid
+		&& entry.MetadataHash == metadataHash
+		&& entry.Session.Metadata.Num() == Metadata.Num()
+		&& FMemory::Memcmp(entry.Session.Metadata.GetData(), Metadata.GetData(), Metadata.Num()) == 0;
+	if (bUnchanged)
+	{
+		return;
+	}
+
+	entry.Session.Uuid = Uuid;
+	entry.Session.Metadata = TArray<uint8>(Metadata.GetData(), Metadata.Num());
+	entry.MetadataHash = metadataHash;
+}
+
 void UOculusXRColocationSubsystem::OnColocationAdvertisementStart(FOculusXRUInt64 RequestId, FOculusXRUUID Uuid, EColocationResult Result)
 {
 	if (OculusXRColocation::IsResultSuccess(Result))
@@ -0,0 +1,157 @@
+// Copyright (c) Meta Platforms, Inc. and affiliates.
+
+#include "Misc/AutomationTest.h"
+#include "OculusXRColocationLoopback.h"
+#include "OculusXRColocationEventDelegates.h"
+#include "OculusXRColocationFunctions.h"
+#include "OculusXRColocationSubsystem.h"
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "Subsystems/SubsystemCollection.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace OculusXRColocationLoopbackTest
+{
+	constexpr int32 NumPeers = 4;
+	constexpr float ReadvertiseInterval = 0.5f;
+
+	// Delivers the events queued with no latency
+	static void PumpEvents()
+	{
+		FTSTicker::GetCoreTicker().Tick(0.0f);
+	}
+
+	// Lets the simulated peers re-advertise once, then delivers what they queued
+	static void PumpReadvertisement()
+	{
+		FTSTicker::GetCoreTicker().Tick(ReadvertiseInterval);
+		PumpEvents();
+	}
+} // namespace OculusXRColocationLoopbackTest
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FOculusXRColocationLoopbackPeersTest,
+	"OculusXR.Colocation.Loopback.Peers",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FOculusXRColocationLoopbackPeersTest::RunTest(const FString& Parameters)
+{
+	using namespace OculusXRColocation;
+	using namespace OculusXRColocationLoopbackTest;
+
+	const bool bWasEnabled = FColocationLoopback::IsEnabled();
+	FColocationLoopback::Enable();
+	FColocationLoopback::Reset();
+	FColocationLoopback::SetReadvertiseInterval(ReadvertiseInterval);
+	const TSharedPtr<IOculusXRColocationFunctions> Functions = IOculusXRColocationFunctions::GetOculusXRColocationFunctionsImpl();
+
+	// The subsystem keeps one entry per discovered session, however often it is reported
+	FSubsystemCollection<UGameInstanceSubsystem> Collection;
+	UGameInstance* GameInstance = NewObject<UGameInstance>(GEngine);
+	UOculusXRColocationSubsystem* Subsystem = NewObject<UOculusXRColocationSubsystem>(GameInstance);
+	Subsystem->Initialize(Collection);
+
+	TArray<FOculusXRUUID> Peers;
+	for (int32 Index = 0; Index < NumPeers; Index++)
+	{
+		Peers.Add(FColocationLoopback::AddSimulatedPeer({ static_cast<uint8>(Index) }));
+	}
+
+	FOculusXRUUID LocalSession;
+	EColocationResult AdvertiseResult = EColocationResult::Failure;
+	int32 NumAdvertisementsStopped = 0;
+	const FDelegateHandle AdvertiseHandle = FOculusXRColocationEventDelegates::StartColocationAdvertisementComplete.AddLambda(
+		[&](FOculusXRUInt64 RequestId, FOculusXRUUID Uuid, EColocationResult Result) {
+			AdvertiseResult = Result;
+			LocalSession = Uuid;
+		});
+	const FDelegateHandle AdvertisementCompleteHandle = FOculusXRColocationEventDelegates::ColocationAdvertisementComplete.AddLambda(
+		[&](FOculusXRUInt64 RequestId, EColocationResult Result) {
+			NumAdvertisementsStopped++;
+		});
+
+	int32 NumResults = 0;
+	TSet<FOculusXRUUID> ResultSessions;
+	EColocationResult DiscoveryResult = EColocationResult::Failure;
+	int32 NumDiscoveriesStopped = 0;
+	const FDelegateHandle ResultHandle = FOculusXRColocationEventDelegates::ColocationDiscoveryResultAvailable.AddLambda(
+		[&](FOculusXRUInt64 RequestId, FOculusXRUUID Uuid, TConstArrayView<uint8> Metadata) {
+			NumResults++;
+			ResultSessions.Add(Uuid);
+		});
+	const FDelegateHandle DiscoveryHandle = FOculusXRColocationEventDelegates::StartColocationDiscoveryComplete.AddLambda(
+		[&](FOculusXRUInt64 RequestId, EColocationResult Result) {
+			DiscoveryResult = Result;
+		});
+	const FDelegateHandle DiscoveryCompleteHandle = FOculusXRColocationEventDelegates::ColocationDiscoveryComplete.AddLambda(
+		[&](FOculusXRUInt64 RequestId, EColocationResult Result) {
+			NumDiscoveriesStopped++;
+		});
+
+	// Advertise
+	uint64 RequestId = 0;
+	TestTrue(TEXT("Advertisement starts"), Functions->StartColocationAdvertisement({ 0xFF }, RequestId) == EColocationResult::Success);
+	PumpEvents();
+	TestTrue(TEXT("Advertisement result"), AdvertiseResult == EColocationResult::Success);
+	TestTrue(TEXT("Advertised session UUID is valid"), LocalSession.IsValidUUID());
+
+	// Discover
+	uint64 DiscoveryRequestId = 0;
+	TestTrue(TEXT("Discovery starts"), Functions->StartColocationDiscovery(DiscoveryRequestId) == EColocationResult::Success);
+	TestTrue(TEXT("Discovery is not started twice"), Functions->StartColocationDiscovery(RequestId) == EColocationResult::Success_AlreadyDiscovering);
+	PumpEvents();
+	TestTrue(TEXT("Discovery result"), DiscoveryResult == EColocationResult::Success);
+	TestEqual(TEXT("Every peer is reported once discovery starts"), NumResults, NumPeers);
+
+	// Dedupe
+	PumpReadvertisement();
+	PumpReadvertisement();
+	TestEqual(TEXT("Peers are reported again while they advertise"), NumResults, NumPeers * 3);
+	TestEqual(TEXT("Distinct sessions reported"), ResultSessions.Num(), NumPeers);
+	TestFalse(TEXT("The local advertisement is not discovered"), ResultSessions.Contains(LocalSession));
+	TestEqual(TEXT("Discovered sessions"), Subsystem->GetNumDiscoveredSessions(), NumPeers);
+	for (const FOculusXRUUID& Peer : Peers)
+	{
+		TestTrue(TEXT("Peer session is reported"), ResultSessions.Contains(Peer));
+	}
+
+	TestTrue(TEXT("Peer metadata updates"), FColocationLoopback::UpdateSimulatedPeer(Peers[0], { 42 }));
+	PumpEvents();
+	FOculusXRColocationSession UpdatedSession;
+	TestTrue(TEXT("Updated peer is still discovered"), Subsystem->FindDiscoveredSession(Peers[0], UpdatedSession));
+	TestTrue(TEXT("Updated peer metadata"), UpdatedSession.Metadata == TArray<uint8>({ 42 }));
+	TestEqual(TEXT("An update does not add a session"), Subsystem->GetNumDiscoveredSessions(), NumPeers);
+
+	// Stop
+	TestTrue(TEXT("Discovery stops"), Functions->StopColocationDiscovery(RequestId) == EColocationResult::Success);
+	PumpEvents();
+	TestEqual(TEXT("Discovery completes once stopped"), NumDiscoveriesStopped, 1);
+	const int32 NumResultsWhenStopped = NumResults;
+	PumpReadvertisement();
+	TestEqual(TEXT("Nothing is reported once discovery stops"), NumResults, NumResultsWhenStopped);
+
+	TestTrue(TEXT("Advertisement stops"), Functions->StopColocationAdvertisement(RequestId) == EColocationResult::Success);
+	PumpEvents();
+	TestEqual(TEXT("Advertisement completes once stopped"), NumAdvertisementsStopped, 1);
+	TestTrue(TEXT("Stopping again fails"), Functions->StopColocationAdvertisement(RequestId) == EColocationResult::Failure);
+
+	FOculusXRColocationEventDelegates::StartColocationAdvertisementComplete.Remove(AdvertiseHandle);
+	FOculusXRColocationEventDelegates::ColocationAdvertisementComplete.Remove(AdvertisementCompleteHandle);
+	FOculusXRColocationEventDelegates::ColocationDiscoveryResultAvailable.Remove(ResultHandle);
+	FOculusXRColocationEventDelegates::StartColocationDiscoveryComplete.Remove(DiscoveryHandle);
+	FOculusXRColocationEventDelegates::ColocationDiscoveryComplete.Remove(DiscoveryCompleteHandle);
+	Subsystem->Deinitialize();
+	Subsystem->MarkAsGarbage();
+	GameInstance->MarkAsGarbage();
+
+	FColocationLoopback::Reset();
+	if (!bWasEnabled)
+	{
+		FColocationLoopback::Disable();
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
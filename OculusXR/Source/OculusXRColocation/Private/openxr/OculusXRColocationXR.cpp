@@ -105,7 +105,8 @@ namespace XRColocation
 			UE_LOG(LogOculusXRColocation, Verbose, TEXT("[FColocationXR::OnEvent] XrEventDataStartColocationDiscoveryCompleteMETA"));
 			UE_LOG(LogOculusXRColocation, Verbose, TEXT("						    RequestId: %s"), *FOculusXRUUID(event->advertisementUuid.data).ToString());
 
-			TArray<uint8> metadata(event->buffer, event->bufferSize);
+			// Listeners copy the metadata only when they keep it
+			TConstArrayView<uint8> metadata(event->buffer, event->bufferSize);
 			FOculusXRColocationEventDelegates::ColocationDiscoveryResultAvailable.Broadcast(event->discoveryRequestId, event->advertisementUuid.data, metadata);
 		}
 		else if (InHeader->type == XR_TYPE_EVENT_DATA_COLOCATION_DISCOVERY_COMPLETE_META)
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "Kismet/BlueprintFunctionLibrary.h"
+#include "OculusXRColocationSession.h"
 #include "OculusXRColocationFunctionLibrary.generated.h"
 
 UCLASS()
@@ -13,4 +14,8 @@ class OCULUSXRCOLOCATION_API UOculusXRColocationFunctionLibrary : public UBluepr
 
 	UFUNCTION(BlueprintCallable, Category = "OculusXR|Colocation")
 	static void StopColocationSessionDiscovery();
+
+	/** Returns the sessions discovered so far that are still being advertised. */
+	UFUNCTION(BlueprintCallable, Category = "OculusXR|Colocation")
+	static TArray<FOculusXRColocationSession> GetDiscoveredColocationSessions();
 };
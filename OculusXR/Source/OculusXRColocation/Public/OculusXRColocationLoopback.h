@@ -0,0 +1,37 @@
+// Copyright (c) Meta Platforms, Inc. and affiliates.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "OculusXRAnchorsLoopback.h"
+
+namespace OculusXRColocation
+{
+	/**
+	 * In-process colocation backend that needs no runtime or headset. Sessions advertised by simulated peers are reported to
+	 * session discovery, and advertisement requests complete after the configured latency, so colocation flows can run in
+	 * automation tests. It can also be selected at startup with the -OculusXRLoopback command line switch.
+	 */
+	class OCULUSXRCOLOCATION_API FColocationLoopback
+	{
+	public:
+		// Routes FColocation through the loopback backend until Disable() is called
+		static void Enable(const FOculusXRLoopbackSettings& Settings = FOculusXRLoopbackSettings());
+
+		// Must not be called from a handler of a loopback event
+		static void Disable();
+		static bool IsEnabled();
+		static void SetSettings(const FOculusXRLoopbackSettings& Settings);
+
+		// Simulated peers advertising a session. Like the runtime, discovery reports every advertisement again periodically.
+		static FOculusXRUUID AddSimulatedPeer(const TArray<uint8>& Metadata);
+		static bool UpdateSimulatedPeer(const FOculusXRUUID& Uuid, const TArray<uint8>& Metadata);
+		static bool RemoveSimulatedPeer(const FOculusXRUUID& Uuid);
+
+		// Interval at which simulated peers re-advertise while discovery is running
+		static void SetReadvertiseInterval(float Seconds);
+
+		// Drops all peers, stops the local advertisement and discovery without events, and drops undelivered events
+		static void Reset();
+	};
+} // namespace OculusXRColocation
@@ -38,7 +38,7 @@ namespace OculusXRColocation
 
 	private:
 		static void OnStartComplete(FOculusXRUInt64 RequestId, EColocationResult Result);
-		static void OnResultAvailable(FOculusXRUInt64 RequestId, FOculusXRUUID Uuid, const TArray<uint8>& Metadata);
+		static void OnResultAvailable(FOculusXRUInt64 RequestId, FOculusXRUUID Uuid, TConstArrayView<uint8> Metadata);
 		static void OnDiscoveryComplete(FOculusXRUInt64 RequestId, EColocationResult Result);
 
 		FDelegateHandle OnStartCompleteHandle;
@@ -46,8 +46,17 @@ namespace OculusXRColocation
 		FDelegateHandle OnStopCompleteHandle;
 		FDelegateHandle OnDiscoveryCompleteHandle;
 
+		struct FFoundSessionEntry
+		{
+			int32 Index;
+			uint32 MetadataHash;
+		};
+
 		FOculusXRColocationSessionFoundDelegate OnFoundSessionCallback;
 		TArray<FOculusXRColocationSession> FoundSessions;
+
+		// Sessions are re-advertised continuously, only new sessions and metadata changes are reported
+		TMap<FOculusXRUUID, FFoundSessionEntry> FoundSessionEntries;
 	};
 
 	// Start advertisement, creates a session internally
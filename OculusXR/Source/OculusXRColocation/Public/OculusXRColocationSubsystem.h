@@ -30,13 +30,34 @@ public:
 	void ClearDiscoveryRequest();
 	TSharedPtr<OculusXRColocation::FDiscoverSessionsRequest> GetDiscoveryRequest() const;
 
+	// Sessions seen by discovery that were advertised within the expiry window (ovr.ColocationSessionExpiry)
+	bool FindDiscoveredSession(const FOculusXRUUID& Uuid, FOculusXRColocationSession& OutSession) const;
+	void GetDiscoveredSessions(TArray<FOculusXRColocationSession>& OutSessions) const;
+	int32 GetNumDiscoveredSessions() const;
+	void ClearDiscoveredSessions();
+
 private:
+	struct FDiscoveredSession
+	{
+		FOculusXRColocationSession Session;
+		uint32 MetadataHash = 0;
+		double LastSeenTime = 0.0;
+	};
+
 	void OnColocationAdvertisementStart(FOculusXRUInt64 RequestId, FOculusXRUUID Uuid, EColocationResult Result);
 	void OnColocationAdvertisementStopped(FOculusXRUInt64 RequestId, EColocationResult Result);
+	void OnColocationDiscoveryResult(FOculusXRUInt64 RequestId, FOculusXRUUID Uuid, TConstArrayView<uint8> Metadata);
+
+	bool IsDiscoveredSessionLive(const FDiscoveredSession& Entry, double Now) const;
+	void PurgeExpiredSessions(double Now);
 
 	FDelegateHandle OnAdvertisementStartHandle;
 	FDelegateHandle OnAdvertisementStoppedHandle;
+	FDelegateHandle OnDiscoveryResultHandle;
 	bool bHasLocalSession;
 	FOculusXRColocationSession LocalSession;
 	TSharedPtr<OculusXRColocation::FDiscoverSessionsRequest> DiscoverSessionsRequest;
+
+	TMap<FOculusXRUUID, FDiscoveredSession> DiscoveredSessions;
+	double LastPurgeTime = 0.0;
 };
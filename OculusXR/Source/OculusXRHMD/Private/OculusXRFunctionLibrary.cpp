@@ -111,6 +111,34 @@ bool UOculusXRFunctionLibrary::IsDeviceTracked(EOculusXRTrackedDeviceType Device
 	return bIsDeviceTracked;
 }
 
+bool UOculusXRFunctionLibrary::GetPoseHistoryTimeRange(double& OutOldest, double& OutNewest)
+{
+	OutOldest = 0.0;
+	OutNewest = 0.0;
+#if OCULUS_HMD_SUPPORTED_PLATFORMS
+	TSharedPtr<OculusXRHMD::IOculusXRFunctionLibrary> Impl = GetOculusXRFunctionImpl();
+	if (Impl != nullptr)
+	{
+		return Impl->GetPoseHistoryTimeRange(OutOldest, OutNewest);
+	}
+#endif
+	return false;
+}
+
+bool UOculusXRFunctionLibrary::GetPoseAtTime(EOculusXRTrackedDeviceType DeviceType, double DisplayTime, FRotator& OutRotation, FVector& OutPosition)
+{
+	OutRotation = FRotator::ZeroRotator;
+	OutPosition = FVector::ZeroVector;
+#if OCULUS_HMD_SUPPORTED_PLATFORMS
+	TSharedPtr<OculusXRHMD::IOculusXRFunctionLibrary> Impl = GetOculusXRFunctionImpl();
+	if (Impl != nullptr)
+	{
+		return Impl->GetPoseAtTime(DeviceType, DisplayTime, OutRotation, OutPosition);
+	}
+#endif
+	return false;
+}
+
 void UOculusXRFunctionLibrary::GetSuggestedCpuAndGpuPerformanceLevels(EOculusXRProcessorPerformanceLevel& CpuPerfLevel, EOculusXRProcessorPerformanceLevel& GpuPerfLevel)
 {
 #if OCULUS_HMD_SUPPORTED_PLATFORMS
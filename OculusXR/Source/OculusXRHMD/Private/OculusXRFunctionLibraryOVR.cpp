@@ -93,6 +93,37 @@ namespace OculusXRHMD
 		return false;
 	}
 
+	bool FOculusXRFunctionLibraryOVR::GetPoseHistoryTimeRange(double& OutOldest, double& OutNewest)
+	{
+		OculusXRHMD::FOculusXRHMD* OculusXRHMD = OculusXRHMD::FOculusXRHMD::GetOculusXRHMD();
+		if (OculusXRHMD != nullptr && OculusXRHMD->IsHMDActive())
+		{
+			return OculusXRHMD->GetPoseHistoryTimeRange(OutOldest, OutNewest);
+		}
+		return false;
+	}
+
+	bool FOculusXRFunctionLibraryOVR::GetPoseAtTime(EOculusXRTrackedDeviceType DeviceType, double DisplayTime, FRotator& OutRotation, FVector& OutPosition)
+	{
+		OculusXRHMD::FOculusXRHMD* OculusXRHMD = OculusXRHMD::FOculusXRHMD::GetOculusXRHMD();
+		if (OculusXRHMD != nullptr && OculusXRHMD->IsHMDActive())
+		{
+			const ovrpNode Node = OculusXRHMD::ToOvrpNode(DeviceType);
+			if (Node == ovrpNode_None)
+			{
+				return false;
+			}
+
+			FQuat Orientation;
+			if (OculusXRHMD->GetPoseAtTime(OculusXRHMD::ToExternalDeviceId(Node), DisplayTime, Orientation, OutPosition))
+			{
+				OutRotation = Orientation.Rotator();
+				return true;
+			}
+		}
+		return false;
+	}
+
 	void FOculusXRFunctionLibraryOVR::GetSuggestedCpuAndGpuPerformanceLevels(EOculusXRProcessorPerformanceLevel& CpuPerfLevel, EOculusXRProcessorPerformanceLevel& GpuPerfLevel)
 	{
 		OculusXRHMD::FOculusXRHMD* OculusXRHMD = OculusXRHMD::FOculusXRHMD::GetOculusXRHMD();
@@ -14,6 +14,8 @@ namespace OculusXRHMD
 		virtual void GetBaseRotationAndBaseOffsetInMeters(FRotator& OutRotation, FVector& OutBaseOffsetInMeters) override;
 		virtual void GetRawSensorData(FVector& AngularAcceleration, FVector& LinearAcceleration, FVector& AngularVelocity, FVector& LinearVelocity, float& TimeInSeconds, EOculusXRTrackedDeviceType DeviceType) override;
 		virtual bool IsDeviceTracked(EOculusXRTrackedDeviceType DeviceType) override;
+		virtual bool GetPoseHistoryTimeRange(double& OutOldest, double& OutNewest) override;
+		virtual bool GetPoseAtTime(EOculusXRTrackedDeviceType DeviceType, double DisplayTime, FRotator& OutRotation, FVector& OutPosition) override;
 		virtual void GetSuggestedCpuAndGpuPerformanceLevels(EOculusXRProcessorPerformanceLevel& CpuPerfLevel, EOculusXRProcessorPerformanceLevel& GpuPerfLevel) override;
 		virtual void SetSuggestedCpuAndGpuPerformanceLevels(EOculusXRProcessorPerformanceLevel CpuPerfLevel, EOculusXRProcessorPerformanceLevel GpuPerfLevel) override;
 		virtual bool GetUserProfile(FOculusXRHmdUserProfile& Profile) override;
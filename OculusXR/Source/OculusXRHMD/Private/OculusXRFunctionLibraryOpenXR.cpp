@@ -146,6 +146,17 @@ namespace OculusXRHMD
 		return bIsDeviceTracked;
 	}
 
+	bool FOculusXRFunctionLibraryOpenXR::GetPoseHistoryTimeRange(double& OutOldest, double& OutNewest)
+	{
+		// The pose history is recorded by the OVRPlugin backend only
+		return false;
+	}
+
+	bool FOculusXRFunctionLibraryOpenXR::GetPoseAtTime(EOculusXRTrackedDeviceType DeviceType, double DisplayTime, FRotator& OutRotation, FVector& OutPosition)
+	{
+		return false;
+	}
+
 	void FOculusXRFunctionLibraryOpenXR::GetSuggestedCpuAndGpuPerformanceLevels(EOculusXRProcessorPerformanceLevel& CpuPerfLevel, EOculusXRProcessorPerformanceLevel& GpuPerfLevel)
 	{
 		OculusXR::FPerformanceExtensionPlugin& PerfPlugin = FOculusXRHMDModule::Get().GetExtensionPluginManager().GetPerformanceExtensionPlugin();
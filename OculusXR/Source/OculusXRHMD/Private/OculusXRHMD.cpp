@@ -272,6 +272,7 @@ namespace OculusXRHMD
 			{
 				FOculusXRHMDModule::GetPluginWrapper().Update3(ovrpStep_Render, CurrentFrame->FrameNumber, 0.0);
 				CurrentFrame->Flags.bRTLateUpdateDone = true;
+				PoseSnapshot_RenderThread.Invalidate();
 			}
 		}
 		// else, Frame_RenderThread has already been reset/rendered (or not created yet).
@@ -279,6 +280,51 @@ namespace OculusXRHMD
 		// immediately - meaning two render frames were enqueued in the span of one game tick.
 	}
 
+	double FOculusXRHMD::GetPredictedDisplayTime()
+	{
+		CheckInGameThread();
+
+		FPose Pose;
+		if (!NextFrameToRender.IsValid() || !PoseSnapshot.GetTrackingPose(ovrpNode_Head, NextFrameToRender->FrameNumber, Pose))
+		{
+			return 0.0;
+		}
+
+		return PoseSnapshot.GetDisplayTime();
+	}
+
+	bool FOculusXRHMD::GetPoseHistoryTimeRange(double& OutOldest, double& OutNewest) const
+	{
+		CheckInGameThread();
+
+		return PoseHistory.GetTimeRange(OutOldest, OutNewest);
+	}
+
+	bool FOculusXRHMD::GetPoseAtTime(int32 InDeviceId, double DisplayTime, FQuat& OutOrientation, FVector& OutPosition)
+	{
+		CheckInGameThread();
+
+		OutOrientation = FQuat::Identity;
+		OutPosition = FVector::ZeroVector;
+
+		if ((size_t)InDeviceId >= TrackedDeviceCount || !Settings.IsValid() || !NextFrameToRender.IsValid())
+		{
+			return false;
+		}
+
+		FPose TrackingPose, Pose;
+		if (!PoseHistory.GetTrackingPose(OculusXRHMD::ToOvrpNode(InDeviceId), DisplayTime, TrackingPose))
+		{
+			return false;
+		}
+
+		// Recorded poses are in tracking space, so they follow later recenters like the current pose does
+		OculusXRHMD::ConvertPose_Internal(TrackingPose, Pose, Settings->BaseOrientation, Settings->BaseOffset, NextFrameToRender->WorldToMetersScale);
+		OutOrientation = Pose.Orientation;
+		OutPosition = Pose.Position;
+		return true;
+	}
+
 	void FOculusXRHMD::SwitchPrimaryPIE(int PrimaryPIEIndex)
 	{
 		CurPlayerIndex = PrimaryPIEIndex;
@@ -379,17 +425,20 @@ namespace OculusXRHMD
 		ovrpNode Node = OculusXRHMD::ToOvrpNode(InDeviceId);
 		const FSettings* CurrentSettings;
 		FGameFrame* CurrentFrame;
+		FPoseSnapshot* Snapshot;
 
 		if (InRenderThread())
 		{
 			CurrentSettings = GetSettings_RenderThread();
 			CurrentFrame = GetFrame_RenderThread();
+			Snapshot = &PoseSnapshot_RenderThread;
 			UpdateRTPoses();
 		}
 		else if (InGameThread())
 		{
 			CurrentSettings = GetSettings();
 			CurrentFrame = NextFrameToRender.Get();
+			Snapshot = &PoseSnapshot;
 		}
 		else
 		{
@@ -401,10 +450,9 @@ namespace OculusXRHMD
 			return false;
 		}
 
-		ovrpPoseStatef PoseState;
 		FPose Pose;
 
-		if (OVRP_FAILURE(FOculusXRHMDModule::GetPluginWrapper().GetNodePoseState3(ovrpStep_Render, CurrentFrame->FrameNumber, Node, &PoseState)) || !ConvertPose_Internal(PoseState.Pose, Pose, CurrentSettings, CurrentFrame->WorldToMetersScale))
+		if (!Snapshot->GetPose(Node, CurrentFrame->FrameNumber, CurrentSettings, CurrentFrame->WorldToMetersScale, Pose))
 		{
 			return false;
 		}
@@ -448,17 +496,20 @@ namespace OculusXRHMD
 
 		const FSettings* CurrentSettings;
 		FGameFrame* CurrentFrame;
+		FPoseSnapshot* Snapshot;
 
 		if (InRenderThread())
 		{
 			CurrentSettings = GetSettings_RenderThread();
 			CurrentFrame = GetFrame_RenderThread();
+			Snapshot = &PoseSnapshot_RenderThread;
 			UpdateRTPoses();
 		}
 		else if (InGameThread())
 		{
 			CurrentSettings = GetSettings();
 			CurrentFrame = NextFrameToRender.Get();
+			Snapshot = &PoseSnapshot;
 		}
 		else
 		{
@@ -470,18 +521,15 @@ namespace OculusXRHMD
 			return false;
 		}
 
-		ovrpPoseStatef HmdPoseState, EyePoseState;
+		FPose HmdPose, EyePose;
 
-		if (OVRP_FAILURE(FOculusXRHMDModule::GetPluginWrapper().GetNodePoseState3(ovrpStep_Render, CurrentFrame->FrameNumber, ovrpNode_Head, &HmdPoseState)) || OVRP_FAILURE(FOculusXRHMDModule::GetPluginWrapper().GetNodePoseState3(ovrpStep_Render, CurrentFrame->FrameNumber, Node, &EyePoseState)))
+		if (!Snapshot->GetTrackingPose(ovrpNode_Head, CurrentFrame->FrameNumber, HmdPose) || !Snapshot->GetTrackingPose(Node, CurrentFrame->FrameNumber, EyePose))
 		{
 			return false;
 		}
 
-		FPose HmdPose, EyePose;
-		HmdPose.Orientation = ToFQuat(HmdPoseState.Pose.Orientation);
-		HmdPose.Position = ToFVector(HmdPoseState.Pose.Position) * CurrentFrame->WorldToMetersScale;
-		EyePose.Orientation = ToFQuat(EyePoseState.Pose.Orientation);
-		EyePose.Position = ToFVector(EyePoseState.Pose.Position) * CurrentFrame->WorldToMetersScale;
+		HmdPose.Position *= CurrentFrame->WorldToMetersScale;
+		EyePose.Position *= CurrentFrame->WorldToMetersScale;
 
 		FQuat HmdOrientationInv = HmdPose.Orientation.Inverse();
 		OutOrientation = HmdOrientationInv * EyePose.Orientation;
@@ -544,6 +592,10 @@ namespace OculusXRHMD
 			FOculusXRHMDModule::GetPluginWrapper().SetTrackingOriginType2(ovrpOrigin);
 			OCFlags.NeedSetTrackingOrigin = false;
 
+			// Poses recorded relative to the previous origin cannot be compared to new ones
+			PoseSnapshot.Invalidate();
+			PoseHistory.Reset();
+
 			if (lastOrigin != InOrigin)
 				Settings->BaseOffset = FVector::ZeroVector;
 		}
@@ -627,6 +679,7 @@ namespace OculusXRHMD
 			ovrpPoseStatef poseState;
 			FOculusXRHMDModule::GetPluginWrapper().Update3(ovrpStep_Render, NextFrameToRender->FrameNumber, 0.0);
 			FOculusXRHMDModule::GetPluginWrapper().GetNodePoseState3(ovrpStep_Render, NextFrameToRender->FrameNumber, ovrpNode_Head, &poseState);
+			PoseSnapshot.Invalidate();
 
 			if (RecenterType & RecenterPosition)
 			{
@@ -1270,6 +1323,11 @@ namespace OculusXRHMD
 			Settings_RenderThread.Reset();
 			Frame_RenderThread.Reset();
 			Layers_RenderThread.Reset();
+			PendingLayers_RenderThread.Reset();
+			LayerCopies_RenderThread.Reset();
+			SettingsPool_RenderThread.Reset();
+			FramePool_RenderThread.Reset();
+			PoseSnapshot_RenderThread.Invalidate();
 			EyeLayer_RenderThread.Reset();
 
 			DeferredDeletion.HandleLayerDeferredDeletionQueue_RenderThread(true);
@@ -1280,6 +1338,11 @@ namespace OculusXRHMD
 		Frame.Reset();
 		NextFrameToRender.Reset();
 		LastFrameToRender.Reset();
+		LayerGenerations.Reset();
+		SettingsPool.Reset();
+		FramePool.Reset();
+		PoseSnapshot.Invalidate();
+		PoseHistory.Reset();
 
 #if !UE_BUILD_SHIPPING
 		UDebugDrawService::Unregister(DrawDebugDelegateHandle);
@@ -1548,6 +1611,38 @@ namespace OculusXRHMD
 		}
 	}
 
+	IMotionController* FOculusXRHMD::GetInputMotionController()
+	{
+		if (!InputMotionController)
+		{
+			const FName MotionControllerName("OculusXRInputDevice");
+			TArray<IMotionController*> MotionControllers = IModularFeatures::Get().GetModularFeatureImplementations<IMotionController>(IMotionController::GetModularFeatureName());
+			for (IMotionController* Itr : MotionControllers)
+			{
+				if (Itr->GetMotionControllerDeviceTypeName() == MotionControllerName)
+				{
+					InputMotionController = Itr;
+					break;
+				}
+			}
+
+			if (InputMotionController && !ModularFeatureUnregisteredHandle.IsValid())
+			{
+				ModularFeatureUnregisteredHandle = IModularFeatures::Get().OnModularFeatureUnregistered().AddRaw(this, &FOculusXRHMD::OnModularFeatureUnregistered);
+			}
+		}
+
+		return InputMotionController;
+	}
+
+	void FOculusXRHMD::OnModularFeatureUnregistered(const FName& Type, IModularFeature* ModularFeature)
+	{
+		if (Type == IMotionController::GetModularFeatureName() && ModularFeature == InputMotionController)
+		{
+			InputMotionController = nullptr;
+		}
+	}
+
 	void FOculusXRHMD::GetMotionControllerData(UObject* WorldContext, const EControllerHand Hand, FXRMotionControllerData& MotionControllerData)
 	{
 		MotionControllerData.DeviceName = IOculusXRHMDModule::NAME_OculusXRHMD;
@@ -1559,25 +1654,25 @@ namespace OculusXRHMD
 
 		if ((Hand == EControllerHand::Left) || (Hand == EControllerHand::Right))
 		{
-			const FName MotionControllerName("OculusXRInputDevice");
-			TArray<IMotionController*> MotionControllers = IModularFeatures::Get().GetModularFeatureImplementations<IMotionController>(IMotionController::GetModularFeatureName());
-			const IMotionController* MotionController = nullptr;
-			for (const IMotionController* Itr : MotionControllers)
-			{
-				if (Itr->GetMotionControllerDeviceTypeName() == MotionControllerName)
-				{
-					MotionController = Itr;
-					break;
-				}
-			}
+			const IMotionController* MotionController = GetInputMotionController();
 
 			const float WorldToMeters = GetWorldToMetersScale();
 			if (MotionController)
 			{
+				const FTransform TrackingToWorld = GetTrackingToWorldTransform();
+
+				// Aim and grip are queried once per frame and hand, as long as the tracking to world conversion is unchanged
+				FMotionControllerDataCache& Cache = MotionControllerDataCache[Hand == EControllerHand::Left ? 0 : 1];
+				const bool bCacheable = IsInGameThread() && NextFrameToRender.IsValid() && Settings.IsValid();
+				if (bCacheable && Cache.FrameNumber == NextFrameToRender->FrameNumber && Cache.WorldToMeters == WorldToMeters && Cache.TrackingToWorld.Equals(TrackingToWorld, 0.0f) && Cache.BaseOrientation.Equals(Settings->BaseOrientation, 0.0f) && Cache.BaseOffset.Equals(Settings->BaseOffset, 0.0f))
+				{
+					MotionControllerData = Cache.Data;
+					return;
+				}
+
 				bool bSuccess = false;
 				FVector Position = FVector::ZeroVector;
 				FRotator Rotation = FRotator::ZeroRotator;
-				const FTransform TrackingToWorld = GetTrackingToWorldTransform();
 				const FName AimSource = Hand == EControllerHand::Left ? FName("LeftAim") : FName("RightAim");
 				bSuccess = MotionController->GetControllerOrientationAndPosition(0, AimSource, Rotation, Position, WorldToMeters);
 				if (bSuccess)
@@ -1597,6 +1692,16 @@ namespace OculusXRHMD
 				MotionControllerData.bValid |= bSuccess;
 
 				MotionControllerData.TrackingStatus = MotionController->GetControllerTrackingStatus(0, GripSource);
+
+				if (bCacheable)
+				{
+					Cache.FrameNumber = NextFrameToRender->FrameNumber;
+					Cache.WorldToMeters = WorldToMeters;
+					Cache.TrackingToWorld = TrackingToWorld;
+					Cache.BaseOrientation = Settings->BaseOrientation;
+					Cache.BaseOffset = Settings->BaseOffset;
+					Cache.Data = MotionControllerData;
+				}
 			}
 		}
 	}
@@ -1652,17 +1757,7 @@ namespace OculusXRHMD
 
 		if ((Hand == EControllerHand::Left) || (Hand == EControllerHand::Right))
 		{
-			const FName MotionControllerName("OculusXRInputDevice");
-			TArray<IMotionController*> MotionControllers = IModularFeatures::Get().GetModularFeatureImplementations<IMotionController>(IMotionController::GetModularFeatureName());
-			const IMotionController* MotionController = nullptr;
-			for (const IMotionController* Itr : MotionControllers)
-			{
-				if (Itr->GetMotionControllerDeviceTypeName() == MotionControllerName)
-				{
-					MotionController = Itr;
-					break;
-				}
-			}
+			const IMotionController* MotionController = GetInputMotionController();
 
 			if (MotionController)
 			{
@@ -2350,7 +2445,7 @@ namespace OculusXRHMD
 
 	void FOculusXRHMD::UpdateHMDEvents()
 	{
-		ovrpEventDataBuffer buf;
+		alignas(EventBufferAlignment) ovrpEventDataBuffer buf;
 		while (FOculusXRHMDModule::GetPluginWrapper().PollEvent(&buf) == ovrpSuccess)
 		{
 			if (buf.EventType == ovrpEventType_None)
@@ -2364,11 +2459,14 @@ namespace OculusXRHMD
 			}
 			else
 			{
+				// Polling delegates see the event as polled, before routing moves legacy payloads
 				for (auto& it : EventPollingDelegates)
 				{
 					bool HandledEvent = false;
 					it.ExecuteIfBound(&buf, HandledEvent);
 				}
+
+				EventRouter.Dispatch(buf);
 			}
 		}
 	}
@@ -2402,6 +2500,12 @@ namespace OculusXRHMD
 
 		if (LayerFound)
 		{
+			// Moving a layer is the most common update, it is applied in place and handed to the render thread without copying the layer
+			if ((*LayerFound)->TrySetPose(Settings.Get(), InLayerDesc))
+			{
+				return;
+			}
+
 			FLayer* Layer = new FLayer(**LayerFound);
 			Layer->SetDesc(Settings.Get(), InLayerDesc);
 			*LayerFound = MakeShareable(Layer);
@@ -2886,6 +2990,7 @@ namespace OculusXRHMD
 		NextFrameNumber = 0;
 		WaitFrameNumber = (uint32)-1;
 		NextLayerId = 0;
+		InputMotionController = nullptr;
 
 		Settings = CreateNewSettings();
 
@@ -3009,6 +3114,13 @@ namespace OculusXRHMD
 
 		ReleaseDevice();
 
+		if (ModularFeatureUnregisteredHandle.IsValid())
+		{
+			IModularFeatures::Get().OnModularFeatureUnregistered().Remove(ModularFeatureUnregisteredHandle);
+			ModularFeatureUnregisteredHandle.Reset();
+		}
+		InputMotionController = nullptr;
+
 		Settings.Reset();
 		LayerMap.Reset();
 	}
@@ -4732,6 +4844,8 @@ namespace OculusXRHMD
 					}
 
 					FOculusXRHMDModule::GetPluginWrapper().Update3(ovrpStep_Render, Frame->FrameNumber, 0.0);
+					PoseSnapshot.Invalidate();
+					PoseHistory.Record(PoseSnapshot, Frame->FrameNumber);
 				}
 			}
 
@@ -4769,64 +4883,106 @@ namespace OculusXRHMD
 				NextFrameNumber++;
 			}
 
-			FSettingsPtr XSettings = Settings->Clone();
-			FGameFramePtr XFrame = NextFrameToRender->Clone();
-			TArray<FLayerPtr> XLayers;
+			FSettingsPtr XSettings = SettingsPool.CopyFrom(*Settings);
+			FGameFramePtr XFrame = FramePool.CopyFrom(*NextFrameToRender);
+			TArray<FLayerHandoff> XLayers;
 
 			XLayers.Empty(LayerMap.Num());
 
-			for (auto Pair : LayerMap)
+			// Only copy the layers changed since the previous frame, the render thread keeps its copy of the others
+			for (const auto& Pair : LayerMap)
+			{
+				const uint32 Generation = Pair.Value->GetGeneration();
+				const uint32* HandedOffGeneration = LayerGenerations.Find(Pair.Key);
+
+				if (HandedOffGeneration && *HandedOffGeneration == Generation)
+				{
+					XLayers.Add(FLayerHandoff{ Pair.Key, nullptr, Pair.Value->GetPose() });
+				}
+				else
+				{
+					XLayers.Add(FLayerHandoff{ Pair.Key, Pair.Value->Clone(), Pair.Value->GetPose() });
+					LayerGenerations.Add(Pair.Key, Generation);
+				}
+			}
+
+			if (LayerGenerations.Num() != LayerMap.Num())
 			{
-				XLayers.Emplace(Pair.Value->Clone());
+				for (auto It = LayerGenerations.CreateIterator(); It; ++It)
+				{
+					if (!LayerMap.Contains(It.Key()))
+					{
+						It.RemoveCurrent();
+					}
+				}
 			}
 
-			XLayers.Sort(FLayerPtr_CompareId());
+			XLayers.Sort([](const FLayerHandoff& A, const FLayerHandoff& B) { return A.Id < B.Id; });
 
-			ExecuteOnRenderThread_DoNotWait([this, XSettings, XFrame, XLayers](FRHICommandListImmediate& RHICmdList) {
+			ExecuteOnRenderThread_DoNotWait([this, XSettings, XFrame, XLayers = MoveTemp(XLayers)](FRHICommandListImmediate& RHICmdList) {
 				if (XFrame.IsValid())
 				{
 					Settings_RenderThread = XSettings;
 					Frame_RenderThread = XFrame;
 
-					int32 XLayerIndex = 0;
 					int32 LayerIndex_RenderThread = 0;
+					int32 PendingLayerIndex = 0;
 					TArray<FLayerPtr> ValidXLayers;
+					TArray<FLayerPtr> PendingXLayers;
 
-					while (XLayerIndex < XLayers.Num() && LayerIndex_RenderThread < Layers_RenderThread.Num())
-					{
-						uint32 LayerIdA = XLayers[XLayerIndex]->GetId();
-						uint32 LayerIdB = Layers_RenderThread[LayerIndex_RenderThread]->GetId();
+					ValidXLayers.Reserve(XLayers.Num());
 
-						if (LayerIdA < LayerIdB)
+					// Layers that are not ready yet, e.g. waiting for their texture, are retried every frame until they change
+					auto InitializeLayer = [this, &RHICmdList, &ValidXLayers, &PendingXLayers](const FLayerPtr& Layer, const FLayer* InLayer) {
+						if (Layer->Initialize_RenderThread(Settings_RenderThread.Get(), CustomPresent, &DeferredDeletion, RHICmdList, InLayer))
 						{
-							if (XLayers[XLayerIndex]->Initialize_RenderThread(Settings_RenderThread.Get(), CustomPresent, &DeferredDeletion, RHICmdList))
-							{
-								ValidXLayers.Add(XLayers[XLayerIndex]);
-							}
-							XLayerIndex++;
+							ValidXLayers.Add(Layer);
+							return true;
 						}
-						else if (LayerIdA > LayerIdB)
+						PendingXLayers.Add(Layer);
+						return false;
+					};
+
+					for (const FLayerHandoff& XLayer : XLayers)
+					{
+						while (LayerIndex_RenderThread < Layers_RenderThread.Num() && Layers_RenderThread[LayerIndex_RenderThread]->GetId() < XLayer.Id)
 						{
 							DeferredDeletion.AddLayerToDeferredDeletionQueue(Layers_RenderThread[LayerIndex_RenderThread++]);
 						}
-						else
+
+						while (PendingLayerIndex < PendingLayers_RenderThread.Num() && PendingLayers_RenderThread[PendingLayerIndex]->GetId() < XLayer.Id)
+						{
+							PendingLayerIndex++;
+						}
+
+						const FLayerPtr* Layer_RenderThread = LayerIndex_RenderThread < Layers_RenderThread.Num() && Layers_RenderThread[LayerIndex_RenderThread]->GetId() == XLayer.Id ? &Layers_RenderThread[LayerIndex_RenderThread] : nullptr;
+
+						if (XLayer.Layer.IsValid())
 						{
-							if (XLayers[XLayerIndex]->Initialize_RenderThread(Settings_RenderThread.Get(), CustomPresent, &DeferredDeletion, RHICmdList, Layers_RenderThread[LayerIndex_RenderThread].Get()))
+							if (InitializeLayer(XLayer.Layer, Layer_RenderThread ? Layer_RenderThread->Get() : nullptr) && Layer_RenderThread)
 							{
 								LayerIndex_RenderThread++;
-								ValidXLayers.Add(XLayers[XLayerIndex]);
 							}
-							XLayerIndex++;
 						}
-					}
+						else if (Layer_RenderThread)
+						{
+							(*Layer_RenderThread)->SetPose(XLayer.Pose);
 
-					while (XLayerIndex < XLayers.Num())
-					{
-						if (XLayers[XLayerIndex]->Initialize_RenderThread(Settings_RenderThread.Get(), CustomPresent, &DeferredDeletion, RHICmdList))
+							if ((*Layer_RenderThread)->Revalidate_RenderThread(CustomPresent))
+							{
+								ValidXLayers.Add(*Layer_RenderThread);
+								LayerIndex_RenderThread++;
+							}
+							else if (InitializeLayer((*Layer_RenderThread)->Clone(), Layer_RenderThread->Get()))
+							{
+								LayerIndex_RenderThread++;
+							}
+						}
+						else if (PendingLayerIndex < PendingLayers_RenderThread.Num() && PendingLayers_RenderThread[PendingLayerIndex]->GetId() == XLayer.Id)
 						{
-							ValidXLayers.Add(XLayers[XLayerIndex]);
+							PendingLayers_RenderThread[PendingLayerIndex]->SetPose(XLayer.Pose);
+							InitializeLayer(PendingLayers_RenderThread[PendingLayerIndex], nullptr);
 						}
-						XLayerIndex++;
 					}
 
 					while (LayerIndex_RenderThread < Layers_RenderThread.Num())
@@ -4834,7 +4990,8 @@ namespace OculusXRHMD
 						DeferredDeletion.AddLayerToDeferredDeletionQueue(Layers_RenderThread[LayerIndex_RenderThread++]);
 					}
 
-					Layers_RenderThread = ValidXLayers;
+					Layers_RenderThread = MoveTemp(ValidXLayers);
+					PendingLayers_RenderThread = MoveTemp(PendingXLayers);
 
 					DeferredDeletion.HandleLayerDeferredDeletionQueue_RenderThread();
 				}
@@ -4880,21 +5037,49 @@ namespace OculusXRHMD
 		{
 			UE_LOG(LogHMD, VeryVerbose, TEXT("StartRHIFrame %u"), Frame_RenderThread->FrameNumber);
 
-			FSettingsPtr XSettings = Settings_RenderThread->Clone();
-			FGameFramePtr XFrame = Frame_RenderThread->Clone();
-			TArray<FLayerPtr> XLayers = Layers_RenderThread;
+			FSettingsPtr XSettings = SettingsPool_RenderThread.CopyFrom(*Settings_RenderThread);
+			FGameFramePtr XFrame = FramePool_RenderThread.CopyFrom(*Frame_RenderThread);
+			TArray<FLayerHandoff> XLayers;
+
+			XLayers.Empty(Layers_RenderThread.Num());
+
+			// The RHI thread writes the submit state of its copies, so a layer is only copied again once the render thread replaced it.
+			// Poses change in place every frame and are handed along with the copy.
+			for (const FLayerPtr& Layer : Layers_RenderThread)
+			{
+				TPair<TWeakPtr<FLayer, ESPMode::ThreadSafe>, FLayerPtr>* LayerCopy = LayerCopies_RenderThread.Find(Layer->GetId());
+
+				if (!LayerCopy || LayerCopy->Key.Pin() != Layer)
+				{
+					LayerCopy = &LayerCopies_RenderThread.Add(Layer->GetId(), TPair<TWeakPtr<FLayer, ESPMode::ThreadSafe>, FLayerPtr>(Layer, Layer->Clone()));
+				}
+
+				XLayers.Add(FLayerHandoff{ Layer->GetId(), LayerCopy->Value, Layer->GetPose() });
+			}
 
-			for (int32 XLayerIndex = 0; XLayerIndex < XLayers.Num(); XLayerIndex++)
+			if (LayerCopies_RenderThread.Num() != Layers_RenderThread.Num())
 			{
-				XLayers[XLayerIndex] = XLayers[XLayerIndex]->Clone();
+				for (auto It = LayerCopies_RenderThread.CreateIterator(); It; ++It)
+				{
+					if (!XLayers.ContainsByPredicate([Id = It.Key()](const FLayerHandoff& XLayer) { return XLayer.Id == Id; }))
+					{
+						It.RemoveCurrent();
+					}
+				}
 			}
 
-			ExecuteOnRHIThread_DoNotWait([this, XSettings, XFrame, XLayers]() {
+			ExecuteOnRHIThread_DoNotWait([this, XSettings, XFrame, XLayers = MoveTemp(XLayers)]() {
 				if (XFrame.IsValid())
 				{
 					Settings_RHIThread = XSettings;
 					Frame_RHIThread = XFrame;
-					Layers_RHIThread = XLayers;
+
+					Layers_RHIThread.Reset(XLayers.Num());
+					for (const FLayerHandoff& XLayer : XLayers)
+					{
+						XLayer.Layer->SetPose(XLayer.Pose);
+						Layers_RHIThread.Add(XLayer.Layer);
+					}
 
 					ovrpXrApi NativeXrApi;
 					FOculusXRHMDModule::GetPluginWrapper().GetNativeXrApiType(&NativeXrApi);
@@ -4994,6 +5179,21 @@ namespace OculusXRHMD
 		EventPollingDelegates.Add(NewDelegate);
 	}
 
+	FDelegateHandle FOculusXRHMD::AddEventDelegate(ovrpEventType EventType, const FOculusXRHMDEventDelegate& Delegate, SIZE_T LegacyEventSize)
+	{
+		return EventRouter.Add(EventType, Delegate, LegacyEventSize);
+	}
+
+	void FOculusXRHMD::RemoveEventDelegate(FDelegateHandle Handle)
+	{
+		EventRouter.Remove(Handle);
+	}
+
+	bool FOculusXRHMD::GetEventStats(ovrpEventType EventType, FEventRouter::FEventStats& OutStats) const
+	{
+		return EventRouter.GetStats(EventType, OutStats);
+	}
+
 	/// @cond DOXYGEN_WARNINGS
 
 #define BOOLEAN_COMMAND_HANDLER_BODY(ConsoleName, FieldExpr)                        \
@@ -5077,6 +5277,18 @@ namespace OculusXRHMD
 		Ar.Logf(TEXT("vr.oculus.Debug.IPD = %f"), GetInterpupillaryDistance());
 	}
 
+	void FOculusXRHMD::EventStatsCommandHandler(const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar)
+	{
+		CheckInGameThread();
+
+		if (Args.Num() > 0 && Args[0].Equals(TEXT("reset"), ESearchCase::IgnoreCase))
+		{
+			EventRouter.ResetStats();
+			return;
+		}
+		EventRouter.DumpStats(Ar);
+	}
+
 #endif // !UE_BUILD_SHIPPING
 
 	void FOculusXRHMD::LoadFromSettings()
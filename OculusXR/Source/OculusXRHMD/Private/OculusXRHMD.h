@@ -15,11 +15,15 @@
 #include "OculusXRHMD_SpectatorScreenController.h"
 #include "OculusXRHMD_DynamicResolutionState.h"
 #include "OculusXRHMD_DeferredDeletionQueue.h"
+#include "OculusXRHMD_FrameStatePool.h"
+#include "OculusXRHMD_PoseCache.h"
+#include "OculusXRHMD_EventRouter.h"
 
 #include "OculusXRAssetManager.h"
 
 #include "HeadMountedDisplayBase.h"
 #include "HeadMountedDisplay.h"
+#include "IMotionController.h"
 #include "XRRenderTargetManager.h"
 #include "XRRenderBridge.h"
 #include "IStereoLayers.h"
@@ -565,8 +569,18 @@ namespace OculusXRHMD
 
 		OCULUSXRHMD_API void UpdateRTPoses();
 
+		// Game thread. Poses recorded for the last FPoseHistory::Capacity frames, stamped with their predicted display time
+		OCULUSXRHMD_API double GetPredictedDisplayTime();
+		OCULUSXRHMD_API bool GetPoseHistoryTimeRange(double& OutOldest, double& OutNewest) const;
+		OCULUSXRHMD_API bool GetPoseAtTime(int32 InDeviceId, double DisplayTime, FQuat& OutOrientation, FVector& OutPosition);
+
 		FTransform GetLastTrackingToWorld() const { return LastTrackingToWorld; }
+		// Receives every polled event, prefer AddEventDelegate for the event types of interest
 		OCULUSXRHMD_API void AddEventPollingDelegate(const FOculusXRHMDEventPollingDelegate& NewDelegate);
+		// Game thread. See FEventRouter::Add for LegacyEventSize
+		OCULUSXRHMD_API FDelegateHandle AddEventDelegate(ovrpEventType EventType, const FOculusXRHMDEventDelegate& Delegate, SIZE_T LegacyEventSize = 0);
+		OCULUSXRHMD_API void RemoveEventDelegate(FDelegateHandle Handle);
+		OCULUSXRHMD_API bool GetEventStats(ovrpEventType EventType, FEventRouter::FEventStats& OutStats) const;
 
 		OCULUSXRHMD_API uint32 GetLayerIdFromOvrpId(int OvrpId) const;
 
@@ -581,6 +595,7 @@ namespace OculusXRHMD
 		void StatsCommandHandler(const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar);
 		void ShowSettingsCommandHandler(const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar);
 		void IPDCommandHandler(const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar);
+		void EventStatsCommandHandler(const TArray<FString>& Args, UWorld* World, FOutputDevice& Ar);
 #endif
 
 		void LoadFromSettings();
@@ -602,6 +617,9 @@ namespace OculusXRHMD
 		void ResetMultiPlayerPoses();
 		void ReCalcMultiPlayerPoses(FPose& CurHMDHeadPose);
 
+		IMotionController* GetInputMotionController();
+		void OnModularFeatureUnregistered(const FName& Type, IModularFeature* ModularFeature);
+
 		union
 		{
 			struct
@@ -671,12 +689,34 @@ namespace OculusXRHMD
 		FGameFramePtr LastFrameToRender; // Valid from OnStartGameFrame to BeginRenderViewFamily
 		uint32 NextLayerId;
 		TMap<uint32, FLayerPtr> LayerMap;
+		TMap<uint32, uint32> LayerGenerations; // Generation of each layer last handed to the render thread
+		TFrameStatePool<FSettings> SettingsPool;
+		TFrameStatePool<FGameFrame> FramePool;
+		FPoseSnapshot PoseSnapshot;
+		FPoseHistory PoseHistory;
+		IMotionController* InputMotionController; // OculusXRInput device, cleared when it is unregistered
+		FDelegateHandle ModularFeatureUnregisteredHandle;
+		struct FMotionControllerDataCache
+		{
+			uint32 FrameNumber = 0;
+			float WorldToMeters = 0.0f;
+			FTransform TrackingToWorld;
+			FQuat BaseOrientation;
+			FVector BaseOffset;
+			FXRMotionControllerData Data;
+		};
+		FMotionControllerDataCache MotionControllerDataCache[2]; // Per hand, valid for a frame while its inputs match
 		bool bNeedReAllocateViewportRenderTarget;
 
 		// Render thread
 		FSettingsPtr Settings_RenderThread;
 		FGameFramePtr Frame_RenderThread; // Valid from BeginRenderViewFamily to PostRenderViewFamily_RenderThread
 		TArray<FLayerPtr> Layers_RenderThread;
+		TArray<FLayerPtr> PendingLayers_RenderThread; // Handed off layers that failed to initialize, retried while unchanged
+		TMap<uint32, TPair<TWeakPtr<FLayer, ESPMode::ThreadSafe>, FLayerPtr>> LayerCopies_RenderThread; // Copy handed to the RHI thread for each layer
+		TFrameStatePool<FSettings> SettingsPool_RenderThread;
+		TFrameStatePool<FGameFrame> FramePool_RenderThread;
+		FPoseSnapshot PoseSnapshot_RenderThread;
 		FLayerPtr EyeLayer_RenderThread; // Valid to be accessed from game thread, since updated only when game thread is waiting
 		bool bNeedReAllocateDepthTexture_RenderThread;
 		bool bNeedReAllocateFoveationTexture_RenderThread;
@@ -721,6 +761,7 @@ namespace OculusXRHMD
 		FOculusXRPerformanceMetrics PerformanceMetrics;
 
 		TArray<FOculusXRHMDEventPollingDelegate> EventPollingDelegates;
+		FEventRouter EventRouter;
 
 		// MultiPlayer
 		int CurPlayerIndex;
@@ -45,6 +45,9 @@ namespace OculusXRHMD
 		, IPDCommand(TEXT("vr.oculus.Debug.IPD"),
 			  *NSLOCTEXT("OculusRift", "CCommandText_IPD", "Oculus Rift specific extension.\nShows or changes the current interpupillary distance in meters.").ToString(),
 			  FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateRaw(InHMDPtr, &FOculusXRHMD::IPDCommandHandler))
+		, EventStatsCommand(TEXT("vr.oculus.Debug.EventStats"),
+			  *NSLOCTEXT("OculusRift", "CCommandText_EventStats", "Oculus Rift specific extension.\nShows how many events of each type were polled and how long their delegates took.\nPass reset to clear the stats.").ToString(),
+			  FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateRaw(InHMDPtr, &FOculusXRHMD::EventStatsCommandHandler))
 #endif // !UE_BUILD_SHIPPING
 	{
 	}
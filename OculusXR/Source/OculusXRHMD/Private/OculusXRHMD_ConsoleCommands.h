@@ -35,6 +35,7 @@ namespace OculusXRHMD
 		FAutoConsoleCommand CubemapCommand;
 		FAutoConsoleCommand ShowSettingsCommand;
 		FAutoConsoleCommand IPDCommand;
+		FAutoConsoleCommand EventStatsCommand;
 #endif // !UE_BUILD_SHIPPING
 	};
 
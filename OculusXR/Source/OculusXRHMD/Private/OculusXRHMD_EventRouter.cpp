@@ -0,0 +1,128 @@
+// Copyright (c) Meta Platforms, Inc. and affiliates.
+
+#include "OculusXRHMD_EventRouter.h"
+
+#if OCULUS_HMD_SUPPORTED_PLATFORMS
+
+namespace OculusXRHMD
+{
+
+	//-------------------------------------------------------------------------------------------------
+	// FEventRouter
+	//-------------------------------------------------------------------------------------------------
+
+	// Offset of the payload in legacy event structs, the runtime writes it right after EventType
+	static constexpr SIZE_T LegacyEventPayloadOffset = 8;
+
+	FDelegateHandle FEventRouter::Add(ovrpEventType EventType, const FOculusXRHMDEventDelegate& Delegate, SIZE_T LegacyEventSize)
+	{
+		CheckInGameThread();
+		check(LegacyEventSize == 0 || (LegacyEventSize > LegacyEventPayloadOffset && LegacyEventSize <= sizeof(ovrpEventDataBuffer)));
+
+		FRoute& Route = FindOrAddRoute(EventType);
+		if (LegacyEventSize > 0)
+		{
+			ensureMsgf(Route.LegacyEventSize == 0 || Route.LegacyEventSize == LegacyEventSize, TEXT("Event type %d registered with different legacy sizes"), static_cast<int32>(EventType));
+			Route.LegacyEventSize = FMath::Max(Route.LegacyEventSize, LegacyEventSize);
+		}
+
+		FDelegateHandle Handle(FDelegateHandle::GenerateNewHandle);
+		Route.Delegates.Emplace(Handle, Delegate);
+		return Handle;
+	}
+
+	void FEventRouter::Remove(FDelegateHandle Handle)
+	{
+		CheckInGameThread();
+
+		for (TPair<ovrpEventType, TUniquePtr<FRoute>>& Pair : Routes)
+		{
+			if (Pair.Value->Delegates.RemoveAll([&Handle](const TPair<FDelegateHandle, FOculusXRHMDEventDelegate>& Entry) { return Entry.Key == Handle; }) > 0)
+			{
+				return;
+			}
+		}
+	}
+
+	FEventRouter::FRoute& FEventRouter::FindOrAddRoute(ovrpEventType EventType)
+	{
+		TUniquePtr<FRoute>& Route = Routes.FindOrAdd(EventType);
+		if (!Route)
+		{
+			Route = MakeUnique<FRoute>();
+		}
+		return *Route;
+	}
+
+	void FEventRouter::Reset()
+	{
+		Routes.Reset();
+	}
+
+	bool FEventRouter::Dispatch(ovrpEventDataBuffer& Buffer)
+	{
+		const uint64 StartCycles = FPlatformTime::Cycles64();
+
+		FRoute& Route = FindOrAddRoute(Buffer.EventType);
+		Route.Stats.Count++;
+
+		if (Route.Delegates.Num() == 0)
+		{
+			return false;
+		}
+
+		if (Route.LegacyEventSize > 0)
+		{
+			FMemory::Memmove(reinterpret_cast<uint8*>(&Buffer) + LegacyEventPayloadOffset, Buffer.EventData, Route.LegacyEventSize - LegacyEventPayloadOffset);
+		}
+
+		// Delegates registered or removed by a delegate take effect from the next event
+		for (int32 Index = 0, Num = Route.Delegates.Num(); Index < FMath::Min(Num, Route.Delegates.Num()); Index++)
+		{
+			Route.Delegates[Index].Value.ExecuteIfBound(Buffer);
+		}
+
+		const uint64 Cycles = FPlatformTime::Cycles64() - StartCycles;
+		Route.Stats.TotalCycles += Cycles;
+		Route.Stats.MaxCycles = FMath::Max(Route.Stats.MaxCycles, Cycles);
+		return true;
+	}
+
+	bool FEventRouter::GetStats(ovrpEventType EventType, FEventStats& OutStats) const
+	{
+		const TUniquePtr<FRoute>* Route = Routes.Find(EventType);
+		if (!Route)
+		{
+			return false;
+		}
+
+		OutStats = (*Route)->Stats;
+		return true;
+	}
+
+	void FEventRouter::ResetStats()
+	{
+		for (TPair<ovrpEventType, TUniquePtr<FRoute>>& Pair : Routes)
+		{
+			Pair.Value->Stats = FEventStats();
+		}
+	}
+
+	void FEventRouter::DumpStats(FOutputDevice& Ar) const
+	{
+		Ar.Logf(TEXT("%10s %10s %10s %12s %12s"), TEXT("EventType"), TEXT("Delegates"), TEXT("Count"), TEXT("Total (ms)"), TEXT("Max (ms)"));
+		for (const TPair<ovrpEventType, TUniquePtr<FRoute>>& Pair : Routes)
+		{
+			const FEventStats& Stats = Pair.Value->Stats;
+			Ar.Logf(TEXT("%10d %10d %10llu %12.3f %12.3f"),
+				static_cast<int32>(Pair.Key),
+				Pair.Value->Delegates.Num(),
+				Stats.Count,
+				FPlatformTime::ToMilliseconds64(Stats.TotalCycles),
+				FPlatformTime::ToMilliseconds64(Stats.MaxCycles));
+		}
+	}
+
+} // namespace OculusXRHMD
+
+#endif // OCULUS_HMD_SUPPORTED_PLATFORMS
@@ -0,0 +1,76 @@
+// Copyright (c) Meta Platforms, Inc. and affiliates.
+
+#pragma once
+#include "OculusXRHMDPrivate.h"
+
+#if OCULUS_HMD_SUPPORTED_PLATFORMS
+#include "Misc/OutputDevice.h"
+
+namespace OculusXRHMD
+{
+
+	DECLARE_DELEGATE_OneParam(FOculusXRHMDEventDelegate, const ovrpEventDataBuffer&);
+
+	// Alignment of the buffer events are polled into, so the typed views below are aligned
+	static constexpr SIZE_T EventBufferAlignment = 8;
+
+	/** Typed view of an event routed by FEventRouter, valid for the duration of the delegate call */
+	template <typename T>
+	const T& GetEventData(const ovrpEventDataBuffer& Buffer)
+	{
+		static_assert(sizeof(T) <= sizeof(ovrpEventDataBuffer), "Event does not fit in the event buffer");
+		static_assert(alignof(T) <= EventBufferAlignment, "Event is more aligned than the event buffer");
+		return *reinterpret_cast<const T*>(&Buffer);
+	}
+
+	//-------------------------------------------------------------------------------------------------
+	// FEventRouter
+	//-------------------------------------------------------------------------------------------------
+
+	/**
+	 * Hands each polled event only to the delegates registered for its type, and keeps per type counters and timings.
+	 * Game thread only.
+	 */
+	class FEventRouter
+	{
+	public:
+		struct FEventStats
+		{
+			uint64 Count = 0;
+			uint64 TotalCycles = 0;
+			uint64 MaxCycles = 0;
+		};
+
+		/**
+		 * Registers Delegate for EventType. Events whose struct pads EventType to 8 bytes, while the runtime packs the payload
+		 * right after it, pass the struct size as LegacyEventSize: the payload is moved in place once, before any delegate runs.
+		 */
+		FDelegateHandle Add(ovrpEventType EventType, const FOculusXRHMDEventDelegate& Delegate, SIZE_T LegacyEventSize = 0);
+		void Remove(FDelegateHandle Handle);
+		void Reset();
+
+		/** Calls the delegates of the event type, returns false if none is registered. May rewrite a legacy payload in place. */
+		bool Dispatch(ovrpEventDataBuffer& Buffer);
+
+		bool GetStats(ovrpEventType EventType, FEventStats& OutStats) const;
+		void ResetStats();
+		void DumpStats(FOutputDevice& Ar) const;
+
+	private:
+		struct FRoute
+		{
+			TArray<TPair<FDelegateHandle, FOculusXRHMDEventDelegate>, TInlineAllocator<1>> Delegates;
+			SIZE_T LegacyEventSize = 0;
+			FEventStats Stats;
+		};
+
+		FRoute& FindOrAddRoute(ovrpEventType EventType);
+
+		// Unrouted event types get an entry without delegates, so they are counted too. Routes are
+		// allocated separately so delegates registering other event types do not move the one being dispatched.
+		TMap<ovrpEventType, TUniquePtr<FRoute>> Routes;
+	};
+
+} // namespace OculusXRHMD
+
+#endif // OCULUS_HMD_SUPPORTED_PLATFORMS
@@ -0,0 +1,57 @@
+// Copyright (c) Meta Platforms, Inc. and affiliates.
+
+#pragma once
+#include "OculusXRHMDPrivate.h"
+
+#if OCULUS_HMD_SUPPORTED_PLATFORMS
+
+namespace OculusXRHMD
+{
+
+	//-------------------------------------------------------------------------------------------------
+	// TFrameStatePool
+	//-------------------------------------------------------------------------------------------------
+
+	/**
+	 * Recycles the per-frame copies of FSettings and FGameFrame handed from one thread to the next. A copy is reused
+	 * once the pool holds its only reference, so the receiving thread owns it exclusively until it lets go of it.
+	 * Three copies cover the one being read, the one in flight and the one being written.
+	 */
+	template <typename T>
+	class TFrameStatePool
+	{
+	public:
+		typedef TSharedPtr<T, ESPMode::ThreadSafe> FStatePtr;
+
+		static constexpr int32 NumBuffers = 3;
+
+		FStatePtr CopyFrom(const T& Source)
+		{
+			for (FStatePtr& Entry : Entries)
+			{
+				if (Entry.IsUnique())
+				{
+					// The other thread released it, make its last reads visible before overwriting
+					FPlatformMisc::MemoryBarrier();
+					*Entry = Source;
+					return Entry;
+				}
+			}
+
+			FStatePtr Entry = Source.Clone();
+			if (Entries.Num() < NumBuffers)
+			{
+				Entries.Add(Entry);
+			}
+			return Entry;
+		}
+
+		void Reset() { Entries.Reset(); }
+
+	private:
+		TArray<FStatePtr, TInlineAllocator<NumBuffers>> Entries;
+	};
+
+} // namespace OculusXRHMD
+
+#endif // OCULUS_HMD_SUPPORTED_PLATFORMS
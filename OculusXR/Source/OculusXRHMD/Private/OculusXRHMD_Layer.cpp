@@ -59,6 +59,7 @@ namespace OculusXRHMD
 	FLayer::FLayer(uint32 InId)
 		: bNeedsTexSrgbCreate(false)
 		, Id(InId)
+		, Generation(0)
 		, OvrpLayerId(0)
 		, bUpdateTexture(false)
 		, bInvertY(false)
@@ -75,6 +76,7 @@ namespace OculusXRHMD
 	FLayer::FLayer(const FLayer& Layer)
 		: bNeedsTexSrgbCreate(Layer.bNeedsTexSrgbCreate)
 		, Id(Layer.Id)
+		, Generation(Layer.Generation)
 		, Desc(Layer.Desc)
 		, OvrpLayerId(Layer.OvrpLayerId)
 		, OvrpLayer(Layer.OvrpLayer)
@@ -91,6 +93,7 @@ namespace OculusXRHMD
 		, bHasDepth(Layer.bHasDepth)
 		, bSupportDepthComposite(Layer.bSupportDepthComposite)
 		, bSubmitSpaceWarp(Layer.bSubmitSpaceWarp)
+		, TextureKey(Layer.TextureKey)
 		, PokeAHoleComponentPtr(Layer.PokeAHoleComponentPtr)
 		, PokeAHoleActor(Layer.PokeAHoleActor)
 		, UserDefinedGeometryMap(Layer.UserDefinedGeometryMap)
@@ -112,6 +115,7 @@ namespace OculusXRHMD
 		}
 
 		Desc = InDesc;
+		Generation++;
 
 		if (!UserDefinedGeometryMap)
 		{
@@ -143,6 +147,76 @@ namespace OculusXRHMD
 		SetDesc(InDesc);
 	}
 
+	bool FLayer::TrySetPose(const FSettings* Settings, const IStereoLayers::FLayerDesc& InDesc)
+	{
+		CheckInGameThread();
+
+		uint32 InFlags = InDesc.Flags;
+#if !PLATFORM_ANDROID
+		InFlags |= IStereoLayers::LAYER_FLAG_SUPPORT_DEPTH;
+#endif
+
+		// Compare the desc fields used to create and submit the layer, anything else goes through SetDesc
+		PRAGMA_DISABLE_DEPRECATION_WARNINGS
+		if (InFlags != Desc.Flags || InDesc.PositionType != Desc.PositionType || InDesc.QuadSize != Desc.QuadSize || !(InDesc.UVRect == Desc.UVRect) || InDesc.LayerSize != Desc.LayerSize || InDesc.TextureObj != Desc.TextureObj || InDesc.LeftTextureObj != Desc.LeftTextureObj || InDesc.Texture != Desc.Texture || InDesc.LeftTexture != Desc.LeftTexture || Settings->Flags.bCompositeDepth != bSupportDepthComposite)
+		{
+			return false;
+		}
+		PRAGMA_ENABLE_DEPRECATION_WARNINGS
+
+		// Passthrough shapes always go through SetDesc, which keeps their geometry and poke-a-hole actors up to date
+		if (Desc.HasShape<FQuadLayer>())
+		{
+			if (!InDesc.HasShape<FQuadLayer>())
+			{
+				return false;
+			}
+		}
+		else if (Desc.HasShape<FCylinderLayer>())
+		{
+			if (!InDesc.HasShape<FCylinderLayer>())
+			{
+				return false;
+			}
+
+			const FCylinderLayer& CylinderProps = Desc.GetShape<FCylinderLayer>();
+			const FCylinderLayer& InCylinderProps = InDesc.GetShape<FCylinderLayer>();
+			if (CylinderProps.Radius != InCylinderProps.Radius || CylinderProps.OverlayArc != InCylinderProps.OverlayArc || CylinderProps.Height != InCylinderProps.Height)
+			{
+				return false;
+			}
+		}
+		else if (Desc.HasShape<FCubemapLayer>())
+		{
+			if (!InDesc.HasShape<FCubemapLayer>())
+			{
+				return false;
+			}
+		}
+		else if (Desc.HasShape<FEquirectLayer>())
+		{
+			if (!InDesc.HasShape<FEquirectLayer>())
+			{
+				return false;
+			}
+
+			const FEquirectLayer& EquirectProps = Desc.GetShape<FEquirectLayer>();
+			const FEquirectLayer& InEquirectProps = InDesc.GetShape<FEquirectLayer>();
+			if (!(EquirectProps.LeftUVRect == InEquirectProps.LeftUVRect) || !(EquirectProps.RightUVRect == InEquirectProps.RightUVRect) || EquirectProps.LeftScale != InEquirectProps.LeftScale || EquirectProps.RightScale != InEquirectProps.RightScale || EquirectProps.LeftBias != InEquirectProps.LeftBias || EquirectProps.RightBias != InEquirectProps.RightBias)
+			{
+				return false;
+			}
+		}
+		else
+		{
+			return false;
+		}
+
+		SetPose(FLayerPose{ InDesc.Transform, InDesc.Priority });
+		HandlePokeAHoleComponent();
+		return true;
+	}
+
 	static UWorld* GetWorld()
 	{
 		UWorld* World = nullptr;
@@ -439,6 +513,7 @@ namespace OculusXRHMD
 
 		bHasDepth = InEyeLayerDesc.DepthFormat != ovrpTextureFormat_None;
 		bSubmitSpaceWarp = bInSubmitSpaceWarp;
+		Generation++;
 	}
 
 	TSharedPtr<FLayer, ESPMode::ThreadSafe> FLayer::Clone() const
@@ -481,28 +556,9 @@ namespace OculusXRHMD
 		{
 			bInvertY = (CustomPresent->GetLayerFlags() & ovrpLayerFlag_TextureOriginAtBottomLeft) != 0;
 
-			uint32 SizeX = 0, SizeY = 0;
-
-			if (Desc.TextureObj.IsValid())
-			{
-				FRHITexture* Texture2D = Desc.TextureObj->GetResource()->GetTextureReference()->GetTexture2D();
-				FRHITexture* TextureCube = Desc.TextureObj->GetResource()->GetTextureReference()->GetTextureCube();
-
-				if (Texture2D)
-				{
-					SizeX = Texture2D->GetSizeX();
-					SizeY = Texture2D->GetSizeY();
-				}
-				else if (TextureCube)
-				{
-					SizeX = SizeY = TextureCube->GetSize();
-				}
-			}
-			else
-			{
-				SizeX = Desc.LayerSize.X;
-				SizeY = Desc.LayerSize.Y;
-			}
+			TextureKey = GetTextureKey_RenderThread(CustomPresent);
+			const uint32 SizeX = TextureKey.SizeX;
+			const uint32 SizeY = TextureKey.SizeY;
 
 			ovrpShape Shape;
 
@@ -540,12 +596,8 @@ namespace OculusXRHMD
 				return false;
 			}
 
-			EPixelFormat Format = Desc.TextureObj.IsValid() ? CustomPresent->GetPixelFormat(Desc.TextureObj->GetResource()->GetTextureReference()->GetFormat()) : CustomPresent->GetDefaultPixelFormat();
-#if PLATFORM_ANDROID
-			uint32 NumMips = Desc.Texture.IsValid() ? Desc.Texture->GetNumMips() : 1;
-#else
-			uint32 NumMips = 0;
-#endif
+			EPixelFormat Format = TextureKey.Format;
+			uint32 NumMips = TextureKey.NumMips;
 			uint32 NumSamples = 1;
 			int LayerFlags = CustomPresent->GetLayerFlags();
 
@@ -882,6 +934,58 @@ namespace OculusXRHMD
 		return true;
 	}
 
+	bool FLayer::Revalidate_RenderThread(FCustomPresent* CustomPresent)
+	{
+		CheckInRenderThread();
+
+		// The eye layer desc only changes through SetEyeLayerDesc, which hands a new copy to the render thread
+		if (Id != 0 && !(GetTextureKey_RenderThread(CustomPresent) == TextureKey))
+		{
+			return false;
+		}
+
+		if ((Desc.Flags & IStereoLayers::LAYER_FLAG_TEX_CONTINUOUS_UPDATE) && Desc.TextureObj.IsValid() && IsVisible())
+		{
+			bUpdateTexture = true;
+		}
+
+		return true;
+	}
+
+	FLayer::FTextureKey FLayer::GetTextureKey_RenderThread(FCustomPresent* CustomPresent) const
+	{
+		FTextureKey Key;
+
+		if (Desc.TextureObj.IsValid())
+		{
+			FRHITexture* Texture2D = Desc.TextureObj->GetResource()->GetTextureReference()->GetTexture2D();
+			FRHITexture* TextureCube = Desc.TextureObj->GetResource()->GetTextureReference()->GetTextureCube();
+
+			if (Texture2D)
+			{
+				Key.SizeX = Texture2D->GetSizeX();
+				Key.SizeY = Texture2D->GetSizeY();
+			}
+			else if (TextureCube)
+			{
+				Key.SizeX = Key.SizeY = TextureCube->GetSize();
+			}
+		}
+		else
+		{
+			Key.SizeX = Desc.LayerSize.X;
+			Key.SizeY = Desc.LayerSize.Y;
+		}
+
+		Key.Format = Desc.TextureObj.IsValid() ? CustomPresent->GetPixelFormat(Desc.TextureObj->GetResource()->GetTextureReference()->GetFormat()) : CustomPresent->GetDefaultPixelFormat();
+#if PLATFORM_ANDROID
+		Key.NumMips = Desc.Texture.IsValid() ? Desc.Texture->GetNumMips() : 1;
+#else
+		Key.NumMips = 0;
+#endif
+		return Key;
+	}
+
 	void FLayer::UpdatePassthroughStyle_RenderThread(const FEdgeStyleParameters& EdgeStyleParameters)
 	{
 		ovrpInsightPassthroughStyle Style;
@@ -986,7 +1090,7 @@ namespace OculusXRHMD
 						const FMatrix Transform = TransformToPassthroughSpace(GeometryDesc.Transform, Frame);
 						uint64_t MeshHandle = 0;
 						uint64_t InstanceHandle = 0;
-						AddPassthroughMesh_RenderThread(GeomPassthroughMesh->GetVertices(), GeomPassthroughMesh->GetTriangles(), Transform, MeshHandle, InstanceHandle);
+						AddPassthroughMesh_RenderThread(GeomPassthroughMesh, Transform, MeshHandle, InstanceHandle);
 						UserDefinedGeometryMap->Add(MeshName, FPassthroughMesh(MeshHandle, InstanceHandle));
 					}
 				}
@@ -1421,29 +1525,20 @@ namespace OculusXRHMD
 		bUpdateTexture = false;
 	}
 
-	void FLayer::AddPassthroughMesh_RenderThread(const TArray<FVector>& Vertices, const TArray<int32>& Triangles, FMatrix Transformation, uint64_t& OutMeshHandle, uint64_t& OutInstanceHandle)
+	void FLayer::AddPassthroughMesh_RenderThread(const FOculusPassthroughMeshRef& PassthroughMesh, FMatrix Transformation, uint64_t& OutMeshHandle, uint64_t& OutInstanceHandle)
 	{
 		CheckInRenderThread();
 
 		uint64_t MeshHandle = 0;
 		uint64_t InstanceHandle = 0;
 
-		// Explicit conversion is needed since FVector contains double elements.
-		// Converting Vertices.Data() to float* causes issues when memory is parsed.
-		TArray<float> VertexData;
-		VertexData.SetNumUninitialized(Vertices.Num() * 3);
-
-		size_t i = 0;
-		for (const FVector& vertex : Vertices)
-		{
-			VertexData[i++] = vertex.X;
-			VertexData[i++] = vertex.Y;
-			VertexData[i++] = vertex.Z;
-		}
+		// The mesh keeps a float copy of its vertices, FVector contains double elements
+		const TArray<FVector3f>& Vertices = PassthroughMesh->GetVerticesFloat();
+		const TArray<int32>& Triangles = PassthroughMesh->GetTriangles();
 
 		if (OVRP_FAILURE(FOculusXRHMDModule::GetPluginWrapper().CreateInsightTriangleMesh(
 				OvrpLayerId,
-				VertexData.GetData(),
+				(float*)Vertices.GetData(),
 				Vertices.Num(),
 				(int*)Triangles.GetData(),
 				Triangles.Num() / 3,
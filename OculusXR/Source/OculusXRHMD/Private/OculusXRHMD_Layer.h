@@ -33,6 +33,17 @@ namespace OculusXRHMD
 
 	typedef TSharedPtr<FOvrpLayer, ESPMode::ThreadSafe> FOvrpLayerPtr;
 
+	//-------------------------------------------------------------------------------------------------
+	// FLayerPose
+	//-------------------------------------------------------------------------------------------------
+
+	// Part of a layer desc that can change every frame without copying or reallocating the layer
+	struct FLayerPose
+	{
+		FTransform Transform;
+		int32 Priority;
+	};
+
 	//-------------------------------------------------------------------------------------------------
 	// FLayer
 	//-------------------------------------------------------------------------------------------------
@@ -49,6 +60,14 @@ namespace OculusXRHMD
 		void SetDesc(const IStereoLayers::FLayerDesc& InDesc);
 		void SetDesc(const FSettings* Settings, const IStereoLayers::FLayerDesc& InDesc);
 		const IStereoLayers::FLayerDesc& GetDesc() const { return Desc; }
+		FLayerPose GetPose() const { return FLayerPose{ Desc.Transform, Desc.Priority }; }
+		void SetPose(const FLayerPose& Pose)
+		{
+			Desc.Transform = Pose.Transform;
+			Desc.Priority = Pose.Priority;
+		}
+		// Applies InDesc in place if it only moves or reorders the layer. Returns false if the layer needs SetDesc.
+		bool TrySetPose(const FSettings* Settings, const IStereoLayers::FLayerDesc& InDesc);
 		void SetEyeLayerDesc(const ovrpLayerDesc_EyeFov& InEyeLayerDesc, bool bInSubmitSpaceWarp);
 		const FXRSwapChainPtr& GetSwapChain() const { return SwapChain; }
 		const FXRSwapChainPtr& GetRightSwapChain() const { return RightSwapChain; }
@@ -56,7 +75,13 @@ namespace OculusXRHMD
 		const FXRSwapChainPtr& GetFoveationSwapChain() const { return FoveationSwapChain; }
 		const FXRSwapChainPtr& GetMotionVectorSwapChain() const { return MotionVectorSwapChain; }
 		const FXRSwapChainPtr& GetMotionVectorDepthSwapChain() const { return MotionVectorDepthSwapChain; }
-		void MarkTextureForUpdate() { bUpdateTexture = true; }
+		void MarkTextureForUpdate()
+		{
+			bUpdateTexture = true;
+			Generation++;
+		}
+		// Bumped on every game thread change, so the render thread only receives the layers that changed
+		uint32 GetGeneration() const { return Generation; }
 		bool NeedsPokeAHole();
 		void HandlePokeAHoleComponent();
 		void BuildPokeAHoleMesh(TArray<FVector>& Vertices, TArray<int32>& Triangles, TArray<FVector2D>& UV0);
@@ -72,6 +97,8 @@ namespace OculusXRHMD
 
 		bool CanReuseResources(const FLayer* InLayer) const;
 		bool Initialize_RenderThread(const FSettings* Settings, FCustomPresent* CustomPresent, FDeferredDeletionQueue* DeferredDeletion, FRHICommandListImmediate& RHICmdList, const FLayer* InLayer = nullptr);
+		// Keeps an initialized layer the game thread did not change for another frame. Returns false if its texture resource changed and it must be initialized again.
+		bool Revalidate_RenderThread(FCustomPresent* CustomPresent);
 		void UpdateTexture_RenderThread(const FSettings* Settings, FCustomPresent* CustomPresent, FRHICommandListImmediate& RHICmdList);
 		void UpdatePassthrough_RenderThread(FCustomPresent* CustomPresent, FRHICommandListImmediate& RHICmdList, const FGameFrame* Frame);
 
@@ -82,7 +109,7 @@ namespace OculusXRHMD
 
 		bool bNeedsTexSrgbCreate;
 
-		void AddPassthroughMesh_RenderThread(const TArray<FVector>& Vertices, const TArray<int32>& Triangles, FMatrix Transformation, uint64_t& OutMeshHandle, uint64_t& OutInstanceHandle);
+		void AddPassthroughMesh_RenderThread(const FOculusPassthroughMeshRef& PassthroughMesh, FMatrix Transformation, uint64_t& OutMeshHandle, uint64_t& OutInstanceHandle);
 		void UpdatePassthroughMeshTransform_RenderThread(uint64_t InstanceHandle, FMatrix Transformation);
 		void RemovePassthroughMesh_RenderThread(uint64_t MeshHandle, uint64_t InstanceHandle);
 
@@ -119,7 +146,23 @@ namespace OculusXRHMD
 		bool BuildPassthroughPokeActor(FOculusPassthroughMeshRef PassthroughMesh, FPassthroughPokeActor& OutPassthroughPokeActor);
 		void UpdatePassthroughPokeActors_GameThread();
 
+		struct FTextureKey
+		{
+			uint32 SizeX = 0;
+			uint32 SizeY = 0;
+			uint32 NumMips = 0;
+			EPixelFormat Format = PF_Unknown;
+
+			bool operator==(const FTextureKey& Other) const
+			{
+				return SizeX == Other.SizeX && SizeY == Other.SizeY && NumMips == Other.NumMips && Format == Other.Format;
+			}
+		};
+
+		FTextureKey GetTextureKey_RenderThread(FCustomPresent* CustomPresent) const;
+
 		uint32 Id;
+		uint32 Generation;
 		IStereoLayers::FLayerDesc Desc;
 		int OvrpLayerId;
 		ovrpLayerDescUnion OvrpLayerDesc;
@@ -138,6 +181,7 @@ namespace OculusXRHMD
 		bool bHasDepth;
 		bool bSupportDepthComposite;
 		bool bSubmitSpaceWarp;
+		FTextureKey TextureKey; // Texture resource the layer was initialized from
 
 		UProceduralMeshComponent* PokeAHoleComponentPtr;
 		AActor* PokeAHoleActor;
@@ -148,6 +192,17 @@ namespace OculusXRHMD
 
 	typedef TSharedPtr<FLayer, ESPMode::ThreadSafe> FLayerPtr;
 
+	//-------------------------------------------------------------------------------------------------
+	// FLayerHandoff
+	//-------------------------------------------------------------------------------------------------
+
+	struct FLayerHandoff
+	{
+		uint32 Id;
+		FLayerPtr Layer; // Copy of the game thread layer, null if it did not change since the previous frame
+		FLayerPose Pose;
+	};
+
 	//-------------------------------------------------------------------------------------------------
 	// FLayerPtr_CompareId
 	//-------------------------------------------------------------------------------------------------
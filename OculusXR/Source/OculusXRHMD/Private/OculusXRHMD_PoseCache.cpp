@@ -0,0 +1,234 @@
+// Copyright (c) Meta Platforms, Inc. and affiliates.
+
+#include "OculusXRHMD_PoseCache.h"
+
+#if OCULUS_HMD_SUPPORTED_PLATFORMS
+#include "OculusXRHMDModule.h"
+
+namespace OculusXRHMD
+{
+
+	//-------------------------------------------------------------------------------------------------
+	// FPoseSnapshot
+	//-------------------------------------------------------------------------------------------------
+
+	FPoseSnapshot::FPoseSnapshot()
+		: bFilled(false)
+		, FrameNumber(0)
+		, DisplayTime(0.0)
+		, ValidNodes(0)
+		, ConvertedNodes(0)
+		, BaseOrientation(FQuat::Identity)
+		, BaseOffset(FVector::ZeroVector)
+		, WorldToMetersScale(0.0f)
+	{
+	}
+
+	void FPoseSnapshot::Fill(uint32 InFrameNumber)
+	{
+		bFilled = true;
+		FrameNumber = InFrameNumber;
+		DisplayTime = 0.0;
+		ValidNodes = 0;
+		ConvertedNodes = 0;
+
+		for (int32 NodeIndex = 0; NodeIndex < ovrpNode_Count; NodeIndex++)
+		{
+			ovrpPoseStatef PoseState;
+			if (OVRP_SUCCESS(FOculusXRHMDModule::GetPluginWrapper().GetNodePoseState3(ovrpStep_Render, FrameNumber, (ovrpNode)NodeIndex, &PoseState)))
+			{
+				TrackingPoses[NodeIndex] = FPose(ToFQuat(PoseState.Pose.Orientation), ToFVector(PoseState.Pose.Position));
+				ValidNodes |= 1ull << NodeIndex;
+
+				if (NodeIndex == ovrpNode_Head)
+				{
+					DisplayTime = PoseState.Time;
+				}
+			}
+		}
+	}
+
+	bool FPoseSnapshot::GetTrackingPose(ovrpNode Node, uint32 InFrameNumber, FPose& OutPose)
+	{
+		if (Node < 0 || Node >= ovrpNode_Count)
+		{
+			return false;
+		}
+
+		if (!bFilled || FrameNumber != InFrameNumber)
+		{
+			Fill(InFrameNumber);
+		}
+
+		if (!(ValidNodes & (1ull << Node)))
+		{
+			return false;
+		}
+
+		OutPose = TrackingPoses[Node];
+		return true;
+	}
+
+	bool FPoseSnapshot::GetPose(ovrpNode Node, uint32 InFrameNumber, const FSettings* Settings, float InWorldToMetersScale, FPose& OutPose)
+	{
+		FPose TrackingPose;
+		if (!GetTrackingPose(Node, InFrameNumber, TrackingPose))
+		{
+			return false;
+		}
+
+		if (ConvertedNodes && (!BaseOrientation.Equals(Settings->BaseOrientation, 0.0f) || !BaseOffset.Equals(Settings->BaseOffset, 0.0f) || WorldToMetersScale != InWorldToMetersScale))
+		{
+			ConvertedNodes = 0;
+		}
+
+		if (!(ConvertedNodes & (1ull << Node)))
+		{
+			BaseOrientation = Settings->BaseOrientation;
+			BaseOffset = Settings->BaseOffset;
+			WorldToMetersScale = InWorldToMetersScale;
+			ConvertPose_Internal(TrackingPose, Poses[Node], BaseOrientation, BaseOffset, WorldToMetersScale);
+			ConvertedNodes |= 1ull << Node;
+		}
+
+		OutPose = Poses[Node];
+		return true;
+	}
+
+	//-------------------------------------------------------------------------------------------------
+	// FPoseHistory
+	//-------------------------------------------------------------------------------------------------
+
+	FPoseHistory::FPoseHistory()
+		: Newest(Capacity - 1)
+		, Num(0)
+	{
+		Samples.SetNum(Capacity);
+	}
+
+	void FPoseHistory::Record(FPoseSnapshot& Snapshot, uint32 FrameNumber)
+	{
+		FPose Pose;
+		if (!Snapshot.GetTrackingPose(ovrpNode_Head, FrameNumber, Pose))
+		{
+			return;
+		}
+
+		FSample* Sample = AddSample(Snapshot.GetDisplayTime());
+		if (!Sample)
+		{
+			return;
+		}
+
+		for (int32 NodeIndex = 0; NodeIndex < ovrpNode_Count; NodeIndex++)
+		{
+			if (Snapshot.GetTrackingPose((ovrpNode)NodeIndex, FrameNumber, Sample->Poses[NodeIndex]))
+			{
+				Sample->ValidNodes |= 1ull << NodeIndex;
+			}
+		}
+	}
+
+	void FPoseHistory::Record(double Time, uint64 ValidNodes, const FPose (&Poses)[ovrpNode_Count])
+	{
+		FSample* Sample = AddSample(Time);
+		if (!Sample)
+		{
+			return;
+		}
+
+		Sample->ValidNodes = ValidNodes;
+		for (int32 NodeIndex = 0; NodeIndex < ovrpNode_Count; NodeIndex++)
+		{
+			Sample->Poses[NodeIndex] = Poses[NodeIndex];
+		}
+	}
+
+	FPoseHistory::FSample* FPoseHistory::AddSample(double Time)
+	{
+		// Frames are recorded once, in display order
+		if (Num > 0 && Time <= GetSample(0).Time)
+		{
+			return nullptr;
+		}
+
+		Newest = (Newest + 1) % Capacity;
+		Num = FMath::Min(Num + 1, Capacity);
+
+		FSample& Sample = Samples[Newest];
+		Sample.Time = Time;
+		Sample.ValidNodes = 0;
+		return &Sample;
+	}
+
+	bool FPoseHistory::GetTrackingPose(ovrpNode Node, double DisplayTime, FPose& OutPose) const
+	{
+		if (Node < 0 || Node >= ovrpNode_Count || Num == 0)
+		{
+			return false;
+		}
+
+		const uint64 NodeMask = 1ull << Node;
+
+		for (int32 Age = 0; Age < Num; Age++)
+		{
+			const FSample& Earlier = GetSample(Age);
+			if (Earlier.Time > DisplayTime)
+			{
+				continue;
+			}
+
+			if (!(Earlier.ValidNodes & NodeMask))
+			{
+				return false;
+			}
+
+			if (Earlier.Time == DisplayTime)
+			{
+				OutPose = Earlier.Poses[Node];
+				return true;
+			}
+
+			// Newer than the last record, poses are not extrapolated
+			if (Age == 0)
+			{
+				return false;
+			}
+
+			const FSample& Later = GetSample(Age - 1);
+			if (!(Later.ValidNodes & NodeMask))
+			{
+				return false;
+			}
+
+			const float Alpha = static_cast<float>((DisplayTime - Earlier.Time) / (Later.Time - Earlier.Time));
+			OutPose.Orientation = FQuat::Slerp(Earlier.Poses[Node].Orientation, Later.Poses[Node].Orientation, Alpha);
+			OutPose.Position = FMath::Lerp(Earlier.Poses[Node].Position, Later.Poses[Node].Position, Alpha);
+			return true;
+		}
+
+		// Older than the first record
+		return false;
+	}
+
+	bool FPoseHistory::GetTimeRange(double& OutOldest, double& OutNewest) const
+	{
+		if (Num == 0)
+		{
+			return false;
+		}
+
+		OutOldest = GetSample(Num - 1).Time;
+		OutNewest = GetSample(0).Time;
+		return true;
+	}
+
+	void FPoseHistory::Reset()
+	{
+		Newest = Capacity - 1;
+		Num = 0;
+	}
+
+} // namespace OculusXRHMD
+
+#endif // OCULUS_HMD_SUPPORTED_PLATFORMS
@@ -0,0 +1,104 @@
+// Copyright (c) Meta Platforms, Inc. and affiliates.
+
+#pragma once
+#include "OculusXRHMDPrivate.h"
+
+#if OCULUS_HMD_SUPPORTED_PLATFORMS
+#include "OculusXRHMD_Settings.h"
+
+namespace OculusXRHMD
+{
+
+	//-------------------------------------------------------------------------------------------------
+	// FPoseSnapshot
+	//-------------------------------------------------------------------------------------------------
+
+	/**
+	 * Poses of every tracked node for one frame. The first query of a frame reads all nodes from the runtime,
+	 * the following ones are served from the snapshot. Each thread owns its own snapshot.
+	 */
+	class FPoseSnapshot
+	{
+	public:
+		FPoseSnapshot();
+
+		/** Tracking space pose of the node for the frame, in meters without base orientation and offset */
+		bool GetTrackingPose(ovrpNode Node, uint32 FrameNumber, FPose& OutPose);
+
+		/** Pose of the node for the frame, converted with the base orientation and offset of Settings */
+		bool GetPose(ovrpNode Node, uint32 FrameNumber, const FSettings* Settings, float WorldToMetersScale, FPose& OutPose);
+
+		/** Predicted display time of the frame the snapshot was read for, 0 if the head was not tracked */
+		double GetDisplayTime() const { return DisplayTime; }
+
+		/** Reads the runtime again on the next query, when its poses for the current frame were updated */
+		void Invalidate() { bFilled = false; }
+
+	private:
+		void Fill(uint32 InFrameNumber);
+
+		static_assert(ovrpNode_Count <= 64, "Node masks are 64 bit");
+
+		bool bFilled;
+		uint32 FrameNumber;
+		double DisplayTime;
+		uint64 ValidNodes;
+		FPose TrackingPoses[ovrpNode_Count];
+
+		// Poses converted with the inputs below, the conversion is redone if any of them changes
+		uint64 ConvertedNodes;
+		FQuat BaseOrientation;
+		FVector BaseOffset;
+		float WorldToMetersScale;
+		FPose Poses[ovrpNode_Count];
+	};
+
+	//-------------------------------------------------------------------------------------------------
+	// FPoseHistory
+	//-------------------------------------------------------------------------------------------------
+
+	/**
+	 * Fixed size ring of the tracking space poses of every node, recorded once per game frame and stamped with
+	 * the predicted display time of the frame. Poses between two records are interpolated.
+	 */
+	class FPoseHistory
+	{
+	public:
+		static constexpr int32 Capacity = 128;
+
+		FPoseHistory();
+
+		void Record(FPoseSnapshot& Snapshot, uint32 FrameNumber);
+
+		/** Records the tracking space poses of the nodes set in ValidNodes, ignored unless Time is newer than the last record */
+		void Record(double Time, uint64 ValidNodes, const FPose (&Poses)[ovrpNode_Count]);
+
+		/** Tracking space pose of the node at DisplayTime, false if it is outside of the recorded range or the node was not tracked */
+		bool GetTrackingPose(ovrpNode Node, double DisplayTime, FPose& OutPose) const;
+
+		/** Oldest and newest recorded display times, false if nothing was recorded */
+		bool GetTimeRange(double& OutOldest, double& OutNewest) const;
+
+		void Reset();
+
+	private:
+		struct FSample
+		{
+			double Time;
+			uint64 ValidNodes;
+			FPose Poses[ovrpNode_Count];
+		};
+
+		const FSample& GetSample(int32 Age) const { return Samples[(Newest - Age + Capacity) % Capacity]; }
+
+		/** Sample to record the frame displayed at Time into, nullptr if Time is not newer than the last record */
+		FSample* AddSample(double Time);
+
+		TArray<FSample> Samples;
+		int32 Newest;
+		int32 Num;
+	};
+
+} // namespace OculusXRHMD
+
+#endif // OCULUS_HMD_SUPPORTED_PLATFORMS
@@ -67,10 +67,10 @@ namespace OculusXRHMD
 				check(Layer.IsValid());
 				check(!DeltaRotation.Equals(FQuat::Identity)); // Only layers with non-zero delta rotation should be in the DeltaRotation array.
 
-				IStereoLayers::FLayerDesc LayerDesc = Layer->GetDesc();
-				LayerDesc.Transform.SetRotation(LayerDesc.Transform.GetRotation() * DeltaRotation);
-				LayerDesc.Transform.NormalizeRotation();
-				Layer->SetDesc(LayerDesc);
+				FLayerPose LayerPose = Layer->GetPose();
+				LayerPose.Transform.SetRotation(LayerPose.Transform.GetRotation() * DeltaRotation);
+				LayerPose.Transform.NormalizeRotation();
+				Layer->SetPose(LayerPose);
 			}
 			LastTimeInSeconds = TimeInSeconds;
 		}
@@ -0,0 +1,46 @@
+// Copyright (c) Meta Platforms, Inc. and affiliates.
+
+#include "OculusXRPassthroughMesh.h"
+
+namespace OculusXRHMD
+{
+
+	TMap<TPair<FObjectKey, int32>, FOculusPassthroughMeshRef> FOculusPassthroughMeshCache::Meshes;
+
+	FOculusPassthroughMeshRef FOculusPassthroughMeshCache::FindOrCreate(const UObject* SourceMesh, int32 LODIndex, TFunctionRef<FOculusPassthroughMeshRef()> CreateMesh)
+	{
+		check(IsInGameThread());
+
+		if (!SourceMesh)
+		{
+			return CreateMesh();
+		}
+
+		const TPair<FObjectKey, int32> Key(FObjectKey(SourceMesh), LODIndex);
+		if (const FOculusPassthroughMeshRef* Found = Meshes.Find(Key))
+		{
+			return *Found;
+		}
+
+		CollectUnused();
+
+		FOculusPassthroughMeshRef PassthroughMesh = CreateMesh();
+		if (PassthroughMesh)
+		{
+			Meshes.Add(Key, PassthroughMesh);
+		}
+		return PassthroughMesh;
+	}
+
+	void FOculusPassthroughMeshCache::CollectUnused()
+	{
+		for (auto It = Meshes.CreateIterator(); It; ++It)
+		{
+			if (It.Value()->GetRefCount() == 1 || !It.Key().Key.ResolveObjectPtr())
+			{
+				It.RemoveCurrent();
+			}
+		}
+	}
+
+} // namespace OculusXRHMD
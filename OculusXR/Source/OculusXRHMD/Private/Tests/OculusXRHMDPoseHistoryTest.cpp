@@ -0,0 +1,105 @@
+// Copyright (c) Meta Platforms, Inc. and affiliates.
+
+#include "Misc/AutomationTest.h"
+#include "OculusXRHMD_PoseCache.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+#if OCULUS_HMD_SUPPORTED_PLATFORMS
+
+namespace OculusXRHMDPoseHistoryTest
+{
+	using namespace OculusXRHMD;
+
+	static const uint64 HeadMask = 1ull << ovrpNode_Head;
+	static const uint64 HandLeftMask = 1ull << ovrpNode_HandLeft;
+
+	static void RecordHead(FPoseHistory& History, double Time, const FQuat& Orientation, const FVector& Position, uint64 ValidNodes = HeadMask)
+	{
+		FPose Poses[ovrpNode_Count];
+		Poses[ovrpNode_Head] = FPose(Orientation, Position);
+		Poses[ovrpNode_HandLeft] = FPose(Orientation, Position);
+		History.Record(Time, ValidNodes, Poses);
+	}
+} // namespace OculusXRHMDPoseHistoryTest
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FOculusXRHMDPoseHistoryInterpolationTest,
+	"OculusXR.HMD.PoseHistory.Interpolation",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FOculusXRHMDPoseHistoryInterpolationTest::RunTest(const FString& Parameters)
+{
+	using namespace OculusXRHMDPoseHistoryTest;
+
+	FPoseHistory History;
+	FPose Pose;
+	double Oldest = 0.0, Newest = 0.0;
+	TestFalse(TEXT("Empty history has no time range"), History.GetTimeRange(Oldest, Newest));
+	TestFalse(TEXT("Empty history has no pose"), History.GetTrackingPose(ovrpNode_Head, 1.0, Pose));
+
+	const FQuat QuarterTurn(FVector::UpVector, UE_HALF_PI);
+	RecordHead(History, 1.0, FQuat::Identity, FVector::ZeroVector, HeadMask | HandLeftMask);
+	RecordHead(History, 2.0, QuarterTurn, FVector(10, 0, 0));
+
+	// Records that are not newer than the last one are dropped
+	RecordHead(History, 1.5, FQuat::Identity, FVector(100, 0, 0));
+	TestTrue(TEXT("Time range"), History.GetTimeRange(Oldest, Newest));
+	TestEqual(TEXT("Oldest time"), Oldest, 1.0);
+	TestEqual(TEXT("Newest time"), Newest, 2.0);
+
+	// Between two records the position is lerped and the orientation slerped
+	TestTrue(TEXT("Pose between records"), History.GetTrackingPose(ovrpNode_Head, 1.5, Pose));
+	TestEqual(TEXT("Interpolated position"), Pose.Position, FVector(5, 0, 0));
+	TestTrue(TEXT("Interpolated orientation"), Pose.Orientation.Equals(FQuat(FVector::UpVector, UE_HALF_PI / 2.0), UE_KINDA_SMALL_NUMBER));
+
+	TestTrue(TEXT("Pose at a record"), History.GetTrackingPose(ovrpNode_Head, 2.0, Pose));
+	TestEqual(TEXT("Recorded position"), Pose.Position, FVector(10, 0, 0));
+	TestTrue(TEXT("Recorded orientation"), Pose.Orientation.Equals(QuarterTurn, UE_KINDA_SMALL_NUMBER));
+
+	// Nothing is extrapolated past either end
+	TestFalse(TEXT("No pose before the oldest record"), History.GetTrackingPose(ovrpNode_Head, 0.5, Pose));
+	TestFalse(TEXT("No pose after the newest record"), History.GetTrackingPose(ovrpNode_Head, 2.5, Pose));
+
+	// A node has to be tracked in both records it is interpolated between
+	TestTrue(TEXT("Untracked later: pose at the tracked record"), History.GetTrackingPose(ovrpNode_HandLeft, 1.0, Pose));
+	TestFalse(TEXT("Untracked later: no interpolated pose"), History.GetTrackingPose(ovrpNode_HandLeft, 1.5, Pose));
+	TestFalse(TEXT("Out of range node"), History.GetTrackingPose(ovrpNode_Count, 1.5, Pose));
+
+	History.Reset();
+	TestFalse(TEXT("Reset history has no time range"), History.GetTimeRange(Oldest, Newest));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FOculusXRHMDPoseHistoryWrapTest,
+	"OculusXR.HMD.PoseHistory.Wrap",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FOculusXRHMDPoseHistoryWrapTest::RunTest(const FString& Parameters)
+{
+	using namespace OculusXRHMDPoseHistoryTest;
+
+	// More frames than the ring holds, the oldest ones are overwritten
+	FPoseHistory History;
+	const int32 NumRecords = FPoseHistory::Capacity + 10;
+	for (int32 Frame = 0; Frame < NumRecords; Frame++)
+	{
+		RecordHead(History, Frame, FQuat::Identity, FVector(Frame, 0, 0));
+	}
+
+	double Oldest = 0.0, Newest = 0.0;
+	TestTrue(TEXT("Time range"), History.GetTimeRange(Oldest, Newest));
+	TestEqual(TEXT("Oldest kept frame"), Oldest, double(NumRecords - FPoseHistory::Capacity));
+	TestEqual(TEXT("Newest frame"), Newest, double(NumRecords - 1));
+
+	FPose Pose;
+	TestFalse(TEXT("Overwritten frames are gone"), History.GetTrackingPose(ovrpNode_Head, 5.0, Pose));
+	TestTrue(TEXT("Pose across the wrap"), History.GetTrackingPose(ovrpNode_Head, FPoseHistory::Capacity + 0.5, Pose));
+	TestEqual(TEXT("Position across the wrap"), Pose.Position, FVector(FPoseHistory::Capacity + 0.5, 0, 0));
+
+	return true;
+}
+
+#endif // OCULUS_HMD_SUPPORTED_PLATFORMS
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -20,6 +20,8 @@ namespace OculusXRHMD
 		virtual void GetBaseRotationAndBaseOffsetInMeters(FRotator& OutRotation, FVector& OutBaseOffsetInMeters) = 0;
 		virtual void GetRawSensorData(FVector& AngularAcceleration, FVector& LinearAcceleration, FVector& AngularVelocity, FVector& LinearVelocity, float& TimeInSeconds, EOculusXRTrackedDeviceType DeviceType) = 0;
 		virtual bool IsDeviceTracked(EOculusXRTrackedDeviceType DeviceType) = 0;
+		virtual bool GetPoseHistoryTimeRange(double& OutOldest, double& OutNewest) = 0;
+		virtual bool GetPoseAtTime(EOculusXRTrackedDeviceType DeviceType, double DisplayTime, FRotator& OutRotation, FVector& OutPosition) = 0;
 		virtual void GetSuggestedCpuAndGpuPerformanceLevels(EOculusXRProcessorPerformanceLevel& CpuPerfLevel, EOculusXRProcessorPerformanceLevel& GpuPerfLevel) = 0;
 		virtual void SetSuggestedCpuAndGpuPerformanceLevels(EOculusXRProcessorPerformanceLevel CpuPerfLevel, EOculusXRProcessorPerformanceLevel GpuPerfLevel) = 0;
 		virtual bool GetUserProfile(FOculusXRHmdUserProfile& Profile) = 0;
@@ -115,6 +117,29 @@ class OCULUSXRHMD_API UOculusXRFunctionLibrary : public UBlueprintFunctionLibrar
 	UFUNCTION(BlueprintPure, Category = "OculusLibrary")
 	static bool IsDeviceTracked(EOculusXRTrackedDeviceType DeviceType);
 
+	/**
+	 * Returns the predicted display times of the oldest and newest recorded poses. Poses of the last 128 frames are recorded.
+	 * Only supported with the OVRPlugin backend, returns false otherwise or when nothing was recorded yet.
+	 *
+	 * @param OutOldest		(out) Display time of the oldest recorded frame, in seconds
+	 * @param OutNewest		(out) Display time of the newest recorded frame, in seconds
+	 */
+	UFUNCTION(BlueprintPure, Category = "OculusLibrary")
+	static bool GetPoseHistoryTimeRange(double& OutOldest, double& OutNewest);
+
+	/**
+	 * Returns the recorded pose of the device at a past display time, interpolated between the recorded frames.
+	 * Returns false if the time is outside of GetPoseHistoryTimeRange, the device was not tracked then, or the
+	 * backend is not OVRPlugin.
+	 *
+	 * @param DeviceType	(in) The device to get the pose of
+	 * @param DisplayTime	(in) Predicted display time, in seconds
+	 * @param OutRotation	(out) The device's rotation at that time
+	 * @param OutPosition	(out) The device's position at that time, in its own tracking space
+	 */
+	UFUNCTION(BlueprintPure, Category = "OculusLibrary")
+	static bool GetPoseAtTime(EOculusXRTrackedDeviceType DeviceType, double DisplayTime, FRotator& OutRotation, FVector& OutPosition);
+
 	/**
 	 * Set the CPU and GPU levels as hints to the Oculus device (Deprecated).
 	 */
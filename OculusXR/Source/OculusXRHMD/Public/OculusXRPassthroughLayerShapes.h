@@ -138,12 +138,18 @@ struct FUserDefinedGeometryDesc
 		: MeshName(MeshName)
 		, PassthroughMesh(PassthroughMesh)
 		, Transform(Transform)
-		, bUpdateTransform(bUpdateTransform){};
+		, bUpdateTransform(bUpdateTransform)
+		, GeometryId(0)
+		, TransformVersion(0){};
 
 	FString MeshName;
 	OculusXRHMD::FOculusPassthroughMeshRef PassthroughMesh;
 	FTransform Transform;
 	bool bUpdateTransform;
+	/** Stable id assigned when the geometry is added to a layer. Layers key their instances by it instead of MeshName. */
+	uint32 GeometryId;
+	/** Incremented every time Transform changes, layers only push instances whose version they have not applied yet. */
+	uint32 TransformVersion;
 };
 
 class OCULUSXRHMD_API_CLASS FUserDefinedLayer : public IStereoLayerShape
@@ -155,10 +161,11 @@ public:
 
 public:
 	FUserDefinedLayer(){};
-	FUserDefinedLayer(TArray<FUserDefinedGeometryDesc> InUserGeometryList, const FEdgeStyleParameters& EdgeStyleParameters, EOculusXRPassthroughLayerOrder PassthroughLayerOrder)
+	FUserDefinedLayer(TArray<FUserDefinedGeometryDesc> InUserGeometryList, const FEdgeStyleParameters& EdgeStyleParameters, EOculusXRPassthroughLayerOrder PassthroughLayerOrder, uint32 GeometryListGeneration = 0)
 		: UserGeometryList{}
 		, EdgeStyleParameters(EdgeStyleParameters)
 		, PassthroughLayerOrder(PassthroughLayerOrder)
+		, GeometryListGeneration(GeometryListGeneration)
 	{
 		UserGeometryList = InUserGeometryList;
 	}
@@ -166,6 +173,8 @@ public:
 	TArray<FUserDefinedGeometryDesc> UserGeometryList;
 	FEdgeStyleParameters EdgeStyleParameters;
 	EOculusXRPassthroughLayerOrder PassthroughLayerOrder;
+	/** Changes whenever geometries are added or removed. 0 means unknown, which makes layers diff the whole list. */
+	uint32 GeometryListGeneration = 0;
 
 private:
 };
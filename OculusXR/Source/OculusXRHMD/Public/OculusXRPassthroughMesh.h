@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "Templates/RefCounting.h"
+#include "UObject/ObjectKey.h"
 
 namespace OculusXRHMD
 {
@@ -15,16 +16,40 @@ namespace OculusXRHMD
 			: Vertices(InVertices)
 			, Triangles(InTriangles)
 		{
+			// Runtimes take float positions, convert once here instead of on every instance creation
+			VerticesFloat.SetNumUninitialized(Vertices.Num());
+			for (int32 i = 0; i < Vertices.Num(); ++i)
+			{
+				VerticesFloat[i] = FVector3f(Vertices[i]);
+			}
 		}
 
 		const TArray<FVector>& GetVertices() const { return Vertices; };
+		const TArray<FVector3f>& GetVerticesFloat() const { return VerticesFloat; };
 		const TArray<int32>& GetTriangles() const { return Triangles; };
 
 	private:
 		TArray<FVector> Vertices;
+		TArray<FVector3f> VerticesFloat;
 		TArray<int32> Triangles;
 	};
 
 	typedef TRefCountPtr<FOculusPassthroughMesh> FOculusPassthroughMeshRef;
 
+	/**
+	 * Shares passthrough meshes built from the same source mesh and LOD, so repeated passthrough shapes reference a
+	 * single FOculusPassthroughMesh and the layers can back all their instances with one runtime mesh.
+	 * Entries are dropped once nothing but the cache references them. Game thread only.
+	 */
+	class OCULUSXRHMD_API FOculusPassthroughMeshCache
+	{
+	public:
+		static FOculusPassthroughMeshRef FindOrCreate(const UObject* SourceMesh, int32 LODIndex, TFunctionRef<FOculusPassthroughMeshRef()> CreateMesh);
+
+	private:
+		static void CollectUnused();
+
+		static TMap<TPair<FObjectKey, int32>, FOculusPassthroughMeshRef> Meshes;
+	};
+
 } // namespace OculusXRHMD
@@ -0,0 +1,90 @@
+// Copyright (c) Meta Platforms, Inc. and affiliates.
+
+#include "OculusXRMR_AudioCapture.h"
+
+FOculusXRMR_AudioCapture::FOculusXRMR_AudioCapture(int32 InSampleRate, float BufferDurationSec)
+	: SampleRate(FMath::Max(InSampleRate, 1))
+	, RingBuffer(FMath::CeilToInt(SampleRate * BufferDurationSec) * NumChannels)
+{
+}
+
+void FOculusXRMR_AudioCapture::OnNewSubmixBuffer(const USoundSubmix* OwningSubmix, float* AudioData, int32 NumSamples, int32 InNumChannels, const int32 InSampleRate, double AudioClock)
+{
+	if (InNumChannels <= 0 || NumSamples <= 0)
+	{
+		return;
+	}
+
+	const int32 NumFrames = NumSamples / InNumChannels;
+	const uint64 Written = WrittenFrames.load(std::memory_order_relaxed);
+	if (Written == 0 && DroppedFrames.load(std::memory_order_relaxed) == 0)
+	{
+		StartClock = AudioClock;
+	}
+
+	// Drop whole buffers when full so a slice never contains a partial buffer
+	if (RingBuffer.Remainder() < static_cast<uint32>(NumFrames * NumChannels))
+	{
+		DroppedFrames.fetch_add(NumFrames, std::memory_order_relaxed);
+		return;
+	}
+
+	if (InNumChannels == NumChannels)
+	{
+		RingBuffer.Push(AudioData, NumSamples);
+	}
+	else
+	{
+		// Only reallocates when the submix buffer size grows, which does not happen in steady state
+		DownmixBuffer.SetNumUninitialized(NumFrames * NumChannels, EAllowShrinking::No);
+		float* Out = DownmixBuffer.GetData();
+		if (InNumChannels == 1)
+		{
+			for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+			{
+				Out[Frame * 2] = AudioData[Frame];
+				Out[Frame * 2 + 1] = AudioData[Frame];
+			}
+		}
+		else
+		{
+			// Keep the front pair of multichannel layouts
+			for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+			{
+				Out[Frame * 2] = AudioData[Frame * InNumChannels];
+				Out[Frame * 2 + 1] = AudioData[Frame * InNumChannels + 1];
+			}
+		}
+		RingBuffer.Push(Out, NumFrames * NumChannels);
+	}
+
+	WrittenFrames.store(Written + NumFrames, std::memory_order_release);
+}
+
+const FString& FOculusXRMR_AudioCapture::GetListenerName() const
+{
+	static const FString ListenerName(TEXT("OculusXRMR_AudioCapture"));
+	return ListenerName;
+}
+
+bool FOculusXRMR_AudioCapture::PopSlice(Audio::FAlignedFloatBuffer& OutSlice, double& OutEndTime)
+{
+	const uint64 Written = WrittenFrames.load(std::memory_order_acquire);
+	if (Written == 0)
+	{
+		OutSlice.Reset();
+		return false;
+	}
+
+	const int32 NumSamples = static_cast<int32>(Written - ReadFrames) * NumChannels;
+	OutSlice.SetNumUninitialized(NumSamples, EAllowShrinking::No);
+	if (NumSamples > 0)
+	{
+		RingBuffer.Pop(OutSlice.GetData(), NumSamples);
+	}
+	ReadFrames = Written;
+
+	// Dropped frames are a gap in the stream, so they still advance the clock
+	OutEndTime = StartClock + static_cast<double>(Written + GetNumDroppedFrames()) / SampleRate;
+	return true;
+}
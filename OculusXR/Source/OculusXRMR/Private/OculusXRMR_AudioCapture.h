@@ -0,0 +1,50 @@
+// Copyright (c) Meta Platforms, Inc. and affiliates.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ISubmixBufferListener.h"
+#include "DSP/Dsp.h"
+#include "DSP/AlignedBuffer.h"
+#include <atomic>
+
+/**
+ * Listens to the main submix for the lifetime of the capture and keeps the rendered audio, downmixed to stereo,
+ * in a single producer single consumer ring buffer. The capture camera cuts one slice per captured frame from it,
+ * so the recorder is never restarted and consecutive slices are contiguous.
+ */
+class FOculusXRMR_AudioCapture : public ISubmixBufferListener
+{
+public:
+	static constexpr int32 NumChannels = 2;
+
+	FOculusXRMR_AudioCapture(int32 InSampleRate, float BufferDurationSec);
+
+	// ISubmixBufferListener, audio render thread
+	virtual void OnNewSubmixBuffer(const USoundSubmix* OwningSubmix, float* AudioData, int32 NumSamples, int32 InNumChannels, const int32 InSampleRate, double AudioClock) override;
+	virtual const FString& GetListenerName() const override;
+
+	/**
+	 * Game thread. Moves the audio rendered since the previous slice into OutSlice, reusing its allocation,
+	 * and returns the audio clock at the end of the slice in OutEndTime. Returns false until audio was rendered.
+	 */
+	bool PopSlice(Audio::FAlignedFloatBuffer& OutSlice, double& OutEndTime);
+
+	// Frames dropped because the slices were not cut fast enough to keep up with rendering
+	uint64 GetNumDroppedFrames() const { return DroppedFrames.load(std::memory_order_relaxed); }
+
+private:
+	const int32 SampleRate;
+	Audio::TCircularAudioBuffer<float> RingBuffer;
+
+	// Audio render thread only
+	Audio::FAlignedFloatBuffer DownmixBuffer;
+
+	// Clock of the first rendered frame, published by the first release store of WrittenFrames
+	double StartClock = 0.0;
+	std::atomic<uint64> WrittenFrames{ 0 };
+	std::atomic<uint64> DroppedFrames{ 0 };
+
+	// Game thread only
+	uint64 ReadFrames = 0;
+};
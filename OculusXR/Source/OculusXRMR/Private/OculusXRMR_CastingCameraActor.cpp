@@ -11,6 +11,7 @@
 #include "OculusXRMR_Settings.h"
 #include "OculusXRMR_State.h"
 #include "OculusXRMR_PlaneMeshComponent.h"
+#include "OculusXRMR_AudioCapture.h"
 #include "OculusXRMRFunctionLibrary.h"
 #include "Components/StaticMeshComponent.h"
 #include "Components/SceneCaptureComponent2D.h"
@@ -228,7 +229,15 @@ void AOculusXRMR_CastingCameraActor::BeginPlay()
 	FAudioDeviceHandle AudioDevice = FAudioDevice::GetMainAudioDevice();
 	if (AudioDevice.GetAudioDevice())
 	{
-		AudioDevice->StartRecording(nullptr, 0.1);
+		const int32 SampleRate = AudioDevice->GetSampleRate();
+		for (Audio::AlignedFloatBuffer& AudioBuffer : AudioBuffers)
+		{
+			AudioBuffer.Reserve(SampleRate / 10 * FOculusXRMR_AudioCapture::NumChannels);
+		}
+
+		// Stays registered until EndPlay, each capture cuts its slice from the ring buffer instead of restarting a recording
+		AudioCapture = MakeShared<FOculusXRMR_AudioCapture, ESPMode::ThreadSafe>(SampleRate, 1.0f);
+		AudioDevice->RegisterSubmixBufferListener(AudioCapture.ToSharedRef(), AudioDevice->GetMainSubmixObject());
 	}
 #endif
 }
@@ -237,12 +246,15 @@ void AOculusXRMR_CastingCameraActor::EndPlay(EEndPlayReason::Type Reason)
 {
 #if PLATFORM_ANDROID
 	FAudioDeviceHandle AudioDevice = FAudioDevice::GetMainAudioDevice();
-	if (AudioDevice.GetAudioDevice())
+	if (AudioDevice.GetAudioDevice() && AudioCapture.IsValid())
 	{
-		float NumChannels = 2;
-		float SampleRate = AudioDevice->GetSampleRate();
-		AudioDevice->StopRecording(nullptr, NumChannels, SampleRate);
+		AudioDevice->UnregisterSubmixBufferListener(AudioCapture.ToSharedRef(), AudioDevice->GetMainSubmixObject());
+		if (AudioCapture->GetNumDroppedFrames() > 0)
+		{
+			UE_LOG(LogMR, Warning, TEXT("MRC audio capture dropped %llu frames"), AudioCapture->GetNumDroppedFrames());
+		}
 	}
+	AudioCapture.Reset();
 #endif
 
 	VRNotificationComponent->HMDRecenteredDelegate.Remove(this, FName(TEXT("OnHMDRecentered")));
@@ -355,7 +367,7 @@ void AOculusXRMR_CastingCameraActor::Tick(float DeltaTime)
 		{
 			FOculusXRHMDModule::GetPluginWrapper().Media_SyncMrcFrame(SyncId);
 
-			int NumChannels = 2;
+			int NumChannels = FOculusXRMR_AudioCapture::NumChannels;
 			double AudioTime = AudioTimes[EncodeIndex];
 			void* BackgroundTexture;
 			void* ForegroundTexture;
@@ -394,16 +406,9 @@ void AOculusXRMR_CastingCameraActor::Tick(float DeltaTime)
 		ForegroundCaptureActor->GetCaptureComponent2D()->TextureTarget = ForegroundRenderTargets[CaptureIndex];
 		GetCaptureComponent2D()->SetVisibility(true);
 
-		FAudioDeviceHandle AudioDevice = FAudioDevice::GetMainAudioDevice();
-		if (AudioDevice.GetAudioDevice())
+		if (AudioCapture.IsValid())
 		{
-			float NumChannels, SampleRate;
-			NumChannels = 2;
-			SampleRate = AudioDevice->GetSampleRate();
-			AudioBuffers[CaptureIndex] = AudioDevice->StopRecording(nullptr, NumChannels, SampleRate);
-			AudioTimes[CaptureIndex] = AudioDevice->GetAudioTime();
-			// UE_LOG(LogMR, Error, TEXT("SampleRate: %f, NumChannels: %f, Time: %f, Buffer Length: %d, Buffer: %p"), SampleRate, NumChannels, AudioDevice->GetAudioTime(), AudioBuffers[EncodeIndex].Num(), AudioBuffers[EncodeIndex].GetData());
-			AudioDevice->StartRecording(nullptr, 0.1);
+			AudioCapture->PopSlice(AudioBuffers[CaptureIndex], AudioTimes[CaptureIndex]);
 		}
 
 		// PoseTimes[CaptureIndex] = MRState->TrackedCamera.UpdateTime;
@@ -21,6 +21,7 @@ class AOculusXRMR_BoundaryActor;
 class UTextureRenderTarget2D;
 class UOculusXRMR_Settings;
 class UOculusXRMR_State;
+class FOculusXRMR_AudioCapture;
 
 /**
  * The camera actor in the level that tracks the binded physical camera in game
@@ -119,6 +120,7 @@ private:
 	UOculusXRMR_State* MRState;
 
 #if PLATFORM_ANDROID
+	TSharedPtr<FOculusXRMR_AudioCapture, ESPMode::ThreadSafe> AudioCapture;
 	TArray<Audio::AlignedFloatBuffer> AudioBuffers;
 	TArray<double> AudioTimes;
 
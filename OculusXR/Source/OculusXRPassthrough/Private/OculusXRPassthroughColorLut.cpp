@@ -28,24 +28,34 @@ namespace
 		}
 	}
 
-	TArray<uint8> ColorArrayToColorData(const TArray<FColor>& InColorArray, bool IgnoreAlphaChannel)
+	// FColor is stored as BGRA while the LUT expects RGB(A). Both loops are branch free so the compiler can vectorize them.
+	void ConvertColors(const FColor* Colors, int32 Num, bool IgnoreAlphaChannel, uint8* Dest)
 	{
-		TArray<uint8> Data;
-		const size_t ElementSize = IgnoreAlphaChannel ? 3 : 4;
-		Data.SetNum(InColorArray.Num() * ElementSize);
-		uint8* Dest = Data.GetData();
-		for (size_t i = 0; i < InColorArray.Num(); i++)
+		if (IgnoreAlphaChannel)
 		{
-			Data[i * ElementSize + 0] = InColorArray[i].R;
-			Data[i * ElementSize + 1] = InColorArray[i].G;
-			Data[i * ElementSize + 2] = InColorArray[i].B;
-
-			if (!IgnoreAlphaChannel)
+			for (int32 i = 0; i < Num; i++)
+			{
+				Dest[i * 3 + 0] = Colors[i].R;
+				Dest[i * 3 + 1] = Colors[i].G;
+				Dest[i * 3 + 2] = Colors[i].B;
+			}
+		}
+		else
+		{
+			static_assert(PLATFORM_LITTLE_ENDIAN, "Packed ABGR is only laid out as RGBA bytes on little endian platforms.");
+			uint32* Dest32 = reinterpret_cast<uint32*>(Dest);
+			for (int32 i = 0; i < Num; i++)
 			{
-				Data[i * ElementSize + 3] = InColorArray[i].A;
+				Dest32[i] = Colors[i].ToPackedABGR();
 			}
 		}
+	}
 
+	TArray<uint8> ColorArrayToColorData(const TArray<FColor>& InColorArray, bool IgnoreAlphaChannel)
+	{
+		TArray<uint8> Data;
+		Data.SetNumUninitialized(InColorArray.Num() * (IgnoreAlphaChannel ? 3 : 4));
+		ConvertColors(InColorArray.GetData(), InColorArray.Num(), IgnoreAlphaChannel, Data.GetData());
 		return Data;
 	}
 
@@ -53,6 +63,20 @@ namespace
 	{
 		return Data.Data.Num() > 0 && Data.Resolution > 0;
 	}
+
+	bool HasAlphaChannel(const FLutTextureData& Data)
+	{
+		return (uint32)Data.Data.Num() == Data.Resolution * Data.Resolution * Data.Resolution * 4;
+	}
+
+#if WITH_EDITOR
+	// Source texture id, resolution and whether alpha is ignored
+	using FLutPayloadKey = TTuple<FGuid, uint32, bool>;
+
+	// Payloads baked during this editor session, shared by every LUT asset using the same texture. Game thread only.
+	TMap<FLutPayloadKey, FLutTextureData> LutPayloadCache;
+	constexpr int32 MaxCachedLutPayloads = 16;
+#endif
 } // namespace
 
 void UOculusXRPassthroughColorLut::SetLutFromArray(const TArray<FColor>& InColorArray, bool InIgnoreAlphaChannel)
@@ -102,6 +126,11 @@ void UOculusXRPassthroughColorLut::SetLutFromArray(const TArray<FColor>& InColor
 
 uint64 UOculusXRPassthroughColorLut::GetHandle(UOculusXRPassthroughLayerBase* LayerRef)
 {
+#if WITH_EDITOR
+	// Only block on a pending bake when there is no LUT object to keep showing meanwhile
+	FinishTextureBake(LutHandle == 0 && ColorLutType == EColorLutType::TextureLUT);
+#endif
+
 	if (LutHandle == 0 && ColorLutType == EColorLutType::TextureLUT && IsTextureDataValid(StoredTextureData))
 	{
 		LutHandle = CreateLutObject(StoredTextureData.Data, StoredTextureData.Resolution);
@@ -117,10 +146,94 @@ void UOculusXRPassthroughColorLut::PreSave(FObjectPreSaveContext ObjectSaveConte
 {
 	Super::PreSave(ObjectSaveContext);
 #if WITH_EDITOR
-	StoredTextureData = TextureToColorData(LutTexture);
+	BakeTextureData();
+	FinishTextureBake(true);
+#endif
+}
+
+void UOculusXRPassthroughColorLut::PostLoad()
+{
+	Super::PostLoad();
+#if WITH_EDITOR
+	// Bake in the background so the first layer using this LUT does not have to convert the texture
+	BakeTextureData();
 #endif
 }
 
+#if WITH_EDITOR
+void UOculusXRPassthroughColorLut::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	const FName PropertyName = PropertyChangedEvent.GetMemberPropertyName();
+	if (PropertyName == GET_MEMBER_NAME_CHECKED(UOculusXRPassthroughColorLut, LutTexture)
+		|| PropertyName == GET_MEMBER_NAME_CHECKED(UOculusXRPassthroughColorLut, IgnoreAlphaChannel)
+		|| PropertyName == GET_MEMBER_NAME_CHECKED(UOculusXRPassthroughColorLut, ColorLutType))
+	{
+		// Drop a bake of the previous settings, its result is stale
+		TextureBakeTask = UE::Tasks::TTask<FLutTextureData>();
+		BakeTextureData();
+	}
+}
+
+void UOculusXRPassthroughColorLut::BakeTextureData()
+{
+	if (TextureBakeTask.IsValid())
+	{
+		return;
+	}
+
+	const bool bUpToDate = ColorLutType == EColorLutType::TextureLUT
+		&& LutTexture != nullptr
+		&& IsTextureDataValid(StoredTextureData)
+		&& StoredTextureData.SourceId.IsValid()
+		&& StoredTextureData.SourceId == LutTexture->Source.GetId()
+		&& HasAlphaChannel(StoredTextureData) == !IgnoreAlphaChannel;
+	if (bUpToDate)
+	{
+		return;
+	}
+
+	TextureBakeTask = TextureToColorData(LutTexture);
+}
+
+void UOculusXRPassthroughColorLut::FinishTextureBake(bool bWait)
+{
+	if (!TextureBakeTask.IsValid() || (!bWait && !TextureBakeTask.IsCompleted()))
+	{
+		return;
+	}
+
+	FLutTextureData BakedData = TextureBakeTask.GetResult();
+	TextureBakeTask = UE::Tasks::TTask<FLutTextureData>();
+
+	if (IsTextureDataValid(BakedData) && BakedData.SourceId.IsValid())
+	{
+		if (LutPayloadCache.Num() >= MaxCachedLutPayloads)
+		{
+			LutPayloadCache.Reset();
+		}
+		LutPayloadCache.Add(FLutPayloadKey(BakedData.SourceId, BakedData.Resolution, !HasAlphaChannel(BakedData)), BakedData);
+	}
+
+	// Refresh a live LUT object in place when the data layout did not change, otherwise recreate it with the new layout
+	if (LutHandle != 0 && ColorLutType == EColorLutType::TextureLUT && IsTextureDataValid(BakedData))
+	{
+		if (BakedData.Data.Num() == StoredTextureData.Data.Num())
+		{
+			UpdateLutObject(LutHandle, BakedData.Data);
+		}
+		else
+		{
+			DestroyLutObject(LutHandle);
+			LutHandle = CreateLutObject(BakedData.Data, BakedData.Resolution);
+		}
+	}
+
+	StoredTextureData = MoveTemp(BakedData);
+}
+#endif
+
 void UOculusXRPassthroughColorLut::RemoveReference(UOculusXRPassthroughLayerBase* LayerRef)
 {
 	LayerRefs.Remove(LayerRef->GetUniqueID());
@@ -132,34 +245,34 @@ void UOculusXRPassthroughColorLut::RemoveReference(UOculusXRPassthroughLayerBase
 	}
 }
 
-FLutTextureData UOculusXRPassthroughColorLut::TextureToColorData(class UTexture2D* InLutTexture) const
+#if WITH_EDITOR
+UE::Tasks::TTask<FLutTextureData> UOculusXRPassthroughColorLut::TextureToColorData(class UTexture2D* InLutTexture) const
 {
-
 	if (ColorLutType != EColorLutType::TextureLUT)
 	{
-		return FLutTextureData();
+		return UE::Tasks::MakeCompletedTask<FLutTextureData>();
 	}
 
 	if (InLutTexture == nullptr)
 	{
 		UE_LOG(LogOculusPassthrough, Warning, TEXT("Ignoring provided LUT texture. Provided texture is NULL."));
-		return FLutTextureData();
+		return UE::Tasks::MakeCompletedTask<FLutTextureData>();
 	}
 
 	if (InLutTexture->LODGroup != TextureGroup::TEXTUREGROUP_ColorLookupTable)
 	{
 		UE_LOG(LogOculusPassthrough, Warning, TEXT("Ignoring provided LUT texture. Provided texture is not LUT texture."));
-		return FLutTextureData();
+		return UE::Tasks::MakeCompletedTask<FLutTextureData>();
 	}
 
-	if (InLutTexture->GetPlatformData()->Mips.Num() <= 0)
+	if (InLutTexture->GetPlatformData() == nullptr || InLutTexture->GetPlatformData()->Mips.Num() <= 0)
 	{
 		if (IsTextureDataValid(StoredTextureData))
 		{
 			// We do not need to save it again. Use previously saved data.
-			return StoredTextureData;
+			return UE::Tasks::MakeCompletedTask<FLutTextureData>(StoredTextureData);
 		}
-		return FLutTextureData();
+		return UE::Tasks::MakeCompletedTask<FLutTextureData>();
 	}
 
 	const uint32 TextureWidth = InLutTexture->GetImportedSize().X;
@@ -175,7 +288,7 @@ FLutTextureData UOculusXRPassthroughColorLut::TextureToColorData(class UTexture2
 		if (FPlatformMath::Abs(EdgeLength - ColorMapSize) > ZERO_ANIMWEIGHT_THRESH)
 		{
 			UE_LOG(LogOculusPassthrough, Warning, TEXT("LUT width and height are equal but don't correspond to an 'exploded cube'"));
-			return FLutTextureData();
+			return UE::Tasks::MakeCompletedTask<FLutTextureData>();
 		}
 
 		SlicesPerRow = FPlatformMath::Sqrt(ColorMapSize * 1.0f);
@@ -185,36 +298,53 @@ FLutTextureData UOculusXRPassthroughColorLut::TextureToColorData(class UTexture2
 		if (TextureWidth != TextureHeight * TextureHeight)
 		{
 			UE_LOG(LogOculusPassthrough, Warning, TEXT("For rectangular LUTs, the width is expected to be equal to edgeLength^2"));
-			return FLutTextureData();
+			return UE::Tasks::MakeCompletedTask<FLutTextureData>();
 		}
 		ColorMapSize = TextureHeight;
 		SlicesPerRow = TextureHeight;
 	}
 
-	FTexture2DMipMap& MipMap = InLutTexture->GetPlatformData()->Mips[0];
-	FByteBulkData* BulkData = &MipMap.BulkData;
-	const FColor* FormatedImageData = reinterpret_cast<const FColor*>(BulkData->Lock(LOCK_READ_ONLY));
-
-	TArray<FColor> Colors;
-	Colors.SetNum(ColorMapSize * ColorMapSize * ColorMapSize);
+	const FGuid SourceId = InLutTexture->Source.GetId();
+	if (const FLutTextureData* CachedData = LutPayloadCache.Find(FLutPayloadKey(SourceId, ColorMapSize, IgnoreAlphaChannel)))
+	{
+		return UE::Tasks::MakeCompletedTask<FLutTextureData>(*CachedData);
+	}
 
-	for (uint32 bi = 0; bi < ColorMapSize; bi++)
+	// Only the copy of the mip happens under the lock, reordering and conversion run on a worker
+	const int32 NumPixels = TextureWidth * TextureHeight;
+	FByteBulkData& BulkData = InLutTexture->GetPlatformData()->Mips[0].BulkData;
+	if (BulkData.GetBulkDataSize() < NumPixels * (int64)sizeof(FColor))
 	{
-		uint32 bi_row = bi % SlicesPerRow;
-		uint32 bi_col = bi / SlicesPerRow;
-		for (uint32 gi = 0; gi < ColorMapSize; gi++)
+		UE_LOG(LogOculusPassthrough, Warning, TEXT("Ignoring provided LUT texture. Texture data is smaller than its imported size."));
+		return UE::Tasks::MakeCompletedTask<FLutTextureData>();
+	}
+
+	TArray<FColor> Pixels;
+	Pixels.SetNumUninitialized(NumPixels);
+	FMemory::Memcpy(Pixels.GetData(), BulkData.Lock(LOCK_READ_ONLY), NumPixels * sizeof(FColor));
+	BulkData.Unlock();
+
+	return UE::Tasks::Launch(UE_SOURCE_LOCATION, [Pixels = MoveTemp(Pixels), TextureWidth, ColorMapSize, SlicesPerRow, bIgnoreAlphaChannel = IgnoreAlphaChannel, SourceId]() {
+		const uint32 ElementSize = bIgnoreAlphaChannel ? 3 : 4;
+		TArray<uint8> Data;
+		Data.SetNumUninitialized(ColorMapSize * ColorMapSize * ColorMapSize * ElementSize);
+
+		for (uint32 bi = 0; bi < ColorMapSize; bi++)
 		{
-			for (uint32 ri = 0; ri < ColorMapSize; ri++)
+			uint32 bi_row = bi % SlicesPerRow;
+			uint32 bi_col = bi / SlicesPerRow;
+			for (uint32 gi = 0; gi < ColorMapSize; gi++)
 			{
-				uint32 sX = ri + bi_row * ColorMapSize;
+				// The red axis of each slice is a contiguous run of texels
+				uint32 sX = bi_row * ColorMapSize;
 				uint32 sY = gi + bi_col * ColorMapSize;
-				Colors[bi * ColorMapSize * ColorMapSize + gi * ColorMapSize + ri] = FormatedImageData[sX + sY * TextureWidth];
+				ConvertColors(&Pixels[sX + sY * TextureWidth], ColorMapSize, bIgnoreAlphaChannel, &Data[(bi * ColorMapSize * ColorMapSize + gi * ColorMapSize) * ElementSize]);
 			}
 		}
-	}
-	BulkData->Unlock();
-	return FLutTextureData(ColorArrayToColorData(Colors, IgnoreAlphaChannel), ColorMapSize);
+		return FLutTextureData(MoveTemp(Data), ColorMapSize, SourceId);
+	});
 }
+#endif
 
 uint64 UOculusXRPassthroughColorLut::CreateLutObject(const TArray<uint8>& InData, uint32 Resolution) const
 {
@@ -10,20 +10,13 @@ namespace OculusXRPassthrough
 {
 	FOculusXRPassthroughEventDelegates::FOculusXRPassthroughLayerResumedDelegate FOculusXRPassthroughEventDelegates::OculusPassthroughLayerResumed;
 
-	template <typename T>
-	void GetEventData(ovrpEventDataBuffer& Buffer, T& OutEventData)
+	void FOculusXRPassthroughEventHandling::RegisterEventDelegates(OculusXRHMD::FOculusXRHMD& HMD)
 	{
-		unsigned char* BufData = Buffer.EventData;
-		BufData -= sizeof(Buffer.EventType); // Offset buffer data to get to the actual event payload
-
-		memcpy(&OutEventData, BufData, sizeof(T));
+		HMD.AddEventDelegate(ovrpEventType_PassthroughLayerResumed, OculusXRHMD::FOculusXRHMDEventDelegate::CreateStatic(&FOculusXRPassthroughEventHandling::OnEvent));
 	}
 
-	void FOculusXRPassthroughEventHandling::OnPollEvent(ovrpEventDataBuffer* EventDataBuffer, bool& EventPollResult)
+	void FOculusXRPassthroughEventHandling::OnEvent(const ovrpEventDataBuffer& buf)
 	{
-		ovrpEventDataBuffer& buf = *EventDataBuffer;
-		EventPollResult = true;
-
 		switch (buf.EventType)
 		{
 			case ovrpEventType_PassthroughLayerResumed:
@@ -32,8 +25,7 @@ namespace OculusXRPassthrough
 
 				check(HMD);
 
-				ovrpEventDataPassthroughLayerResumed passthroughLayerResumedEvent;
-				GetEventData(buf, passthroughLayerResumedEvent);
+				const ovrpEventDataPassthroughLayerResumed& passthroughLayerResumedEvent = OculusXRHMD::GetEventData<ovrpEventDataPassthroughLayerResumed>(buf);
 
 				// Convert OVR plugin layerID to UE layerID
 				int ovrpID = passthroughLayerResumedEvent.LayerId;
@@ -48,10 +40,8 @@ namespace OculusXRPassthrough
 			}
 
 
-			case ovrpEventType_None:
 			default:
 			{
-				EventPollResult = false;
 				break;
 			}
 		}
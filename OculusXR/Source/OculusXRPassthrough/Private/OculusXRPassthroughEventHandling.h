@@ -6,6 +6,11 @@
 #include "CoreMinimal.h"
 #include "OculusXRHMDPrivate.h"
 
+namespace OculusXRHMD
+{
+	class FOculusXRHMD;
+}
+
 namespace OculusXRPassthrough
 {
 	class FOculusXRPassthroughEventDelegates
@@ -27,7 +32,10 @@ namespace OculusXRPassthrough
 	struct FOculusXRPassthroughEventHandling
 	{
 	public:
-		static void OnPollEvent(ovrpEventDataBuffer* EventDataBuffer, bool& EventPollResult);
+		static void RegisterEventDelegates(OculusXRHMD::FOculusXRHMD& HMD);
+
+	private:
+		static void OnEvent(const ovrpEventDataBuffer& buf);
 	};
 
 } // namespace OculusXRPassthrough
@@ -31,7 +31,7 @@ namespace XRPassthrough
 
 	FPassthroughLayer::FPassthroughLayer(XrPassthroughFB PassthroughInstance, TWeakPtr<FPassthroughXR> Extension)
 		: PassthroughExtension(Extension)
-		, UserDefinedGeometryMap(nullptr)
+		, UserDefinedGeometryState(nullptr)
 		, PassthroughPokeActorMap(nullptr)
 		, XrPassthroughLayer{ XR_NULL_HANDLE }
 		, XrCompositionLayerHeader{}
@@ -41,7 +41,7 @@ namespace XRPassthrough
 
 	FPassthroughLayer::FPassthroughLayer(const FPassthroughLayer& Layer)
 		: PassthroughExtension(Layer.PassthroughExtension)
-		, UserDefinedGeometryMap(Layer.UserDefinedGeometryMap)
+		, UserDefinedGeometryState(Layer.UserDefinedGeometryState)
 		, PassthroughPokeActorMap(Layer.PassthroughPokeActorMap)
 		, Session(Layer.Session)
 		, LayerDesc(Layer.LayerDesc)
@@ -66,7 +66,7 @@ namespace XRPassthrough
 
 		if (!PassthroughPokeActorMap)
 		{
-			PassthroughPokeActorMap = MakeShared<TMap<FString, FPassthroughPokeActor>, ESPMode::ThreadSafe>();
+			PassthroughPokeActorMap = MakeShared<TMap<uint32, FPassthroughPokeActor>, ESPMode::ThreadSafe>();
 		}
 
 		UpdatePassthroughPokeActors_GameThread();
@@ -84,13 +84,14 @@ namespace XRPassthrough
 		OculusXRHMD::CheckInRenderThread();
 
 		// Clear user defined meshes
-		for (auto& Entry : *UserDefinedGeometryMap)
+		for (auto& Entry : UserDefinedGeometryState->Meshes)
 		{
 			const XrTriangleMeshFB MeshHandle = Entry.Value.MeshHandle;
 			const XrGeometryInstanceFB InstanceHandle = Entry.Value.InstanceHandle;
-			RemovePassthroughMesh_RenderThread(MeshHandle, InstanceHandle);
+			RemovePassthroughMesh_RenderThread(Entry.Value.SourceMesh, MeshHandle, InstanceHandle);
 		}
-		UserDefinedGeometryMap->Empty();
+		UserDefinedGeometryState->Meshes.Empty();
+		UserDefinedGeometryState->GeometryListGeneration = 0;
 
 		// Destroy passthrough layer
 		if (XrPassthroughLayer != XR_NULL_HANDLE)
@@ -161,7 +162,7 @@ namespace XRPassthrough
 		else
 		{
 			PassthroughExtension = InLayer->PassthroughExtension;
-			UserDefinedGeometryMap = InLayer->UserDefinedGeometryMap;
+			UserDefinedGeometryState = InLayer->UserDefinedGeometryState;
 			PassthroughPokeActorMap = InLayer->PassthroughPokeActorMap;
 			Session = InLayer->Session;
 			XrPassthroughLayer = InLayer->XrPassthroughLayer;
@@ -169,9 +170,9 @@ namespace XRPassthrough
 			XrPassthroughInstance = InLayer->XrPassthroughInstance;
 		}
 
-		if (!UserDefinedGeometryMap)
+		if (!UserDefinedGeometryState)
 		{
-			UserDefinedGeometryMap = MakeShared<TMap<FString, FPassthroughMesh>, ESPMode::ThreadSafe>();
+			UserDefinedGeometryState = MakeShared<FUserDefinedGeometryState, ESPMode::ThreadSafe>();
 		}
 
 		check(IsPassthoughLayerDesc(LayerDesc));
@@ -223,16 +224,16 @@ namespace XRPassthrough
 		{
 			const FUserDefinedLayer& UserDefinedLayerProps = LayerDesc.GetShape<FUserDefinedLayer>();
 			const TArray<FUserDefinedGeometryDesc>& UserGeometryList = UserDefinedLayerProps.UserGeometryList;
-			TSet<FString> UsedSet = {};
+			TSet<uint32> UsedSet = {};
 
 			if (PassthroughSupportsDepth())
 			{
 				for (const FUserDefinedGeometryDesc& GeometryDesc : UserGeometryList)
 				{
-					const FString MeshName = GeometryDesc.MeshName;
-					UsedSet.Add(MeshName);
+					const uint32 GeometryId = GeometryDesc.GeometryId;
+					UsedSet.Add(GeometryId);
 
-					FPassthroughPokeActor* FoundPassthroughPokeActor = PassthroughPokeActorMap->Find(MeshName);
+					FPassthroughPokeActor* FoundPassthroughPokeActor = PassthroughPokeActorMap->Find(GeometryId);
 					if (!FoundPassthroughPokeActor)
 					{
 						OculusXRHMD::FOculusPassthroughMeshRef GeomPassthroughMesh = GeometryDesc.PassthroughMesh;
@@ -242,7 +243,7 @@ namespace XRPassthrough
 							if (BuildPassthroughPokeActor(GeomPassthroughMesh, PassthroughPokeActor))
 							{
 								PassthroughPokeActor.PokeAHoleComponentPtr->SetWorldTransform(GeometryDesc.Transform);
-								PassthroughPokeActorMap->Add(MeshName, PassthroughPokeActor);
+								PassthroughPokeActorMap->Add(GeometryId, PassthroughPokeActor);
 							}
 						}
 					}
@@ -254,27 +255,17 @@ namespace XRPassthrough
 			}
 
 			// find actors that no longer exist
-			TArray<FString> ItemsToRemove;
-			for (auto& Entry : *PassthroughPokeActorMap)
-			{
-				if (!UsedSet.Contains(Entry.Key))
-				{
-					ItemsToRemove.Add(Entry.Key);
-				}
-			}
-
-			for (FString Entry : ItemsToRemove)
+			for (auto It = PassthroughPokeActorMap->CreateIterator(); It; ++It)
 			{
-				FPassthroughPokeActor* PassthroughPokeActor = PassthroughPokeActorMap->Find(Entry);
-				if (PassthroughPokeActor)
+				if (!UsedSet.Contains(It.Key()))
 				{
 					UWorld* World = GetWorld();
-					if (World && PassthroughPokeActor->PokeAHoleActor.IsValid())
+					if (World && It.Value().PokeAHoleActor.IsValid())
 					{
-						World->DestroyActor(PassthroughPokeActor->PokeAHoleActor.Get());
+						World->DestroyActor(It.Value().PokeAHoleActor.Get());
 					}
+					It.RemoveCurrent();
 				}
-				PassthroughPokeActorMap->Remove(Entry);
 			}
 		}
 	}
@@ -417,14 +408,17 @@ namespace XRPassthrough
 		{
 			const FUserDefinedLayer& UserDefinedLayerProps = LayerDesc.GetShape<FUserDefinedLayer>();
 			const TArray<FUserDefinedGeometryDesc>& UserGeometryList = UserDefinedLayerProps.UserGeometryList;
-			TSet<FString> UsedSet;
+			FUserDefinedGeometryState& GeometryState = *UserDefinedGeometryState;
+
+			// Add/remove diffing is only needed when the list generation moved, 0 means the generation is unknown
+			const bool bListChanged = UserDefinedLayerProps.GeometryListGeneration == 0 || UserDefinedLayerProps.GeometryListGeneration != GeometryState.GeometryListGeneration;
+			// Every instance moves relative to the passthrough space when the tracking origin or scale changes
+			const bool bSpaceChanged = WorldToMetersScale != GeometryState.WorldToMetersScale || !TrackingToWorld.Equals(GeometryState.TrackingToWorld);
+			const uint32 SyncStamp = bListChanged ? ++GeometryState.SyncStamp : 0;
 
 			for (const FUserDefinedGeometryDesc& GeometryDesc : UserGeometryList)
 			{
-				const FString MeshName = GeometryDesc.MeshName;
-				UsedSet.Add(MeshName);
-
-				FPassthroughMesh* LayerPassthroughMesh = UserDefinedGeometryMap->Find(MeshName);
+				FPassthroughMesh* LayerPassthroughMesh = GeometryState.Meshes.Find(GeometryDesc.GeometryId);
 				if (!LayerPassthroughMesh)
 				{
 					OculusXRHMD::FOculusPassthroughMeshRef GeomPassthroughMesh = GeometryDesc.PassthroughMesh;
@@ -433,45 +427,39 @@ namespace XRPassthrough
 						const FMatrix Transform = TransformToPassthroughSpace(GeometryDesc.Transform, WorldToMetersScale, TrackingToWorld);
 						XrTriangleMeshFB MeshHandle = 0;
 						XrGeometryInstanceFB InstanceHandle = 0;
-						AddPassthroughMesh_RenderThread(GeomPassthroughMesh->GetVertices(), GeomPassthroughMesh->GetTriangles(), Transform, Space, MeshHandle, InstanceHandle);
-						UserDefinedGeometryMap->Add(MeshName, FPassthroughMesh(MeshHandle, InstanceHandle, GeometryDesc.Transform));
+						AddPassthroughMesh_RenderThread(GeomPassthroughMesh, Transform, Space, MeshHandle, InstanceHandle);
+						FPassthroughMesh& NewPassthroughMesh = GeometryState.Meshes.Add(GeometryDesc.GeometryId, FPassthroughMesh(GeomPassthroughMesh, MeshHandle, InstanceHandle, GeometryDesc.TransformVersion));
+						NewPassthroughMesh.SyncStamp = SyncStamp;
 					}
 				}
 				else
 				{
-					const FMatrix Transform = TransformToPassthroughSpace(GeometryDesc.Transform, WorldToMetersScale, TrackingToWorld);
-					UpdatePassthroughMeshTransform_RenderThread(LayerPassthroughMesh->InstanceHandle, Transform, Space, Time);
-					LayerPassthroughMesh->LastTransform = GeometryDesc.Transform;
+					LayerPassthroughMesh->SyncStamp = SyncStamp;
+					if (bSpaceChanged || LayerPassthroughMesh->TransformVersion != GeometryDesc.TransformVersion)
+					{
+						const FMatrix Transform = TransformToPassthroughSpace(GeometryDesc.Transform, WorldToMetersScale, TrackingToWorld);
+						UpdatePassthroughMeshTransform_RenderThread(LayerPassthroughMesh->InstanceHandle, Transform, Space, Time);
+						LayerPassthroughMesh->TransformVersion = GeometryDesc.TransformVersion;
+					}
 				}
 			}
 
 			// find meshes that no longer exist
-			TArray<FString> ItemsToRemove;
-			for (auto& Entry : *UserDefinedGeometryMap)
+			if (bListChanged)
 			{
-				if (!UsedSet.Contains(Entry.Key))
+				for (auto It = GeometryState.Meshes.CreateIterator(); It; ++It)
 				{
-					ItemsToRemove.Add(Entry.Key);
+					if (It.Value().SyncStamp != SyncStamp)
+					{
+						RemovePassthroughMesh_RenderThread(It.Value().SourceMesh, It.Value().MeshHandle, It.Value().InstanceHandle);
+						It.RemoveCurrent();
+					}
 				}
+				GeometryState.GeometryListGeneration = UserDefinedLayerProps.GeometryListGeneration;
 			}
 
-			for (FString Entry : ItemsToRemove)
-			{
-				FPassthroughMesh* PassthroughMesh = UserDefinedGeometryMap->Find(Entry);
-				if (PassthroughMesh)
-				{
-					const XrTriangleMeshFB MeshHandle = PassthroughMesh->MeshHandle;
-					const XrGeometryInstanceFB InstanceHandle = PassthroughMesh->InstanceHandle;
-					RemovePassthroughMesh_RenderThread(MeshHandle, InstanceHandle);
-				}
-				else
-				{
-					UE_LOG(LogOculusXRPassthrough, Error, TEXT("PassthroughMesh: %s doesn't exist."), *Entry);
-					return;
-				}
-
-				UserDefinedGeometryMap->Remove(Entry);
-			}
+			GeometryState.WorldToMetersScale = WorldToMetersScale;
+			GeometryState.TrackingToWorld = TrackingToWorld;
 		}
 	}
 
@@ -527,47 +515,75 @@ namespace XRPassthrough
 		return true;
 	}
 
-	void FPassthroughLayer::AddPassthroughMesh_RenderThread(const TArray<FVector>& Vertices, const TArray<int32>& Triangles, FMatrix Transformation, XrSpace Space, XrTriangleMeshFB& OutMeshHandle, XrGeometryInstanceFB& OutInstanceHandle)
+	struct FSharedTriangleMesh
 	{
-		OculusXRHMD::CheckInRenderThread();
+		XrTriangleMeshFB MeshHandle;
+		int32 NumInstances;
+	};
 
-		XrTriangleMeshFB MeshHandle = 0;
-		XrGeometryInstanceFB InstanceHandle = 0;
+	// One XrTriangleMeshFB per source mesh and session, shared by the geometry instances of all layers. Render thread only.
+	static TMap<TPair<XrSession, const OculusXRHMD::FOculusPassthroughMesh*>, FSharedTriangleMesh> SharedTriangleMeshes;
 
-		// Explicit conversion is needed since FVector contains double elements.
-		// Converting Vertices.Data() to float* causes issues when memory is parsed.
-		TArray<XrVector3f> VertexData;
-		VertexData.SetNumUninitialized(Vertices.Num());
+	XrTriangleMeshFB FPassthroughLayer::AcquireTriangleMesh_RenderThread(const OculusXRHMD::FOculusPassthroughMeshRef& PassthroughMesh)
+	{
+		OculusXRHMD::CheckInRenderThread();
 
-		size_t i = 0;
-		for (const FVector& vertex : Vertices)
+		const TPair<XrSession, const OculusXRHMD::FOculusPassthroughMesh*> Key(Session, PassthroughMesh.GetReference());
+		if (FSharedTriangleMesh* SharedMesh = SharedTriangleMeshes.Find(Key))
 		{
-			VertexData[i++] = { (float)vertex.X, (float)vertex.Y, (float)vertex.Z };
+			SharedMesh->NumInstances++;
+			return SharedMesh->MeshHandle;
 		}
 
-		TArray<uint32_t> TriangleData;
-		TriangleData.SetNumUninitialized(Triangles.Num());
-
-		i = 0;
-		for (const int32& tri : Triangles)
-		{
-			TriangleData[i++] = (uint32_t)tri;
-		}
+		// XrVector3f matches FVector3f and the indices are never negative, so the mesh buffers can be passed as they are
+		static_assert(sizeof(XrVector3f) == sizeof(FVector3f), "XrVector3f and FVector3f layouts differ");
+		static_assert(sizeof(uint32_t) == sizeof(int32), "Index sizes differ");
+		const TArray<FVector3f>& Vertices = PassthroughMesh->GetVerticesFloat();
+		const TArray<int32>& Triangles = PassthroughMesh->GetTriangles();
 
 		XrTriangleMeshCreateInfoFB TriangleMeshInfo = { XR_TYPE_TRIANGLE_MESH_CREATE_INFO_FB };
 		TriangleMeshInfo.flags = 0; // not mutable
 		TriangleMeshInfo.triangleCount = Triangles.Num() / 3;
-		TriangleMeshInfo.indexBuffer = TriangleData.GetData();
+		TriangleMeshInfo.indexBuffer = reinterpret_cast<const uint32_t*>(Triangles.GetData());
 		TriangleMeshInfo.vertexCount = Vertices.Num();
-		TriangleMeshInfo.vertexBuffer = VertexData.GetData();
+		TriangleMeshInfo.vertexBuffer = reinterpret_cast<const XrVector3f*>(Vertices.GetData());
 		TriangleMeshInfo.windingOrder = XR_WINDING_ORDER_UNKNOWN_FB;
 
+		XrTriangleMeshFB MeshHandle = XR_NULL_HANDLE;
 		if (XR_FAILED(xrCreateTriangleMeshFB.GetValue()(Session, &TriangleMeshInfo, &MeshHandle)))
 		{
 			UE_LOG(LogOculusXRPassthrough, Error, TEXT("Failed creating passthrough mesh surface."));
+			return XR_NULL_HANDLE;
+		}
+
+		SharedTriangleMeshes.Add(Key, { MeshHandle, 1 });
+		return MeshHandle;
+	}
+
+	void FPassthroughLayer::ReleaseTriangleMesh_RenderThread(const OculusXRHMD::FOculusPassthroughMeshRef& PassthroughMesh)
+	{
+		OculusXRHMD::CheckInRenderThread();
+
+		const TPair<XrSession, const OculusXRHMD::FOculusPassthroughMesh*> Key(Session, PassthroughMesh.GetReference());
+		FSharedTriangleMesh* SharedMesh = SharedTriangleMeshes.Find(Key);
+		if (!SharedMesh || --SharedMesh->NumInstances > 0)
+		{
 			return;
 		}
 
+		if (XR_FAILED(xrDestroyTriangleMeshFB.GetValue()(SharedMesh->MeshHandle)))
+		{
+			UE_LOG(LogOculusXRPassthrough, Error, TEXT("Failed destroying passthrough surface mesh."));
+		}
+		SharedTriangleMeshes.Remove(Key);
+	}
+
+	void FPassthroughLayer::AddPassthroughMesh_RenderThread(const OculusXRHMD::FOculusPassthroughMeshRef& PassthroughMesh, FMatrix Transformation, XrSpace Space, XrTriangleMeshFB& OutMeshHandle, XrGeometryInstanceFB& OutInstanceHandle)
+	{
+		OculusXRHMD::CheckInRenderThread();
+
+		XrGeometryInstanceFB InstanceHandle = 0;
+
 		XrGeometryInstanceCreateInfoFB createInfo = { XR_TYPE_GEOMETRY_INSTANCE_CREATE_INFO_FB };
 
 		bool result = DecomposeTransformMatrix(Transformation, createInfo.pose, createInfo.scale);
@@ -577,6 +593,12 @@ namespace XRPassthrough
 			return;
 		}
 
+		XrTriangleMeshFB MeshHandle = AcquireTriangleMesh_RenderThread(PassthroughMesh);
+		if (MeshHandle == XR_NULL_HANDLE)
+		{
+			return;
+		}
+
 		createInfo.layer = XrPassthroughLayer;
 		createInfo.mesh = MeshHandle;
 		createInfo.baseSpace = Space;
@@ -584,6 +606,7 @@ namespace XRPassthrough
 		if (XR_FAILED(xrCreateGeometryInstanceFB(Session, &createInfo, &InstanceHandle)))
 		{
 			UE_LOG(LogOculusXRPassthrough, Error, TEXT("Failed adding passthrough mesh surface to scene."));
+			ReleaseTriangleMesh_RenderThread(PassthroughMesh);
 			return;
 		}
 
@@ -613,21 +636,22 @@ namespace XRPassthrough
 		}
 	}
 
-	void FPassthroughLayer::RemovePassthroughMesh_RenderThread(XrTriangleMeshFB MeshHandle, XrGeometryInstanceFB InstanceHandle)
+	void FPassthroughLayer::RemovePassthroughMesh_RenderThread(const OculusXRHMD::FOculusPassthroughMeshRef& PassthroughMesh, XrTriangleMeshFB MeshHandle, XrGeometryInstanceFB InstanceHandle)
 	{
 		OculusXRHMD::CheckInRenderThread();
 
-		if (XR_FAILED(xrDestroyGeometryInstanceFB(InstanceHandle)))
+		// Instances that failed to be created never acquired their mesh
+		if (MeshHandle == XR_NULL_HANDLE || InstanceHandle == XR_NULL_HANDLE)
 		{
-			UE_LOG(LogOculusXRPassthrough, Error, TEXT("Failed removing passthrough surface from scene."));
 			return;
 		}
 
-		if (XR_FAILED(xrDestroyTriangleMeshFB.GetValue()(MeshHandle)))
+		if (XR_FAILED(xrDestroyGeometryInstanceFB(InstanceHandle)))
 		{
-			UE_LOG(LogOculusXRPassthrough, Error, TEXT("Failed destroying passthrough surface mesh."));
-			return;
+			UE_LOG(LogOculusXRPassthrough, Error, TEXT("Failed removing passthrough surface from scene."));
 		}
+
+		ReleaseTriangleMesh_RenderThread(PassthroughMesh);
 	}
 
 	void FPassthroughLayer::ClearPassthroughPokeActors()
@@ -26,17 +26,34 @@ namespace XRPassthrough
 	private:
 		struct FPassthroughMesh
 		{
-			FPassthroughMesh(XrTriangleMeshFB MeshHandle, XrGeometryInstanceFB InstanceHandle, FTransform Transform)
-				: MeshHandle(MeshHandle)
+			FPassthroughMesh(OculusXRHMD::FOculusPassthroughMeshRef SourceMesh, XrTriangleMeshFB MeshHandle, XrGeometryInstanceFB InstanceHandle, uint32 TransformVersion)
+				: SourceMesh(SourceMesh)
+				, MeshHandle(MeshHandle)
 				, InstanceHandle(InstanceHandle)
-				, LastTransform(Transform)
+				, TransformVersion(TransformVersion)
+				, SyncStamp(0)
 			{
 			}
+			OculusXRHMD::FOculusPassthroughMeshRef SourceMesh;
+			// Shared with every other instance of SourceMesh in the session
 			XrTriangleMeshFB MeshHandle;
 			XrGeometryInstanceFB InstanceHandle;
-			FTransform LastTransform;
+			// Last FUserDefinedGeometryDesc::TransformVersion pushed to the runtime
+			uint32 TransformVersion;
+			// Set on every add/remove diff the instance survives
+			uint32 SyncStamp;
 		};
-		typedef TSharedPtr<TMap<FString, FPassthroughMesh>, ESPMode::ThreadSafe> FUserDefinedGeometryMapPtr;
+
+		// Render thread state of the user defined geometry, shared between clones of the layer
+		struct FUserDefinedGeometryState
+		{
+			TMap<uint32, FPassthroughMesh> Meshes;
+			uint32 GeometryListGeneration = 0;
+			uint32 SyncStamp = 0;
+			float WorldToMetersScale = 0.0f;
+			FTransform TrackingToWorld;
+		};
+		typedef TSharedPtr<FUserDefinedGeometryState, ESPMode::ThreadSafe> FUserDefinedGeometryStatePtr;
 
 		struct FPassthroughPokeActor
 		{
@@ -48,7 +65,7 @@ namespace XRPassthrough
 			TWeakObjectPtr<AActor> PokeAHoleActor;
 		};
 
-		typedef TSharedPtr<TMap<FString, FPassthroughPokeActor>, ESPMode::ThreadSafe> FPassthroughPokeActorMapPtr;
+		typedef TSharedPtr<TMap<uint32, FPassthroughPokeActor>, ESPMode::ThreadSafe> FPassthroughPokeActorMapPtr;
 
 	public:
 		static bool IsPassthoughLayerDesc(const IStereoLayers::FLayerDesc& LayerDesc);
@@ -74,15 +91,18 @@ namespace XRPassthrough
 		const IStereoLayers::FLayerDesc& GetDesc() const { return LayerDesc; };
 		const XrPassthroughLayerFB GetLayerHandle() const { return XrPassthroughLayer; }
 
-		void AddPassthroughMesh_RenderThread(const TArray<FVector>& Vertices, const TArray<int32>& Triangles, FMatrix Transformation, XrSpace Space, XrTriangleMeshFB& OutMeshHandle, XrGeometryInstanceFB& OutInstanceHandle);
+		void AddPassthroughMesh_RenderThread(const OculusXRHMD::FOculusPassthroughMeshRef& PassthroughMesh, FMatrix Transformation, XrSpace Space, XrTriangleMeshFB& OutMeshHandle, XrGeometryInstanceFB& OutInstanceHandle);
 		void UpdatePassthroughMeshTransform_RenderThread(XrGeometryInstanceFB InstanceHandle, FMatrix Transformation, XrSpace Space, XrTime Time);
-		void RemovePassthroughMesh_RenderThread(XrTriangleMeshFB MeshHandle, XrGeometryInstanceFB InstanceHandle);
+		void RemovePassthroughMesh_RenderThread(const OculusXRHMD::FOculusPassthroughMeshRef& PassthroughMesh, XrTriangleMeshFB MeshHandle, XrGeometryInstanceFB InstanceHandle);
 		void ClearPassthroughPokeActors();
 
 	private:
+		XrTriangleMeshFB AcquireTriangleMesh_RenderThread(const OculusXRHMD::FOculusPassthroughMeshRef& PassthroughMesh);
+		void ReleaseTriangleMesh_RenderThread(const OculusXRHMD::FOculusPassthroughMeshRef& PassthroughMesh);
+
 		TWeakPtr<FPassthroughXR> PassthroughExtension;
 
-		FUserDefinedGeometryMapPtr UserDefinedGeometryMap;
+		FUserDefinedGeometryStatePtr UserDefinedGeometryState;
 		FPassthroughPokeActorMapPtr PassthroughPokeActorMap;
 
 		XrSession Session;
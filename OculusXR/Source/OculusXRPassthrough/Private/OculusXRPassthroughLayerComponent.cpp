@@ -16,6 +16,10 @@
 
 DEFINE_LOG_CATEGORY(LogOculusPassthrough);
 
+// Shared by all user defined shapes so ids and generations stay unique when a component swaps its shape
+static uint32 NextPassthroughGeometryId = 1;
+static uint32 NextPassthroughGeometryListGeneration = 1;
+
 void UOculusXRStereoLayerShapeReconstructed::ApplyShape(IStereoLayers::FLayerDesc& LayerDesc)
 {
 	const FEdgeStyleParameters EdgeStyleParameters(
@@ -55,7 +59,7 @@ void UOculusXRStereoLayerShapeUserDefined::ApplyShape(IStereoLayers::FLayerDesc&
 		ColorMapType,
 		GetColorArray(bUseColorMapCurve, ColorMapCurve),
 		GenerateColorLutDescription(LutWeight, ColorLUTSource, ColorLUTTarget));
-	LayerDesc.SetShape<FUserDefinedLayer>(UserGeometryList, EdgeStyleParameters, LayerOrder);
+	LayerDesc.SetShape<FUserDefinedLayer>(UserGeometryList, EdgeStyleParameters, LayerOrder, GeometryListGeneration);
 }
 
 void UOculusXRStereoLayerShapeUserDefined::AddGeometry(const FString& MeshName, OculusXRHMD::FOculusPassthroughMeshRef PassthroughMesh, FTransform Transform, bool bUpdateTransform)
@@ -65,15 +69,22 @@ void UOculusXRStereoLayerShapeUserDefined::AddGeometry(const FString& MeshName,
 		PassthroughMesh,
 		Transform,
 		bUpdateTransform);
+	UserDefinedGeometryDesc.GeometryId = NextPassthroughGeometryId++;
 
 	UserGeometryList.Add(UserDefinedGeometryDesc);
+	GeometryListGeneration = NextPassthroughGeometryListGeneration++;
 }
 
 void UOculusXRStereoLayerShapeUserDefined::RemoveGeometry(const FString& MeshName)
 {
-	UserGeometryList.RemoveAll([MeshName](const FUserDefinedGeometryDesc& Desc) {
+	const int32 NumRemoved = UserGeometryList.RemoveAll([MeshName](const FUserDefinedGeometryDesc& Desc) {
 		return Desc.MeshName == MeshName;
 	});
+
+	if (NumRemoved > 0)
+	{
+		GeometryListGeneration = NextPassthroughGeometryListGeneration++;
+	}
 }
 
 UOculusXRPassthroughLayerComponent::UOculusXRPassthroughLayerComponent(const FObjectInitializer& ObjectInitializer)
@@ -144,8 +155,13 @@ void UOculusXRPassthroughLayerComponent::UpdatePassthroughObjects()
 				const UMeshComponent** MeshComponent = PassthroughComponentMap.Find(Entry.MeshName);
 				if (MeshComponent)
 				{
-					Entry.Transform = (*MeshComponent)->GetComponentTransform();
-					bDirty = true;
+					const FTransform& ComponentTransform = (*MeshComponent)->GetComponentTransform();
+					if (!Entry.Transform.Equals(ComponentTransform))
+					{
+						Entry.Transform = ComponentTransform;
+						Entry.TransformVersion++;
+						bDirty = true;
+					}
 				}
 			}
 		}
@@ -217,24 +233,29 @@ OculusXRHMD::FOculusPassthroughMeshRef UOculusXRPassthroughLayerComponent::Creat
 	}
 
 	const int32 LODIndex = 0;
-	FStaticMeshLODResources& LOD = Mesh->GetRenderData()->LODResources[LODIndex];
 
-	TArray<int32> Triangles;
-	const int32 NumIndices = LOD.IndexBuffer.GetNumIndices();
-	for (int32 i = 0; i < NumIndices; ++i)
-	{
-		Triangles.Add(LOD.IndexBuffer.GetIndex(i));
-	}
+	// Every component using the same static mesh shares one passthrough mesh
+	return OculusXRHMD::FOculusPassthroughMeshCache::FindOrCreate(Mesh, LODIndex, [Mesh, LODIndex]() {
+		FStaticMeshLODResources& LOD = Mesh->GetRenderData()->LODResources[LODIndex];
 
-	TArray<FVector> Vertices;
-	const int32 NumVertices = LOD.VertexBuffers.PositionVertexBuffer.GetNumVertices();
-	for (int32 i = 0; i < NumVertices; ++i)
-	{
-		Vertices.Add((FVector)LOD.VertexBuffers.PositionVertexBuffer.VertexPosition(i));
-	}
+		TArray<int32> Triangles;
+		const int32 NumIndices = LOD.IndexBuffer.GetNumIndices();
+		Triangles.Reserve(NumIndices);
+		for (int32 i = 0; i < NumIndices; ++i)
+		{
+			Triangles.Add(LOD.IndexBuffer.GetIndex(i));
+		}
 
-	OculusXRHMD::FOculusPassthroughMeshRef PassthroughMesh = new OculusXRHMD::FOculusPassthroughMesh(Vertices, Triangles);
-	return PassthroughMesh;
+		TArray<FVector> Vertices;
+		const int32 NumVertices = LOD.VertexBuffers.PositionVertexBuffer.GetNumVertices();
+		Vertices.Reserve(NumVertices);
+		for (int32 i = 0; i < NumVertices; ++i)
+		{
+			Vertices.Add((FVector)LOD.VertexBuffers.PositionVertexBuffer.VertexPosition(i));
+		}
+
+		return OculusXRHMD::FOculusPassthroughMeshRef(new OculusXRHMD::FOculusPassthroughMesh(Vertices, Triangles));
+	});
 }
 
 void UOculusXRPassthroughLayerComponent::AddSurfaceGeometry(AStaticMeshActor* StaticMeshActor, bool updateTransform)
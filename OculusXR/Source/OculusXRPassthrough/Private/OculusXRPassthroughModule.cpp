@@ -51,7 +51,7 @@ void FOculusXRPassthroughModule::OnPostEngineInit()
 		return;
 	}
 
-	HMD->AddEventPollingDelegate(OculusXRHMD::FOculusXRHMDEventPollingDelegate::CreateStatic(&OculusXRPassthrough::FOculusXRPassthroughEventHandling::OnPollEvent));
+	OculusXRPassthrough::FOculusXRPassthroughEventHandling::RegisterEventDelegates(*HMD);
 }
 
 IMPLEMENT_MODULE(FOculusXRPassthroughModule, OculusXRPassthrough)
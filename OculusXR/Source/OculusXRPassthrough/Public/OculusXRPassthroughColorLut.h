@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "UObject/ObjectMacros.h"
 #include "Engine/Texture2D.h"
+#include "Tasks/Task.h"
 
 #include "OculusXRPassthroughColorLut.generated.h"
 
@@ -27,11 +28,18 @@ public:
 	UPROPERTY()
 	uint32 Resolution;
 
+	/** Id of the source texture the data was baked from. Lets the editor skip re-baking an unchanged texture. */
+	UPROPERTY()
+	FGuid SourceId;
+
 	FLutTextureData()
 		: Data{}, Resolution(0) {}
 
-	FLutTextureData(const TArray<uint8>& InData, uint32 InResolution)
-		: Data(InData), Resolution(InResolution) {}
+	FLutTextureData(const TArray<uint8>& InData, uint32 InResolution, const FGuid& InSourceId = FGuid())
+		: Data(InData), Resolution(InResolution), SourceId(InSourceId) {}
+
+	FLutTextureData(TArray<uint8>&& InData, uint32 InResolution, const FGuid& InSourceId = FGuid())
+		: Data(MoveTemp(InData)), Resolution(InResolution), SourceId(InSourceId) {}
 };
 
 UENUM(BlueprintType)
@@ -86,17 +94,28 @@ public:
 	/** Remove a layer reference. When there's no reference to any layer we destroy the lut object and clear the handle. */
 	void RemoveReference(UOculusXRPassthroughLayerBase* LayerRef);
 	virtual void PreSave(FObjectPreSaveContext ObjectSaveContext) override;
+	virtual void PostLoad() override;
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
 
 	void BeginDestroy() override;
 
 private:
+	/** LUT data baked from the texture when the asset is saved, so cooked builds never convert textures at runtime. */
 	UPROPERTY()
 	FLutTextureData StoredTextureData;
 	uint64 LutHandle = 0;
 	int32 ColorArrayResolution = 0;
 	int MaxResolution = -1;
 	TArray<uint32> LayerRefs;
-	FLutTextureData TextureToColorData(class UTexture2D* InLutTexture) const;
+#if WITH_EDITOR
+	/** Bake of LutTexture running on a worker task, adopted into StoredTextureData once complete. */
+	UE::Tasks::TTask<FLutTextureData> TextureBakeTask;
+	UE::Tasks::TTask<FLutTextureData> TextureToColorData(class UTexture2D* InLutTexture) const;
+	void BakeTextureData();
+	void FinishTextureBake(bool bWait);
+#endif
 	uint64 CreateLutObject(const TArray<uint8>& InData, uint32 Resolution) const;
 	void UpdateLutObject(uint64 Handle, const TArray<uint8>& InData) const;
 	void DestroyLutObject(uint64 Handle) const;
@@ -318,6 +318,7 @@ public:
 
 private:
 	TArray<FUserDefinedGeometryDesc> UserGeometryList;
+	uint32 GeometryListGeneration = 0;
 };
 
 class UProceduralMeshComponent;
@@ -28,6 +28,10 @@
 AOculusXRSceneActor::AOculusXRSceneActor(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 {
+	// Ticks only while discovered scene anchors are waiting to be spawned
+	PrimaryActorTick.bCanEverTick = true;
+	PrimaryActorTick.bStartWithTickEnabled = false;
+
 	ResetStates();
 
 	// Create required components
@@ -118,6 +122,8 @@ void AOculusXRSceneActor::EndPlay(EEndPlayReason::Type Reason)
 void AOculusXRSceneActor::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
+
+	ProcessPendingSceneAnchors();
 }
 
 bool AOculusXRSceneActor::IsValidUuid(const FOculusXRUUID& Uuid)
@@ -170,6 +176,7 @@ AActor* AOculusXRSceneActor::SpawnActorWithSceneComponent(const FOculusXRUInt64&
 	rootComponent->SetWorldLocation(FVector::ZeroVector);
 
 	Anchor->AttachToActor(this, FAttachmentTransformRules::KeepRelativeTransform);
+	AddToSemanticLabelIndex(Anchor, SemanticClassifications);
 
 #if WITH_EDITOR
 	if (SemanticClassifications.Num() > 0)
@@ -277,7 +284,8 @@ bool AOculusXRSceneActor::IsScenePopulated()
 		return false;
 	}
 
-	return RootComponent->GetNumChildrenComponents() > 0;
+	// Anchors still waiting for their share of the populate budget make the scene incomplete
+	return RootComponent->GetNumChildrenComponents() > 0 && NextPendingSceneAnchor >= PendingSceneAnchors.Num();
 }
 
 bool AOculusXRSceneActor::IsRoomLayoutValid()
@@ -301,6 +309,10 @@ void AOculusXRSceneActor::PopulateScene()
 
 void AOculusXRSceneActor::ClearScene()
 {
+	SemanticLabelIndex.Reset();
+	PendingSceneAnchors.Reset();
+	NextPendingSceneAnchor = 0;
+
 	if (!RootComponent)
 		return;
 
@@ -328,86 +340,77 @@ void AOculusXRSceneActor::SetVisibilityToAllSceneAnchors(const bool bIsVisible)
 
 void AOculusXRSceneActor::SetVisibilityToSceneAnchorsBySemanticLabel(const FString SemanticLabel, const bool bIsVisible)
 {
-	FString label = SemanticLabel;
-	if (SemanticLabel == TEXT("DESK"))
-	{
-		label = TEXT("TABLE");
-		UE_LOG(LogOculusXRScene, Warning, TEXT("XR Scene Actor semantic lable 'DESK' is deprecated, use 'TABLE' instead."));
-	}
+	const FName labelId = FindSemanticLabelId(SemanticLabel);
 
-	if (!RootComponent)
+	if (!RootComponent || labelId.IsNone())
 		return;
 
-	TArray<USceneComponent*> childrenComponents = RootComponent->GetAttachChildren();
-	for (USceneComponent* sceneComponent : childrenComponents)
+	const TArray<TWeakObjectPtr<AActor>>* indexedActors = SemanticLabelIndex.Find(labelId);
+	if (!indexedActors)
 	{
-		UObject* outerObject = sceneComponent->GetOuter();
-		if (!outerObject)
-		{
-			continue;
-		}
-
-		AActor* outerActor = Cast<AActor>(outerObject);
-		if (!outerActor)
-		{
-			continue;
-		}
-
-		UActorComponent* sceneAnchorComponent = outerActor->GetComponentByClass(UOculusXRSceneAnchorComponent::StaticClass());
-		if (!sceneAnchorComponent)
-		{
-			continue;
-		}
+		return;
+	}
 
-		if (Cast<UOculusXRSceneAnchorComponent>(sceneAnchorComponent)->SemanticClassifications.Contains(label))
+	for (const TWeakObjectPtr<AActor>& weakActor : *indexedActors)
+	{
+		AActor* actor = weakActor.Get();
+		if (actor && actor->GetRootComponent())
 		{
-			sceneComponent->SetVisibility(bIsVisible, true);
+			actor->GetRootComponent()->SetVisibility(bIsVisible, true);
 		}
 	}
 }
 
 TArray<AActor*> AOculusXRSceneActor::GetActorsBySemanticLabel(const FString SemanticLabel)
 {
-	FString label = SemanticLabel;
-	if (SemanticLabel == TEXT("DESK"))
-	{
-		label = TEXT("TABLE");
-		UE_LOG(LogOculusXRScene, Warning, TEXT("XR Scene Actor semantic lable 'DESK' is deprecated, use 'TABLE' instead."));
-	}
+	const FName labelId = FindSemanticLabelId(SemanticLabel);
 
 	TArray<AActor*> actors;
 
-	if (!RootComponent)
+	if (!RootComponent || labelId.IsNone())
 		return actors;
 
-	TArray<USceneComponent*> childrenComponents = RootComponent->GetAttachChildren();
-	for (USceneComponent* sceneComponent : childrenComponents)
+	TArray<TWeakObjectPtr<AActor>>* indexedActors = SemanticLabelIndex.Find(labelId);
+	if (!indexedActors)
 	{
-		UObject* outerObject = sceneComponent->GetOuter();
-		if (!outerObject)
-		{
-			continue;
-		}
+		return actors;
+	}
 
-		AActor* outerActor = Cast<AActor>(outerObject);
-		if (!outerActor)
-		{
-			continue;
-		}
+	// Drop anchors destroyed outside of ClearScene
+	indexedActors->RemoveAll([](const TWeakObjectPtr<AActor>& weakActor) { return !weakActor.IsValid(); });
 
-		UActorComponent* sceneAnchorComponent = outerActor->GetComponentByClass(UOculusXRSceneAnchorComponent::StaticClass());
-		if (!sceneAnchorComponent)
-		{
-			continue;
-		}
+	actors.Reserve(indexedActors->Num());
+	for (const TWeakObjectPtr<AActor>& weakActor : *indexedActors)
+	{
+		actors.Add(weakActor.Get());
+	}
+
+	return actors;
+}
 
-		if (Cast<UOculusXRSceneAnchorComponent>(sceneAnchorComponent)->SemanticClassifications.Contains(label))
+FName AOculusXRSceneActor::FindSemanticLabelId(const FString& SemanticLabel)
+{
+	if (SemanticLabel == TEXT("DESK"))
+	{
+		UE_LOG(LogOculusXRScene, Warning, TEXT("XR Scene Actor semantic lable 'DESK' is deprecated, use 'TABLE' instead."));
+		return FName(TEXT("TABLE"));
+	}
+
+	// Labels that were never interned can't have been indexed
+	return FName(*SemanticLabel, FNAME_Find);
+}
+
+void AOculusXRSceneActor::AddToSemanticLabelIndex(AActor* Anchor, const TArray<FString>& SemanticClassifications)
+{
+	for (const FString& label : SemanticClassifications)
+	{
+		// Anchors are indexed as they are spawned, so a repeated label can only match the last entry
+		TArray<TWeakObjectPtr<AActor>>& indexedActors = SemanticLabelIndex.FindOrAdd(FName(*label));
+		if (indexedActors.IsEmpty() || indexedActors.Last().Get() != Anchor)
 		{
-			actors.Add(outerActor);
+			indexedActors.Add(Anchor);
 		}
 	}
-
-	return actors;
 }
 
 TArray<FOculusXRRoomLayout> AOculusXRSceneActor::GetRoomLayouts() const
@@ -493,56 +496,91 @@ EOculusXRAnchorResult::Type AOculusXRSceneActor::QueryRoomUUIDs(const FOculusXRU
 
 void AOculusXRSceneActor::SceneRoomDiscoveryResultsAvailable(const TArray<FOculusXRAnchorsDiscoverResult>& DiscoveryResults, const FOculusXRUInt64 RoomSpaceID)
 {
+	// Fetch the component status and labels of the whole batch up front, spawning is then spread over frames
+	PendingSceneAnchors.Reserve(PendingSceneAnchors.Num() + DiscoveryResults.Num());
 	for (auto& AnchorQueryElement : DiscoveryResults)
 	{
-		ProcessRoomElementsResult(AnchorQueryElement.Space, RoomSpaceID);
+		FetchPendingSceneAnchor(AnchorQueryElement.Space, RoomSpaceID, PendingSceneAnchors.AddDefaulted_GetRef());
+	}
+
+	ProcessPendingSceneAnchors();
+}
+
+void AOculusXRSceneActor::FetchPendingSceneAnchor(FOculusXRUInt64 AnchorHandle, const FOculusXRUInt64 RoomSpaceID, FOculusXRPendingSceneAnchor& OutPendingAnchor) const
+{
+	OutPendingAnchor.Space = AnchorHandle;
+	OutPendingAnchor.RoomSpaceID = RoomSpaceID;
+
+	GetSemanticClassifications(AnchorHandle.Value, OutPendingAnchor.SemanticClassifications);
+	UE_LOG(LogOculusXRScene, Log, TEXT("SpatialAnchor Scene label is %s"), OutPendingAnchor.SemanticClassifications.Num() > 0 ? *OutPendingAnchor.SemanticClassifications[0] : TEXT("unknown"));
+
+	auto getComponentEnabled = [&AnchorHandle](EOculusXRSpaceComponentType ComponentType) {
+		bool bEnabled = false;
+		bool bOutPending = false;
+		EOculusXRAnchorResult::Type result = OculusXRAnchors::FOculusXRAnchorManager::GetAnchorComponentStatus(
+			AnchorHandle.Value, ComponentType, bEnabled, bOutPending);
+		return UOculusXRAnchorBPFunctionLibrary::IsAnchorResultSuccess(result) && bEnabled;
+	};
+
+	if (SceneGlobalMeshComponent && OutPendingAnchor.SemanticClassifications.Contains(UOculusXRSceneGlobalMeshComponent::GlobalMeshSemanticLabel))
+	{
+		OutPendingAnchor.bIsTriangleMesh = getComponentEnabled(EOculusXRSpaceComponentType::TriangleMesh);
+		return;
 	}
+
+	OutPendingAnchor.bIsScenePlane = getComponentEnabled(EOculusXRSpaceComponentType::ScenePlane);
+	OutPendingAnchor.bIsSceneVolume = getComponentEnabled(EOculusXRSpaceComponentType::SceneVolume);
 }
 
-void AOculusXRSceneActor::ProcessRoomElementsResult(FOculusXRUInt64 AnchorHandle, const FOculusXRUInt64 RoomSpaceID)
+void AOculusXRSceneActor::ProcessPendingSceneAnchors()
 {
-	bool bOutPending = false;
+	const double startTime = FPlatformTime::Seconds();
+	const double timeBudget = PopulateSceneTimeBudgetMs / 1000.0;
 
-	if (SceneGlobalMeshComponent)
+	while (NextPendingSceneAnchor < PendingSceneAnchors.Num())
 	{
-		TArray<FString> semanticClassifications;
-		GetSemanticClassifications(AnchorHandle.Value, semanticClassifications);
-		UE_LOG(LogOculusXRScene, Log, TEXT("SpatialAnchor Scene label is %s"), semanticClassifications.Num() > 0 ? *semanticClassifications[0] : TEXT("unknown"));
-		if (semanticClassifications.Contains(UOculusXRSceneGlobalMeshComponent::GlobalMeshSemanticLabel))
+		ProcessRoomElementsResult(PendingSceneAnchors[NextPendingSceneAnchor++]);
+
+		if (timeBudget > 0.0 && FPlatformTime::Seconds() - startTime >= timeBudget)
 		{
-			bool bIsTriangleMesh = false;
-			EOculusXRAnchorResult::Type result = OculusXRAnchors::FOculusXRAnchorManager::GetAnchorComponentStatus(
-				AnchorHandle.Value, EOculusXRSpaceComponentType::TriangleMesh, bIsTriangleMesh, bOutPending);
+			break;
+		}
+	}
 
-			if (!UOculusXRAnchorBPFunctionLibrary::IsAnchorResultSuccess(result) || !bIsTriangleMesh)
-			{
-				UE_LOG(LogOculusXRScene, Error, TEXT("SpatialAnchorQueryResult_Handler Failed to load Triangle Mesh Component for a GLOBAL_MESH"));
-				return;
-			}
+	if (NextPendingSceneAnchor >= PendingSceneAnchors.Num())
+	{
+		PendingSceneAnchors.Reset();
+		NextPendingSceneAnchor = 0;
+	}
 
-			UClass* sceneAnchorComponentInstanceClass = SceneGlobalMeshComponent->GetAnchorComponentClass();
+	SetActorTickEnabled(NextPendingSceneAnchor < PendingSceneAnchors.Num());
+}
 
-			AActor* globalMeshAnchor = SpawnActorWithSceneComponent(AnchorHandle.Value, RoomSpaceID, semanticClassifications, sceneAnchorComponentInstanceClass);
+void AOculusXRSceneActor::ProcessRoomElementsResult(const FOculusXRPendingSceneAnchor& PendingAnchor)
+{
+	const FOculusXRUInt64& AnchorHandle = PendingAnchor.Space;
+	const FOculusXRUInt64& RoomSpaceID = PendingAnchor.RoomSpaceID;
+	const TArray<FString>& semanticClassifications = PendingAnchor.SemanticClassifications;
 
-			SceneGlobalMeshComponent->CreateMeshComponent(AnchorHandle, globalMeshAnchor, RoomLayoutManagerComponent);
+	if (SceneGlobalMeshComponent && semanticClassifications.Contains(UOculusXRSceneGlobalMeshComponent::GlobalMeshSemanticLabel))
+	{
+		if (!PendingAnchor.bIsTriangleMesh)
+		{
+			UE_LOG(LogOculusXRScene, Error, TEXT("SpatialAnchorQueryResult_Handler Failed to load Triangle Mesh Component for a GLOBAL_MESH"));
 			return;
 		}
-	}
 
-	bool bIsScenePlane = false;
-	bool bIsSceneVolume = false;
-	EOculusXRAnchorResult::Type isPlaneResult = OculusXRAnchors::FOculusXRAnchorManager::GetAnchorComponentStatus(
-		AnchorHandle.Value, EOculusXRSpaceComponentType::ScenePlane, bIsScenePlane, bOutPending);
+		UClass* sceneAnchorComponentInstanceClass = SceneGlobalMeshComponent->GetAnchorComponentClass();
 
-	EOculusXRAnchorResult::Type isVolumeResult = OculusXRAnchors::FOculusXRAnchorManager::GetAnchorComponentStatus(
-		AnchorHandle.Value, EOculusXRSpaceComponentType::SceneVolume, bIsSceneVolume, bOutPending);
+		AActor* globalMeshAnchor = SpawnActorWithSceneComponent(AnchorHandle.Value, RoomSpaceID, semanticClassifications, sceneAnchorComponentInstanceClass);
 
-	bool bIsPlaneResultSuccess = UOculusXRAnchorBPFunctionLibrary::IsAnchorResultSuccess(isPlaneResult);
-	bool bIsVolumeResultSuccess = UOculusXRAnchorBPFunctionLibrary::IsAnchorResultSuccess(isVolumeResult);
+		SceneGlobalMeshComponent->CreateMeshComponent(AnchorHandle, globalMeshAnchor, RoomLayoutManagerComponent);
+		return;
+	}
 
 	AActor* anchor = nullptr;
 
-	if (bIsPlaneResultSuccess && bIsScenePlane)
+	if (PendingAnchor.bIsScenePlane)
 	{
 		FVector scenePlanePos;
 		FVector scenePlaneSize;
@@ -553,9 +591,6 @@ void AOculusXRSceneActor::ProcessRoomElementsResult(FOculusXRUInt64 AnchorHandle
 				scenePlanePos.X, scenePlanePos.Y, scenePlanePos.Z,
 				scenePlaneSize.X, scenePlaneSize.Y, scenePlaneSize.Z);
 
-			TArray<FString> semanticClassifications;
-			GetSemanticClassifications(AnchorHandle.Value, semanticClassifications);
-
 			UE_LOG(LogOculusXRScene, Log, TEXT("SpatialAnchor ScenePlane label is %s"), semanticClassifications.Num() > 0 ? *semanticClassifications[0] : TEXT("unknown"));
 
 			anchor = SpawnOrUpdateSceneAnchor(anchor, AnchorHandle, RoomSpaceID, scenePlanePos, scenePlaneSize, semanticClassifications, EOculusXRSpaceComponentType::ScenePlane);
@@ -570,7 +605,7 @@ void AOculusXRSceneActor::ProcessRoomElementsResult(FOculusXRUInt64 AnchorHandle
 		}
 	}
 
-	if (bIsVolumeResultSuccess && bIsSceneVolume)
+	if (PendingAnchor.bIsSceneVolume)
 	{
 		FVector sceneVolumePos;
 		FVector sceneVolumeSize;
@@ -581,9 +616,6 @@ void AOculusXRSceneActor::ProcessRoomElementsResult(FOculusXRUInt64 AnchorHandle
 				sceneVolumePos.X, sceneVolumePos.Y, sceneVolumePos.Z,
 				sceneVolumeSize.X, sceneVolumeSize.Y, sceneVolumeSize.Z);
 
-			TArray<FString> semanticClassifications;
-			GetSemanticClassifications(AnchorHandle.Value, semanticClassifications);
-
 			UE_LOG(LogOculusXRScene, Log, TEXT("SpatialAnchor SceneVolume label is %s"), semanticClassifications.Num() > 0 ? *semanticClassifications[0] : TEXT("unknown"));
 
 			anchor = SpawnOrUpdateSceneAnchor(anchor, AnchorHandle, RoomSpaceID, sceneVolumePos, sceneVolumeSize, semanticClassifications, EOculusXRSpaceComponentType::SceneVolume);
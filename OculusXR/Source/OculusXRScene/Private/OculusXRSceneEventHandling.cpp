@@ -11,38 +11,27 @@
 
 namespace OculusXRScene
 {
-	template <typename T>
-	void GetEventData(ovrpEventDataBuffer& Buffer, T& OutEventData)
+	void FOculusXRSceneEventHandling::RegisterEventDelegates(OculusXRHMD::FOculusXRHMD& HMD)
 	{
-		unsigned char* BufData = Buffer.EventData;
-		BufData -= sizeof(Buffer.EventType); // Offset buffer data to get to the actual event payload
-
-		memcpy(&OutEventData, BufData, sizeof(T));
+		// The runtime packs the scene capture payload right after EventType
+		HMD.AddEventDelegate(ovrpEventType_SceneCaptureComplete, OculusXRHMD::FOculusXRHMDEventDelegate::CreateStatic(&FOculusXRSceneEventHandling::OnEvent), sizeof(ovrpEventSceneCaptureComplete));
+		HMD.AddEventDelegate(ovrpEventType_BoundaryVisibilityChanged, OculusXRHMD::FOculusXRHMDEventDelegate::CreateStatic(&FOculusXRSceneEventHandling::OnEvent));
 	}
 
-	void FOculusXRSceneEventHandling::OnPollEvent(ovrpEventDataBuffer* EventDataBuffer, bool& EventPollResult)
+	void FOculusXRSceneEventHandling::OnEvent(const ovrpEventDataBuffer& buf)
 	{
-		ovrpEventDataBuffer& buf = *EventDataBuffer;
-		EventPollResult = true;
-
 		switch (buf.EventType)
 		{
 			case ovrpEventType_SceneCaptureComplete:
 			{
-				ovrpEventSceneCaptureComplete sceneCaptureComplete;
-				unsigned char* bufData = buf.EventData;
-
-				memcpy(&sceneCaptureComplete.requestId, bufData, sizeof(sceneCaptureComplete.requestId));
-				bufData += sizeof(ovrpUInt64); // move forward
-				memcpy(&sceneCaptureComplete.result, bufData, sizeof(sceneCaptureComplete.result));
+				const ovrpEventSceneCaptureComplete& sceneCaptureComplete = OculusXRHMD::GetEventData<ovrpEventSceneCaptureComplete>(buf);
 
 				FOculusXRSceneEventDelegates::OculusSceneCaptureComplete.Broadcast(FOculusXRUInt64(sceneCaptureComplete.requestId), sceneCaptureComplete.result >= 0);
 				break;
 			}
 			case ovrpEventType_BoundaryVisibilityChanged:
 			{
-				ovrpEventDataBoundaryVisibilityChanged visibilityChangedEvent;
-				GetEventData(buf, visibilityChangedEvent);
+				const ovrpEventDataBoundaryVisibilityChanged& visibilityChangedEvent = OculusXRHMD::GetEventData<ovrpEventDataBoundaryVisibilityChanged>(buf);
 
 				ovrpBoundaryVisibility newVisibility = visibilityChangedEvent.BoundaryVisibility;
 				EOculusXRBoundaryVisibility ueVisibility = EOculusXRBoundaryVisibility::Invalid;
@@ -72,10 +61,8 @@ namespace OculusXRScene
 				break;
 			}
 
-			case ovrpEventType_None:
 			default:
 			{
-				EventPollResult = false;
 				break;
 			}
 		}
@@ -10,10 +10,18 @@ LICENSE file in the root directory of this source tree.
 #include "CoreMinimal.h"
 #include "OculusXRHMDPrivate.h"
 
+namespace OculusXRHMD
+{
+	class FOculusXRHMD;
+}
+
 namespace OculusXRScene
 {
 	struct OCULUSXRSCENE_API FOculusXRSceneEventHandling
 	{
-		static void OnPollEvent(ovrpEventDataBuffer* EventDataBuffer, bool& EventPollResult);
+		static void RegisterEventDelegates(OculusXRHMD::FOculusXRHMD& HMD);
+
+	private:
+		static void OnEvent(const ovrpEventDataBuffer& buf);
 	};
 } // namespace OculusXRScene
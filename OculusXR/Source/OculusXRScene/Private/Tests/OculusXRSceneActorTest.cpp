@@ -0,0 +1,79 @@
+// Copyright (c) Meta Platforms, Inc. and affiliates.
+
+#include "Misc/AutomationTest.h"
+#include "OculusXRSceneActor.h"
+#include "Components/SceneComponent.h"
+#include "Engine/World.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FOculusXRSceneActorPopulateBudgetTest,
+	"OculusXR.Scene.SceneActor.PopulateBudget",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FOculusXRSceneActorPopulateBudgetTest::RunTest(const FString& Parameters)
+{
+	UWorld* World = UWorld::CreateWorld(EWorldType::Game, false);
+	AOculusXRSceneActor* SceneActor = World->SpawnActor<AOculusXRSceneActor>();
+	if (!TestNotNull(TEXT("Scene actor spawned"), SceneActor))
+	{
+		World->DestroyWorld(false);
+		return false;
+	}
+
+	TestEqual(TEXT("Populate budget is unbounded by default"), SceneActor->PopulateSceneTimeBudgetMs, 0.0f);
+
+	// Stands in for an anchor spawned from an earlier batch
+	USceneComponent* SpawnedAnchor = NewObject<USceneComponent>(SceneActor);
+	SpawnedAnchor->SetupAttachment(SceneActor->GetRootComponent());
+	SpawnedAnchor->RegisterComponent();
+	TestTrue(TEXT("Populated with nothing pending"), SceneActor->IsScenePopulated());
+
+	// Anchors without a plane, volume or mesh component spawn nothing, which keeps the test off the runtime
+	const int32 NumPendingAnchors = 64;
+	auto QueuePendingAnchors = [SceneActor, NumPendingAnchors]() {
+		SceneActor->PendingSceneAnchors.SetNum(NumPendingAnchors);
+		SceneActor->NextPendingSceneAnchor = 0;
+	};
+
+	QueuePendingAnchors();
+	TestFalse(TEXT("Not populated while anchors are pending"), SceneActor->IsScenePopulated());
+
+	SceneActor->ProcessPendingSceneAnchors();
+	TestTrue(TEXT("Unbounded budget drains every anchor at once"), SceneActor->PendingSceneAnchors.IsEmpty());
+	TestTrue(TEXT("Populated after an unbounded pass"), SceneActor->IsScenePopulated());
+	TestFalse(TEXT("Tick disabled after an unbounded pass"), SceneActor->IsActorTickEnabled());
+
+	// The smallest budget still spawns one anchor per pass, and the scene only counts as populated after the last one
+	SceneActor->PopulateSceneTimeBudgetMs = UE_SMALL_NUMBER;
+	QueuePendingAnchors();
+
+	int32 NumPasses = 0;
+	while (!SceneActor->PendingSceneAnchors.IsEmpty() && NumPasses < NumPendingAnchors)
+	{
+		const int32 NextBefore = SceneActor->NextPendingSceneAnchor;
+		SceneActor->ProcessPendingSceneAnchors();
+		++NumPasses;
+
+		if (SceneActor->PendingSceneAnchors.IsEmpty())
+		{
+			break;
+		}
+
+		TestTrue(TEXT("Budgeted pass makes progress"), SceneActor->NextPendingSceneAnchor > NextBefore);
+		TestFalse(TEXT("Not populated between budgeted passes"), SceneActor->IsScenePopulated());
+		TestTrue(TEXT("Tick enabled between budgeted passes"), SceneActor->IsActorTickEnabled());
+	}
+
+	TestTrue(TEXT("Budgeted passes drain every anchor"), SceneActor->PendingSceneAnchors.IsEmpty());
+	TestTrue(TEXT("Populated after the last budgeted pass"), SceneActor->IsScenePopulated());
+	TestFalse(TEXT("Tick disabled after the last budgeted pass"), SceneActor->IsActorTickEnabled());
+
+	World->DestroyWorld(false);
+	World->MarkAsGarbage();
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -9,6 +9,7 @@
 #include "OculusXRHMDPrivate.h"
 #include "OculusXRSceneDelegates.h"
 #include "OculusXRAnchorsUtil.h"
+#include "openxr/OculusXRAnchorMetadataCache.h"
 
 #define LOCTEXT_NAMESPACE "OculusXRScene"
 
@@ -23,6 +24,16 @@ namespace XRScene
 	PFN_xrGetSpaceTriangleMeshMETA xrGetSpaceTriangleMeshMETA = nullptr;
 	PFN_xrRequestBoundaryVisibilityMETA xrRequestBoundaryVisibilityMETA = nullptr;
 
+	static XRAnchors::FAnchorMetadataCache* GetAnchorMetadataCache()
+	{
+#if OCULUS_ANCHORS_SUPPORTED_PLATFORMS
+		FAnchorsXRPtr anchorsXR = FOculusXRAnchorsModule::Get().GetXrAnchors();
+		return anchorsXR.IsValid() ? &anchorsXR->GetMetadataCache() : nullptr;
+#else
+		return nullptr;
+#endif
+	}
+
 	FSceneXR::FSceneXR()
 		: bExtSceneEnabled(false)
 		, bExtSceneCaptureEnabled(false)
@@ -125,6 +136,12 @@ namespace XRScene
 					UE_LOG(LogOculusXRScene, Verbose, TEXT("[FSceneXR::OnEvent] XrEventDataSceneCaptureCompleteFB"));
 					UE_LOG(LogOculusXRScene, Verbose, TEXT("						Result: d"), event->result);
 
+					// Labels and bounds read before the capture may be stale now
+					if (XRAnchors::FAnchorMetadataCache* metadataCache = GetAnchorMetadataCache())
+					{
+						metadataCache->InvalidateSceneData();
+					}
+
 					FOculusXRSceneEventDelegates::OculusSceneCaptureComplete.Broadcast(event->result, XR_SUCCEEDED(event->result));
 				}
 				break;
@@ -146,6 +163,15 @@ namespace XRScene
 			return XR_ERROR_VALIDATION_FAILURE;
 		}
 
+		XRAnchors::FAnchorMetadataCache* metadataCache = GetAnchorMetadataCache();
+		const XRAnchors::FAnchorMetadata* metadata = metadataCache ? metadataCache->Find(AnchorHandle) : nullptr;
+		if (metadata != nullptr && metadata->PlaneBounds.IsSet())
+		{
+			OutPos = metadata->PlaneBounds->Key;
+			OutSize = metadata->PlaneBounds->Value;
+			return XR_SUCCESS;
+		}
+
 		XrRect2Df rect;
 		auto result = xrGetSpaceBoundingBox2DFB(OpenXRHMD->GetSession(), (XrSpace)AnchorHandle, &rect);
 		if (XR_FAILED(result))
@@ -162,6 +188,11 @@ namespace XRScene
 		OutSize.Y = rect.extent.width;
 		OutSize.Z = rect.extent.height;
 
+		if (metadataCache != nullptr)
+		{
+			metadataCache->FindOrAdd(AnchorHandle).PlaneBounds.Emplace(OutPos, OutSize);
+		}
+
 		return result;
 	}
 
@@ -179,6 +210,15 @@ namespace XRScene
 			return XR_ERROR_VALIDATION_FAILURE;
 		}
 
+		XRAnchors::FAnchorMetadataCache* metadataCache = GetAnchorMetadataCache();
+		const XRAnchors::FAnchorMetadata* metadata = metadataCache ? metadataCache->Find(AnchorHandle) : nullptr;
+		if (metadata != nullptr && metadata->VolumeBounds.IsSet())
+		{
+			OutPos = metadata->VolumeBounds->Key;
+			OutSize = metadata->VolumeBounds->Value;
+			return XR_SUCCESS;
+		}
+
 		XrRect3DfFB rect;
 		auto result = xrGetSpaceBoundingBox3DFB(OpenXRHMD->GetSession(), (XrSpace)AnchorHandle, &rect);
 		if (XR_FAILED(result))
@@ -209,6 +249,11 @@ namespace XRScene
 		OutSize.Y = rect.extent.width;
 		OutSize.Z = rect.extent.height;
 
+		if (metadataCache != nullptr)
+		{
+			metadataCache->FindOrAdd(AnchorHandle).VolumeBounds.Emplace(OutPos, OutSize);
+		}
+
 		return result;
 	}
 
@@ -273,6 +318,14 @@ namespace XRScene
 			return XR_ERROR_VALIDATION_FAILURE;
 		}
 
+		XRAnchors::FAnchorMetadataCache* metadataCache = GetAnchorMetadataCache();
+		const XRAnchors::FAnchorMetadata* metadata = metadataCache ? metadataCache->Find(AnchorHandle) : nullptr;
+		if (metadata != nullptr && metadata->SemanticLabels.IsSet())
+		{
+			OutSemanticClassifications = metadata->SemanticLabels.GetValue();
+			return XR_SUCCESS;
+		}
+
 		static const char* recognizedLabels = "DESK,COUCH,FLOOR,CEILING,WALL_FACE,WINDOW_FRAME,DOOR_FRAME,STORAGE,BED,SCREEN,LAMP,PLANT,OTHER,TABLE,WALL_ART,INVISIBLE_WALL_FACE,GLOBAL_MESH"
 			;
 
@@ -310,6 +363,11 @@ namespace XRScene
 		FString labelsStr(xrLabels.bufferCountOutput, xrLabels.buffer);
 		labelsStr.ParseIntoArray(OutSemanticClassifications, TEXT(","));
 
+		if (metadataCache != nullptr)
+		{
+			metadataCache->FindOrAdd(AnchorHandle).SemanticLabels = OutSemanticClassifications;
+		}
+
 		return result;
 	}
 
@@ -48,6 +48,20 @@ struct OCULUSXRSCENE_API FOculusXRSpawnedSceneAnchorProperties
 	FVector AddOffset = FVector::ZeroVector;
 };
 
+/** FOculusXRPendingSceneAnchor
+ * Component status and semantic labels of a discovered scene anchor, fetched once when the anchor is discovered
+ * and kept until its actor is spawned.
+ */
+struct FOculusXRPendingSceneAnchor
+{
+	FOculusXRUInt64 Space;
+	FOculusXRUInt64 RoomSpaceID;
+	TArray<FString> SemanticClassifications;
+	bool bIsScenePlane = false;
+	bool bIsSceneVolume = false;
+	bool bIsTriangleMesh = false;
+};
+
 /**
  * AOculusXRSceneActor
  *
@@ -113,6 +127,12 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "OculusXR|Scene Actor")
 	bool bActiveRoomOnly = true;
 
+	// Time in milliseconds spent spawning scene anchors per frame while populating the scene. Anchors that don't fit in
+	// the budget are spawned on the following frames, and IsScenePopulated stays false until they are. 0 (the default)
+	// is unbounded and spawns all discovered anchors at once.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "OculusXR|Scene Actor", meta = (UIMin = 0, ClampMin = 0))
+	float PopulateSceneTimeBudgetMs = 0.0f;
+
 	UPROPERTY(EditAnywhere, Category = "OculusXR|Scene Actor")
 	TMap<FString, FOculusXRSpawnedSceneAnchorProperties> ScenePlaneSpawnedSceneAnchorProperties;
 
@@ -135,7 +155,9 @@ private:
 
 	EOculusXRAnchorResult::Type QueryRoomUUIDs(const FOculusXRUInt64 RoomSpaceID, const TArray<FOculusXRUUID>& RoomUUIDs);
 	void SceneRoomDiscoveryResultsAvailable(const TArray<FOculusXRAnchorsDiscoverResult>& QueryResults, const FOculusXRUInt64 RoomSpaceID);
-	void ProcessRoomElementsResult(FOculusXRUInt64 AnchorHandle, const FOculusXRUInt64 RoomSpaceID);
+	void FetchPendingSceneAnchor(FOculusXRUInt64 AnchorHandle, const FOculusXRUInt64 RoomSpaceID, FOculusXRPendingSceneAnchor& OutPendingAnchor) const;
+	void ProcessPendingSceneAnchors();
+	void ProcessRoomElementsResult(const FOculusXRPendingSceneAnchor& PendingAnchor);
 
 	void StartSingleRoomQuery(FOculusXRUInt64 RoomSpaceID, FOculusXRRoomLayout RoomLayout);
 	EOculusXRAnchorResult::Type QueryFloorForActiveRoom(FOculusXRUInt64 RoomSpaceID, FOculusXRRoomLayout RoomLayout);
@@ -162,6 +184,10 @@ private:
 	// Helper method to spawn an actor for anchor
 	AActor* SpawnActorWithSceneComponent(const FOculusXRUInt64& Space, const FOculusXRUInt64& RoomSpaceID, const TArray<FString>& SemanticClassifications, UClass* sceneAnchorComponentInstanceClass);
 
+	// Semantic label index helpers
+	static FName FindSemanticLabelId(const FString& SemanticLabel);
+	void AddToSemanticLabelIndex(AActor* Anchor, const TArray<FString>& SemanticClassifications);
+
 	// Spawns a scene anchor
 	AActor* SpawnOrUpdateSceneAnchor(AActor* Anchor, const FOculusXRUInt64& Space, const FOculusXRUInt64& RoomSpaceID, const FVector& BoundedPos, const FVector& BoundedSize, const TArray<FString>& SemanticClassifications, const EOculusXRSpaceComponentType AnchorComponentType);
 
@@ -181,4 +207,13 @@ private:
 
 	UPROPERTY(Transient)
 	TMap<FOculusXRUInt64, FOculusXRRoomLayout> RoomLayouts;
+
+	// Spawned scene anchor actors by semantic label, in spawn order
+	TMap<FName, TArray<TWeakObjectPtr<AActor>>> SemanticLabelIndex;
+
+	// Discovered scene anchors waiting to be spawned, PendingSceneAnchors[NextPendingSceneAnchor] is spawned next
+	TArray<FOculusXRPendingSceneAnchor> PendingSceneAnchors;
+	int32 NextPendingSceneAnchor = 0;
+
+	friend class FOculusXRSceneActorPopulateBudgetTest;
 };
@@ -3,6 +3,7 @@
 #include "OccluderMeshAssetUserData.h"
 #include "Engine/StaticMesh.h"
 #include "Misc/AssertionMacros.h"
+#include "Serialization/CustomVersion.h"
 #include "UObject/ObjectPtr.h"
 
 #include "SceneManagement.h"
@@ -12,12 +13,39 @@
 
 #if WITH_EDITOR
 #include "StaticMeshCompiler.h"
+#include "OccluderMeshGenerator.h"
 #endif // #if WITH_EDITOR
 
 DEFINE_LOG_CATEGORY(LogSofwareOcclusion);
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(OccluderMeshAssetUserData)
 
+#ifdef WITH_OCULUS_BRANCH
+const FGuid FOccluderMeshCustomVersion::GUID(0x6A3E1F52, 0x9C0B4D7E, 0xA2F38B14, 0x5D07C9E1);
+
+// Register the custom version with core
+FCustomVersionRegistration GRegisterOccluderMeshCustomVersion(FOccluderMeshCustomVersion::GUID, FOccluderMeshCustomVersion::LatestVersion, TEXT("OculusXROccluderMeshVer"));
+
+void SerializeOccluderIndices(FArchive& Ar, FOccluderIndexArray& Indices)
+{
+	Ar.UsingCustomVersion(FOccluderMeshCustomVersion::GUID);
+	if (Ar.IsLoading() && Ar.CustomVer(FOccluderMeshCustomVersion::GUID) < FOccluderMeshCustomVersion::ThirtyTwoBitIndices)
+	{
+		TArray<uint16> LegacyIndices;
+		LegacyIndices.BulkSerialize(Ar);
+
+		Indices.SetNumUninitialized(LegacyIndices.Num());
+		for (int32 i = 0; i < LegacyIndices.Num(); ++i)
+		{
+			Indices[i] = LegacyIndices[i];
+		}
+		return;
+	}
+
+	Indices.BulkSerialize(Ar);
+}
+#endif // WITH_OCULUS_BRANCH
+
 UOccluderMeshAssetUserData::UOccluderMeshAssetUserData(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 {
@@ -27,6 +55,8 @@ void UOccluderMeshAssetUserData::Serialize(FArchive& Ar)
 {
 	Super::Serialize(Ar);
 #ifdef WITH_OCULUS_BRANCH
+	Ar.UsingCustomVersion(FOccluderMeshCustomVersion::GUID);
+
 	bool bCooked = Ar.IsCooking();
 	Ar << bCooked;
 
@@ -51,7 +81,7 @@ void UOccluderMeshAssetUserData::Serialize(FArchive& Ar)
 		if (bHasOccluderData)
 		{
 			OccluderData->VerticesSP->BulkSerialize(Ar);
-			OccluderData->IndicesSP->BulkSerialize(Ar);
+			SerializeOccluderIndices(Ar, *OccluderData->IndicesSP);
 			Ar << OccluderData->OccluderMeshScale;
 			Ar << OccluderData->OccluderMeshOffset;
 		}
@@ -66,7 +96,7 @@ void UOccluderMeshAssetUserData::Serialize(FArchive& Ar)
 			SetOccluderData(MakeUnique<FStaticMeshOccluderData>());
 
 			OccluderData->VerticesSP->BulkSerialize(Ar);
-			OccluderData->IndicesSP->BulkSerialize(Ar);
+			SerializeOccluderIndices(Ar, *OccluderData->IndicesSP);
 			Ar << OccluderData->OccluderMeshScale;
 			Ar << OccluderData->OccluderMeshOffset;
 		}
@@ -112,6 +142,14 @@ void UOccluderMeshAssetUserData::PostEditChangeProperty(struct FPropertyChangedE
 			UE_LOG(LogSofwareOcclusion, Error, TEXT("LODForOccluderMesh CANNOT be used for SkeletalMesh."));
 			LODForOccluderMesh = -1;
 		}
+
+		if (Cast<USkeletalMesh>(GetOuter())
+			&& PropertyChangedEvent.GetPropertyName() == GET_MEMBER_NAME_CHECKED(UOccluderMeshAssetUserData, bGenerateOccluderMesh)
+			&& bGenerateOccluderMesh)
+		{
+			UE_LOG(LogSofwareOcclusion, Error, TEXT("bGenerateOccluderMesh CANNOT be used for SkeletalMesh."));
+			bGenerateOccluderMesh = false;
+		}
 	}
 
 	Super::PostEditChangeProperty(PropertyChangedEvent);
@@ -128,7 +166,15 @@ void UOccluderMeshAssetUserData::BuildOccluderData()
 	// Add logic to build;
 	// Conditionally create occluder data
 	const FStaticMeshLODResources* LODModel = nullptr;
-	if (LODForOccluderMesh >= 0 && Cast<UStaticMesh>(GetOuter()))
+	if (bGenerateOccluderMesh && LODForOccluderMesh < 0 && !CustomOccluderMesh && Cast<UStaticMesh>(GetOuter()))
+	{
+		UStaticMesh* Owner = Cast<UStaticMesh>(GetOuter());
+
+		int32 LODIndex = FMath::Clamp(GeneratedOccluderSourceLOD, 0, Owner->GetRenderData()->LODResources.Num() - 1);
+		LODModel = &Owner->GetRenderData()->LODResources[LODIndex];
+		SetOccluderData(BuildGenerated(LODModel));
+	}
+	else if (LODForOccluderMesh >= 0 && Cast<UStaticMesh>(GetOuter()))
 	{
 		UStaticMesh* Owner = Cast<UStaticMesh>(GetOuter());
 
@@ -165,26 +211,24 @@ TUniquePtr<FStaticMeshOccluderData> UOccluderMeshAssetUserData::Build(const FSta
 	int32 NumVtx = LODModel->VertexBuffers.PositionVertexBuffer.GetNumVertices();
 	int32 NumIndices = IndexBuffer.GetNumIndices();
 
-	if (NumVtx > 0 && NumIndices > 0 && !IndexBuffer.Is32Bit())
+	if (NumVtx > 0 && NumIndices > 0)
 	{
 		Result = MakeUnique<FStaticMeshOccluderData>();
 
 		Result->VerticesSP->SetNumUninitialized(NumVtx);
 		Result->IndicesSP->SetNumUninitialized(NumIndices);
 
-		FVector V0 = (FVector)(LODModel->VertexBuffers.PositionVertexBuffer.VertexPosition(0));
-		const uint16* Indices = IndexBuffer.AccessStream16();
-
 		for (int i = 0; i < NumVtx; ++i)
 		{
 			FVector Elem = FVector(LODModel->VertexBuffers.PositionVertexBuffer.VertexPosition(i));
 			Result->VerticesSP->GetData()[i] = Elem;
 		}
 
+		// Array view handles both 16 and 32 bit index buffers
+		const FIndexArrayView Indices = IndexBuffer.GetArrayView();
 		for (int i = 0; i < NumIndices; ++i)
 		{
-			uint16 Elem = IndexBuffer.AccessStream16()[i];
-			Result->IndicesSP->GetData()[i] = Elem;
+			Result->IndicesSP->GetData()[i] = Indices[i];
 		}
 
 		if (CustomOccluderMesh)
@@ -197,6 +241,35 @@ TUniquePtr<FStaticMeshOccluderData> UOccluderMeshAssetUserData::Build(const FSta
 	return Result;
 }
 
+TUniquePtr<FStaticMeshOccluderData> UOccluderMeshAssetUserData::BuildGenerated(const FStaticMeshLODResources* LODModel)
+{
+	TUniquePtr<FStaticMeshOccluderData> Result;
+#if WITH_EDITOR
+	TUniquePtr<FStaticMeshOccluderData> Source = Build(LODModel);
+	if (!Source)
+	{
+		return Result;
+	}
+
+	FOccluderMeshGeneratorSettings Settings;
+	Settings.VoxelResolution = GeneratedOccluderVoxelResolution;
+	Settings.TriangleBudget = GeneratedOccluderTriangleBudget;
+
+	Result = MakeUnique<FStaticMeshOccluderData>();
+	if (FOccluderMeshGenerator::Generate(*Source->VerticesSP, *Source->IndicesSP, Settings, *Result->VerticesSP, *Result->IndicesSP))
+	{
+		UE_LOG(LogSofwareOcclusion, Log, TEXT("Generated occluder mesh for %s: %d triangles from %d source triangles."),
+			*GetOuter()->GetName(), Result->IndicesSP->Num() / 3, Source->IndicesSP->Num() / 3);
+	}
+	else
+	{
+		UE_LOG(LogSofwareOcclusion, Warning, TEXT("Failed to generate occluder mesh for %s, make sure the source LOD is watertight."), *GetOuter()->GetName());
+		Result.Reset();
+	}
+#endif // WITH_EDITOR
+	return Result;
+}
+
 bool UOccluderMeshAssetUserData::IsOwnerSupported()
 {
 	return (Cast<UStaticMesh>(GetOuter()) || Cast<USkeletalMesh>(GetOuter()));
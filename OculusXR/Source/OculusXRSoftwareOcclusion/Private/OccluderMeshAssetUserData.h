@@ -21,7 +21,7 @@ class UStaticMesh;
 
 /**
  * This AssertUserData is used to hold both LODForOccluderMesh and CustomOccluderMesh for UStaticMeshes or USkeletalMeshes.
- * Note that LODForOccluderMesh and CustomOccluderMesh are exclusive.
+ * Note that LODForOccluderMesh, CustomOccluderMesh and bGenerateOccluderMesh are exclusive.
  */
 UCLASS()
 class UOccluderMeshAssetUserData : public UAssetUserData
@@ -58,6 +58,32 @@ public:
 	UPROPERTY(EditAnywhere, Category = "LOD", AdvancedDisplay, meta = (DisplayName = "Parent StaticMesh LOD For Occluder Mesh"))
 	int32 LODForOccluderMesh = -1;
 
+	/**
+	 *	Automatically generates a conservative, simplified occluder mesh from the parent static mesh. Not suitable for skeletal meshes.
+	 *  The source mesh should be watertight, otherwise no occluder is generated.
+	 *  Mutually exclusive with LODForOccluderMesh and CustomOccluderMesh
+	 */
+	UPROPERTY(EditAnywhere, Category = "GeneratedOccluder", meta = (DisplayName = "Generate Occluder Mesh", EditCondition = "LODForOccluderMesh < 0 && CustomOccluderMesh == nullptr"))
+	bool bGenerateOccluderMesh = false;
+
+	/**
+	 *	Specifies which parent staticmesh LOD the occluder mesh is generated from
+	 */
+	UPROPERTY(EditAnywhere, Category = "GeneratedOccluder", meta = (DisplayName = "Source LOD", ClampMin = "0", EditCondition = "bGenerateOccluderMesh"))
+	int32 GeneratedOccluderSourceLOD = 0;
+
+	/**
+	 *	Maximum number of triangles of the generated occluder mesh
+	 */
+	UPROPERTY(EditAnywhere, Category = "GeneratedOccluder", meta = (DisplayName = "Triangle Budget", ClampMin = "12", EditCondition = "bGenerateOccluderMesh"))
+	int32 GeneratedOccluderTriangleBudget = 120;
+
+	/**
+	 *	Number of voxels along the longest side of the source mesh used for generation. Higher values fit the source more tightly.
+	 */
+	UPROPERTY(EditAnywhere, Category = "GeneratedOccluder", AdvancedDisplay, meta = (DisplayName = "Voxel Resolution", ClampMin = "4", ClampMax = "256", EditCondition = "bGenerateOccluderMesh"))
+	int32 GeneratedOccluderVoxelResolution = 32;
+
 	//~ Begin UAssetUserData
 	virtual void Serialize(FArchive& Ar) override;
 
@@ -85,6 +111,8 @@ private:
 
 	TUniquePtr<FStaticMeshOccluderData> Build(const FStaticMeshLODResources* LODModel);
 
+	TUniquePtr<FStaticMeshOccluderData> BuildGenerated(const FStaticMeshLODResources* LODModel);
+
 	TUniquePtr<class FStaticMeshOccluderData> OccluderData;
 #endif // WITH_OCULUS_BRANCH
 };
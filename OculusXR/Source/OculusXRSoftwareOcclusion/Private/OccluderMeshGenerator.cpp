@@ -0,0 +1,466 @@
+// Copyright (c) Meta Platforms, Inc. and affiliates.
+
+#include "OccluderMeshGenerator.h"
+#include "OccluderMeshAssetUserData.h"
+
+#ifdef WITH_OCULUS_BRANCH
+#if WITH_EDITOR
+
+namespace OccluderMeshGenerator
+{
+	namespace EVoxelState
+	{
+		const uint8 Empty = 0;	  // Not touched by the surface and not reachable from outside, i.e. interior after flood fill
+		const uint8 Surface = 1;  // Overlaps at least one source triangle
+		const uint8 Exterior = 2; // Reachable from the padding border without crossing the surface
+	} // namespace EVoxelState
+
+	struct FVoxelGrid
+	{
+		FVector Origin;
+		double VoxelSize;
+		int32 Dims[3];
+		TArray<uint8> States;
+
+		int32 Index(int32 X, int32 Y, int32 Z) const
+		{
+			return X + Dims[0] * (Y + Dims[1] * Z);
+		}
+
+		FVector VoxelMin(int32 X, int32 Y, int32 Z) const
+		{
+			return Origin + FVector(X, Y, Z) * VoxelSize;
+		}
+	};
+
+	struct FVoxelBox
+	{
+		int32 Min[3];
+		int32 Max[3]; // inclusive
+		int32 NumVoxels;
+	};
+
+	// Separating axis test between a triangle and an axis aligned box centered at the origin (Akenine-Moller)
+	static bool TriangleBoxOverlap(const FVector& HalfSize, const FVector (&V)[3])
+	{
+		// Box face normals
+		for (int32 Axis = 0; Axis < 3; ++Axis)
+		{
+			const double Min = FMath::Min3(V[0][Axis], V[1][Axis], V[2][Axis]);
+			const double Max = FMath::Max3(V[0][Axis], V[1][Axis], V[2][Axis]);
+			if (Min > HalfSize[Axis] || Max < -HalfSize[Axis])
+			{
+				return false;
+			}
+		}
+
+		// Triangle plane
+		const FVector Edges[3] = { V[1] - V[0], V[2] - V[1], V[0] - V[2] };
+		const FVector Normal = FVector::CrossProduct(Edges[0], Edges[1]);
+		const double PlaneDist = FVector::DotProduct(Normal, V[0]);
+		const double PlaneRadius = HalfSize.X * FMath::Abs(Normal.X) + HalfSize.Y * FMath::Abs(Normal.Y) + HalfSize.Z * FMath::Abs(Normal.Z);
+		if (FMath::Abs(PlaneDist) > PlaneRadius)
+		{
+			return false;
+		}
+
+		// Cross products of triangle edges and box axes
+		for (const FVector& Edge : Edges)
+		{
+			for (int32 Axis = 0; Axis < 3; ++Axis)
+			{
+				FVector BoxAxis = FVector::ZeroVector;
+				BoxAxis[Axis] = 1.0;
+
+				const FVector TestAxis = FVector::CrossProduct(BoxAxis, Edge);
+				if (TestAxis.IsNearlyZero(UE_DOUBLE_SMALL_NUMBER))
+				{
+					continue;
+				}
+
+				const double P0 = FVector::DotProduct(TestAxis, V[0]);
+				const double P1 = FVector::DotProduct(TestAxis, V[1]);
+				const double P2 = FVector::DotProduct(TestAxis, V[2]);
+				const double Radius = HalfSize.X * FMath::Abs(TestAxis.X) + HalfSize.Y * FMath::Abs(TestAxis.Y) + HalfSize.Z * FMath::Abs(TestAxis.Z);
+				if (FMath::Min3(P0, P1, P2) > Radius || FMath::Max3(P0, P1, P2) < -Radius)
+				{
+					return false;
+				}
+			}
+		}
+
+		return true;
+	}
+
+	static void VoxelizeSurface(const TArray<FVector>& Vertices, const TArray<uint32>& Indices, FVoxelGrid& Grid)
+	{
+		// Slightly inflate voxels so triangles lying exactly on a voxel face mark both neighbours
+		const FVector HalfSize = FVector(Grid.VoxelSize * 0.5 * 1.001);
+
+		const int32 NumTris = Indices.Num() / 3;
+		for (int32 TriIdx = 0; TriIdx < NumTris; ++TriIdx)
+		{
+			const FVector& A = Vertices[Indices[TriIdx * 3 + 0]];
+			const FVector& B = Vertices[Indices[TriIdx * 3 + 1]];
+			const FVector& C = Vertices[Indices[TriIdx * 3 + 2]];
+
+			int32 Lo[3], Hi[3];
+			for (int32 Axis = 0; Axis < 3; ++Axis)
+			{
+				const double Min = FMath::Min3(A[Axis], B[Axis], C[Axis]) - Grid.Origin[Axis];
+				const double Max = FMath::Max3(A[Axis], B[Axis], C[Axis]) - Grid.Origin[Axis];
+				Lo[Axis] = FMath::Clamp(FMath::FloorToInt32(Min / Grid.VoxelSize) - 1, 0, Grid.Dims[Axis] - 1);
+				Hi[Axis] = FMath::Clamp(FMath::FloorToInt32(Max / Grid.VoxelSize) + 1, 0, Grid.Dims[Axis] - 1);
+			}
+
+			for (int32 Z = Lo[2]; Z <= Hi[2]; ++Z)
+			{
+				for (int32 Y = Lo[1]; Y <= Hi[1]; ++Y)
+				{
+					for (int32 X = Lo[0]; X <= Hi[0]; ++X)
+					{
+						uint8& State = Grid.States[Grid.Index(X, Y, Z)];
+						if (State == EVoxelState::Surface)
+						{
+							continue;
+						}
+
+						const FVector Center = Grid.VoxelMin(X, Y, Z) + FVector(Grid.VoxelSize * 0.5);
+						const FVector Local[3] = { A - Center, B - Center, C - Center };
+						if (TriangleBoxOverlap(HalfSize, Local))
+						{
+							State = EVoxelState::Surface;
+						}
+					}
+				}
+			}
+		}
+	}
+
+	static void FloodFillExterior(FVoxelGrid& Grid)
+	{
+		// Voxel 0 is in the outer padding layer and therefore never touches the surface
+		TArray<int32> Queue;
+		Queue.Reserve(Grid.States.Num() / 4);
+		Queue.Add(0);
+		Grid.States[0] = EVoxelState::Exterior;
+
+		const int32 StrideY = Grid.Dims[0];
+		const int32 StrideZ = Grid.Dims[0] * Grid.Dims[1];
+
+		for (int32 Head = 0; Head < Queue.Num(); ++Head)
+		{
+			const int32 Current = Queue[Head];
+			const int32 X = Current % Grid.Dims[0];
+			const int32 Y = (Current / StrideY) % Grid.Dims[1];
+			const int32 Z = Current / StrideZ;
+
+			auto Visit = [&Grid, &Queue](int32 Neighbour) {
+				if (Grid.States[Neighbour] == EVoxelState::Empty)
+				{
+					Grid.States[Neighbour] = EVoxelState::Exterior;
+					Queue.Add(Neighbour);
+				}
+			};
+
+			if (X > 0)
+				Visit(Current - 1);
+			if (X < Grid.Dims[0] - 1)
+				Visit(Current + 1);
+			if (Y > 0)
+				Visit(Current - StrideY);
+			if (Y < Grid.Dims[1] - 1)
+				Visit(Current + StrideY);
+			if (Z > 0)
+				Visit(Current - StrideZ);
+			if (Z < Grid.Dims[2] - 1)
+				Visit(Current + StrideZ);
+		}
+	}
+
+	static void MergeInteriorVoxels(const FVoxelGrid& Grid, TArray<FVoxelBox>& OutBoxes)
+	{
+		TBitArray<> Claimed(false, Grid.States.Num());
+
+		auto IsFree = [&Grid, &Claimed](int32 X, int32 Y, int32 Z) {
+			const int32 Index = Grid.Index(X, Y, Z);
+			return Grid.States[Index] == EVoxelState::Empty && !Claimed[Index];
+		};
+
+		for (int32 Z = 0; Z < Grid.Dims[2]; ++Z)
+		{
+			for (int32 Y = 0; Y < Grid.Dims[1]; ++Y)
+			{
+				for (int32 X = 0; X < Grid.Dims[0]; ++X)
+				{
+					if (!IsFree(X, Y, Z))
+					{
+						continue;
+					}
+
+					// Grow along X, then whole rows along Y, then whole slabs along Z
+					int32 X1 = X;
+					while (X1 + 1 < Grid.Dims[0] && IsFree(X1 + 1, Y, Z))
+					{
+						++X1;
+					}
+
+					int32 Y1 = Y;
+					for (bool bGrow = true; bGrow && Y1 + 1 < Grid.Dims[1];)
+					{
+						for (int32 IX = X; IX <= X1 && bGrow; ++IX)
+						{
+							bGrow = IsFree(IX, Y1 + 1, Z);
+						}
+						Y1 += bGrow ? 1 : 0;
+					}
+
+					int32 Z1 = Z;
+					for (bool bGrow = true; bGrow && Z1 + 1 < Grid.Dims[2];)
+					{
+						for (int32 IY = Y; IY <= Y1 && bGrow; ++IY)
+						{
+							for (int32 IX = X; IX <= X1 && bGrow; ++IX)
+							{
+								bGrow = IsFree(IX, IY, Z1 + 1);
+							}
+						}
+						Z1 += bGrow ? 1 : 0;
+					}
+
+					for (int32 IZ = Z; IZ <= Z1; ++IZ)
+					{
+						for (int32 IY = Y; IY <= Y1; ++IY)
+						{
+							for (int32 IX = X; IX <= X1; ++IX)
+							{
+								Claimed[Grid.Index(IX, IY, IZ)] = true;
+							}
+						}
+					}
+
+					FVoxelBox& Box = OutBoxes.AddDefaulted_GetRef();
+					Box.Min[0] = X;
+					Box.Min[1] = Y;
+					Box.Min[2] = Z;
+					Box.Max[0] = X1;
+					Box.Max[1] = Y1;
+					Box.Max[2] = Z1;
+					Box.NumVoxels = (X1 - X + 1) * (Y1 - Y + 1) * (Z1 - Z + 1);
+				}
+			}
+		}
+	}
+
+	/** Source mesh silhouette along one axis, sampled at voxel cell centers */
+	struct FSilhouette
+	{
+		int32 AxisU;
+		int32 AxisV;
+		TBitArray<> Covered;
+
+		void Build(const TArray<FVector>& Vertices, const TArray<uint32>& Indices, const FVoxelGrid& Grid, int32 Axis)
+		{
+			AxisU = (Axis + 1) % 3;
+			AxisV = (Axis + 2) % 3;
+			const int32 DimU = Grid.Dims[AxisU];
+			const int32 DimV = Grid.Dims[AxisV];
+			Covered.Init(false, DimU * DimV);
+
+			const int32 NumTris = Indices.Num() / 3;
+			for (int32 TriIdx = 0; TriIdx < NumTris; ++TriIdx)
+			{
+				FVector2D P[3];
+				for (int32 i = 0; i < 3; ++i)
+				{
+					const FVector& V = Vertices[Indices[TriIdx * 3 + i]];
+					P[i] = FVector2D((V[AxisU] - Grid.Origin[AxisU]) / Grid.VoxelSize, (V[AxisV] - Grid.Origin[AxisV]) / Grid.VoxelSize);
+				}
+
+				const double Area = FVector2D::CrossProduct(P[1] - P[0], P[2] - P[0]);
+				if (FMath::IsNearlyZero(Area, UE_DOUBLE_KINDA_SMALL_NUMBER))
+				{
+					// Edge-on triangles do not contribute to the silhouette
+					continue;
+				}
+
+				const int32 U0 = FMath::Clamp(FMath::FloorToInt32(FMath::Min3(P[0].X, P[1].X, P[2].X)), 0, DimU - 1);
+				const int32 U1 = FMath::Clamp(FMath::CeilToInt32(FMath::Max3(P[0].X, P[1].X, P[2].X)), 0, DimU - 1);
+				const int32 V0 = FMath::Clamp(FMath::FloorToInt32(FMath::Min3(P[0].Y, P[1].Y, P[2].Y)), 0, DimV - 1);
+				const int32 V1 = FMath::Clamp(FMath::CeilToInt32(FMath::Max3(P[0].Y, P[1].Y, P[2].Y)), 0, DimV - 1);
+
+				for (int32 V = V0; V <= V1; ++V)
+				{
+					for (int32 U = U0; U <= U1; ++U)
+					{
+						const FVector2D Sample(U + 0.5, V + 0.5);
+						const double E0 = FVector2D::CrossProduct(P[1] - P[0], Sample - P[0]);
+						const double E1 = FVector2D::CrossProduct(P[2] - P[1], Sample - P[1]);
+						const double E2 = FVector2D::CrossProduct(P[0] - P[2], Sample - P[2]);
+						const bool bInside = Area > 0.0 ? (E0 >= 0.0 && E1 >= 0.0 && E2 >= 0.0) : (E0 <= 0.0 && E1 <= 0.0 && E2 <= 0.0);
+						if (bInside)
+						{
+							Covered[U + V * DimU] = true;
+						}
+					}
+				}
+			}
+		}
+
+		bool Contains(const FVoxelBox& Box, const FVoxelGrid& Grid) const
+		{
+			const int32 DimU = Grid.Dims[AxisU];
+			for (int32 V = Box.Min[AxisV]; V <= Box.Max[AxisV]; ++V)
+			{
+				for (int32 U = Box.Min[AxisU]; U <= Box.Max[AxisU]; ++U)
+				{
+					if (!Covered[U + V * DimU])
+					{
+						return false;
+					}
+				}
+			}
+			return true;
+		}
+	};
+
+	static void EmitBox(const FVector& Min, const FVector& Max, bool bFlipWinding, TArray<FVector>& OutVertices, TArray<uint32>& OutIndices)
+	{
+		const uint32 BaseVertex = OutVertices.Num();
+		for (int32 Corner = 0; Corner < 8; ++Corner)
+		{
+			OutVertices.Add(FVector(
+				(Corner & 1) ? Max.X : Min.X,
+				(Corner & 2) ? Max.Y : Min.Y,
+				(Corner & 4) ? Max.Z : Min.Z));
+		}
+
+		for (int32 Axis = 0; Axis < 3; ++Axis)
+		{
+			const int32 AxisBit = 1 << Axis;
+			const int32 UBit = 1 << ((Axis + 1) % 3);
+			const int32 VBit = 1 << ((Axis + 2) % 3);
+
+			for (int32 Side = 0; Side < 2; ++Side)
+			{
+				const int32 SideBits = Side ? AxisBit : 0;
+				uint32 Quad[4] = {
+					BaseVertex + SideBits,
+					BaseVertex + (SideBits | UBit),
+					BaseVertex + (SideBits | UBit | VBit),
+					BaseVertex + (SideBits | VBit)
+				};
+
+				// Match the winding convention of the source mesh so backface culling keeps the outer faces
+				const FVector Normal = FVector::CrossProduct(OutVertices[Quad[1]] - OutVertices[Quad[0]], OutVertices[Quad[2]] - OutVertices[Quad[0]]);
+				const bool bFacesOut = (Normal[Axis] > 0.0) == (Side == 1);
+				if (bFacesOut == bFlipWinding)
+				{
+					Swap(Quad[1], Quad[3]);
+				}
+
+				OutIndices.Append({ Quad[0], Quad[1], Quad[2], Quad[0], Quad[2], Quad[3] });
+			}
+		}
+	}
+} // namespace OccluderMeshGenerator
+
+bool FOccluderMeshGenerator::Generate(
+	const TArray<FVector>& SourceVertices,
+	const TArray<uint32>& SourceIndices,
+	const FOccluderMeshGeneratorSettings& Settings,
+	TArray<FVector>& OutVertices,
+	TArray<uint32>& OutIndices)
+{
+	using namespace OccluderMeshGenerator;
+
+	OutVertices.Reset();
+	OutIndices.Reset();
+
+	if (SourceVertices.Num() < 4 || SourceIndices.Num() < 12)
+	{
+		return false;
+	}
+
+	const FBox Bounds(SourceVertices);
+	const double MaxExtent = Bounds.GetSize().GetMax();
+	if (!Bounds.IsValid || MaxExtent <= UE_DOUBLE_KINDA_SMALL_NUMBER)
+	{
+		return false;
+	}
+
+	const int32 Resolution = FMath::Clamp(Settings.VoxelResolution, 4, 256);
+
+	// Two voxels of padding on every side keep the outermost layer clear of the (inflated) surface voxels,
+	// so the exterior stays connected for the flood fill even when faces lie exactly on the bounds
+	FVoxelGrid Grid;
+	Grid.VoxelSize = MaxExtent / Resolution;
+	Grid.Origin = Bounds.Min - FVector(Grid.VoxelSize * 2.0);
+	for (int32 Axis = 0; Axis < 3; ++Axis)
+	{
+		Grid.Dims[Axis] = FMath::Clamp(FMath::CeilToInt32(Bounds.GetSize()[Axis] / Grid.VoxelSize), 1, Resolution) + 4;
+	}
+	Grid.States.SetNumZeroed(Grid.Dims[0] * Grid.Dims[1] * Grid.Dims[2]);
+
+	VoxelizeSurface(SourceVertices, SourceIndices, Grid);
+	FloodFillExterior(Grid);
+
+	TArray<FVoxelBox> Boxes;
+	MergeInteriorVoxels(Grid, Boxes);
+	if (Boxes.Num() == 0)
+	{
+		UE_LOG(LogSofwareOcclusion, Verbose, TEXT("Occluder generation found no interior voxels, source mesh is likely not watertight."));
+		return false;
+	}
+
+	Boxes.Sort([](const FVoxelBox& A, const FVoxelBox& B) {
+		return A.NumVoxels > B.NumVoxels;
+	});
+
+	FSilhouette Silhouettes[3];
+	for (int32 Axis = 0; Axis < 3; ++Axis)
+	{
+		Silhouettes[Axis].Build(SourceVertices, SourceIndices, Grid, Axis);
+	}
+
+	// Signed volume tells us whether the source uses outward facing CW or CCW triangles
+	double SignedVolume = 0.0;
+	for (int32 i = 0; i + 2 < SourceIndices.Num(); i += 3)
+	{
+		const FVector A = SourceVertices[SourceIndices[i + 0]] - Bounds.Min;
+		const FVector B = SourceVertices[SourceIndices[i + 1]] - Bounds.Min;
+		const FVector C = SourceVertices[SourceIndices[i + 2]] - Bounds.Min;
+		SignedVolume += FVector::DotProduct(A, FVector::CrossProduct(B, C));
+	}
+	const bool bFlipWinding = SignedVolume < 0.0;
+
+	const int32 MaxBoxes = FMath::Max(1, Settings.TriangleBudget / 12);
+	int32 NumRejected = 0;
+	for (const FVoxelBox& Box : Boxes)
+	{
+		if (OutIndices.Num() / 36 >= MaxBoxes)
+		{
+			break;
+		}
+
+		if (!Silhouettes[0].Contains(Box, Grid) || !Silhouettes[1].Contains(Box, Grid) || !Silhouettes[2].Contains(Box, Grid))
+		{
+			NumRejected++;
+			continue;
+		}
+
+		const FVector Min = Grid.VoxelMin(Box.Min[0], Box.Min[1], Box.Min[2]);
+		const FVector Max = Grid.VoxelMin(Box.Max[0] + 1, Box.Max[1] + 1, Box.Max[2] + 1);
+		EmitBox(Min, Max, bFlipWinding, OutVertices, OutIndices);
+	}
+
+	if (NumRejected > 0)
+	{
+		UE_LOG(LogSofwareOcclusion, Warning, TEXT("Occluder generation rejected %d boxes outside the source silhouette."), NumRejected);
+	}
+
+	return OutIndices.Num() > 0;
+}
+
+#endif // WITH_EDITOR
+#endif // WITH_OCULUS_BRANCH
@@ -0,0 +1,47 @@
+// Copyright (c) Meta Platforms, Inc. and affiliates.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#ifdef WITH_OCULUS_BRANCH
+#if WITH_EDITOR
+
+/**
+ * Settings for automatic occluder mesh generation
+ */
+struct FOccluderMeshGeneratorSettings
+{
+	/** Number of voxels along the longest axis of the source mesh bounds */
+	int32 VoxelResolution = 32;
+
+	/** Maximum number of triangles in the generated occluder mesh (12 triangles per box) */
+	int32 TriangleBudget = 120;
+};
+
+/**
+ * Generates a conservative occluder mesh from arbitrary triangle soup.
+ *
+ * The source mesh is voxelized, voxels touching the surface are discarded and the exterior is flood filled,
+ * so the remaining voxels are strictly inside the mesh. Those voxels are greedily merged into boxes and the
+ * largest boxes are kept until the triangle budget is reached. Every kept box is validated against the
+ * silhouette of the source mesh projected along each axis, so the generated occluder never covers pixels
+ * the source mesh would not cover. Non-watertight source meshes generally produce no interior and yield an empty result.
+ */
+class FOccluderMeshGenerator
+{
+public:
+	/**
+	 * Builds the occluder geometry.
+	 * @return true if at least one box was generated
+	 */
+	static bool Generate(
+		const TArray<FVector>& SourceVertices,
+		const TArray<uint32>& SourceIndices,
+		const FOccluderMeshGeneratorSettings& Settings,
+		TArray<FVector>& OutVertices,
+		TArray<uint32>& OutIndices);
+};
+
+#endif // WITH_EDITOR
+#endif // WITH_OCULUS_BRANCH
@@ -0,0 +1,115 @@
+// Copyright (c) Meta Platforms, Inc. and affiliates.
+
+#include "SoftwareOcclusionBenchmarkCommandlet.h"
+#include "OccluderMeshAssetUserData.h"
+#include "SoftwareOcclusionRasterizer.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(SoftwareOcclusionBenchmarkCommandlet)
+
+UOculusXRSoftwareOcclusionBenchmarkCommandlet::UOculusXRSoftwareOcclusionBenchmarkCommandlet(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = false;
+	LogToConsole = true;
+}
+
+int32 UOculusXRSoftwareOcclusionBenchmarkCommandlet::Main(const FString& Params)
+{
+#ifdef WITH_OCULUS_BRANCH
+	FString ScenesParam;
+	if (!FParse::Value(*Params, TEXT("Scene="), ScenesParam, false))
+	{
+		UE_LOG(LogSofwareOcclusion, Error, TEXT("Missing -Scene=<file>[+<file>...], capture one with r.so.CaptureScene."));
+		return 1;
+	}
+
+	int32 Iterations = 100;
+	FParse::Value(*Params, TEXT("Iterations="), Iterations);
+	Iterations = FMath::Max(1, Iterations);
+
+	TArray<bool> SIMDModes = { true, false };
+	int32 SIMD = 0;
+	if (FParse::Value(*Params, TEXT("SIMD="), SIMD))
+	{
+		SIMDModes = { SIMD != 0 };
+	}
+
+	FString OutputFilename;
+	FParse::Value(*Params, TEXT("Output="), OutputFilename);
+
+	TArray<FString> SceneFilenames;
+	ScenesParam.ParseIntoArray(SceneFilenames, TEXT("+"));
+
+	FString Csv = TEXT("Scene,SIMD,Iterations,Occluders,Occludees,Triangles,Visible,ProcessOccluderMs,ProcessOccludeeMs,SortMs,RasterizeMs,TotalMs,MinTotalMs\n");
+	int32 Result = 0;
+
+	for (const FString& SceneFilename : SceneFilenames)
+	{
+		FOcclusionSceneData SceneData;
+		if (!SoftwareOcclusion::LoadSceneData(SceneData, SceneFilename))
+		{
+			UE_LOG(LogSofwareOcclusion, Error, TEXT("Failed to load software occlusion scene %s."), *SceneFilename);
+			Result = 1;
+			continue;
+		}
+
+		for (bool bUseSIMD : SIMDModes)
+		{
+			FOcclusionFrameStats Total;
+			double MinTotalTime = MAX_dbl;
+			int32 NumVisible = 0;
+
+			for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+			{
+				// MakeUnique value-initializes, which clears the framebuffer bins
+				TUniquePtr<FOcclusionFrameResults> Results = MakeUnique<FOcclusionFrameResults>();
+				FOcclusionFrameStats Stats;
+				SoftwareOcclusion::ProcessOcclusionFrame(SceneData, *Results, bUseSIMD, &Stats);
+
+				Total.ProcessOccluderTime += Stats.ProcessOccluderTime;
+				Total.ProcessOccludeeTime += Stats.ProcessOccludeeTime;
+				Total.SortTime += Stats.SortTime;
+				Total.RasterizeTime += Stats.RasterizeTime;
+				Total.NumTriangles = Stats.NumTriangles;
+				MinTotalTime = FMath::Min(MinTotalTime, Stats.ProcessOccluderTime + Stats.ProcessOccludeeTime + Stats.SortTime + Stats.RasterizeTime);
+
+				NumVisible = 0;
+				for (const TPair<FPrimitiveComponentId, bool>& Visibility : Results->VisibilityMap)
+				{
+					NumVisible += Visibility.Value ? 1 : 0;
+				}
+			}
+
+			const double ToAverageMs = 1000.0 / Iterations;
+			const double TotalMs = (Total.ProcessOccluderTime + Total.ProcessOccludeeTime + Total.SortTime + Total.RasterizeTime) * ToAverageMs;
+
+			UE_LOG(LogSofwareOcclusion, Display, TEXT("%s [%s] occluders %d, occludees %d, tris %d, visible %d: occluder %.3fms, occludee %.3fms, sort %.3fms, rasterize %.3fms, total %.3fms (min %.3fms)"),
+				*FPaths::GetCleanFilename(SceneFilename), bUseSIMD ? TEXT("SIMD") : TEXT("Scalar"),
+				SceneData.OccluderData.Num(), SceneData.OccludeeBoxPrimId.Num(), Total.NumTriangles, NumVisible,
+				Total.ProcessOccluderTime * ToAverageMs, Total.ProcessOccludeeTime * ToAverageMs, Total.SortTime * ToAverageMs, Total.RasterizeTime * ToAverageMs,
+				TotalMs, MinTotalTime * 1000.0);
+
+			Csv += FString::Printf(TEXT("%s,%d,%d,%d,%d,%d,%d,%.4f,%.4f,%.4f,%.4f,%.4f,%.4f\n"),
+				*FPaths::GetCleanFilename(SceneFilename), bUseSIMD ? 1 : 0, Iterations,
+				SceneData.OccluderData.Num(), SceneData.OccludeeBoxPrimId.Num(), Total.NumTriangles, NumVisible,
+				Total.ProcessOccluderTime * ToAverageMs, Total.ProcessOccludeeTime * ToAverageMs, Total.SortTime * ToAverageMs, Total.RasterizeTime * ToAverageMs,
+				TotalMs, MinTotalTime * 1000.0);
+		}
+	}
+
+	if (!OutputFilename.IsEmpty() && !FFileHelper::SaveStringToFile(Csv, *OutputFilename))
+	{
+		UE_LOG(LogSofwareOcclusion, Error, TEXT("Failed to write benchmark results to %s."), *OutputFilename);
+		Result = 1;
+	}
+
+	return Result;
+#else
+	UE_LOG(LogSofwareOcclusion, Error, TEXT("Software occlusion requires the Oculus engine branch."));
+	return 1;
+#endif // WITH_OCULUS_BRANCH
+}
@@ -0,0 +1,28 @@
+// Copyright (c) Meta Platforms, Inc. and affiliates.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+
+#include "SoftwareOcclusionBenchmarkCommandlet.generated.h"
+
+/**
+ * Replays occluder/occludee sets captured with r.so.CaptureScene through the software occlusion rasterizer
+ * and reports per stage timings, so r.so.* settings can be tuned and regressions caught without a device.
+ *
+ * Usage: -run=OculusXRSoftwareOcclusionBenchmark -Scene=<file>[+<file>...] [-Iterations=100] [-SIMD=0|1] [-Output=<file.csv>]
+ * Both SIMD and scalar paths are measured when -SIMD is not specified.
+ */
+UCLASS()
+class UOculusXRSoftwareOcclusionBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UOculusXRSoftwareOcclusionBenchmarkCommandlet(const FObjectInitializer& ObjectInitializer);
+
+	//~ Begin UCommandlet Interface
+	virtual int32 Main(const FString& Params) override;
+	//~ End UCommandlet Interface
+};
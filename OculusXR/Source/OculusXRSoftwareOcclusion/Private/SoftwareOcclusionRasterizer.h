@@ -0,0 +1,99 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#ifdef WITH_OCULUS_BRANCH
+
+#include "CoreMinimal.h"
+#include "SceneTypes.h"
+#include "StaticMeshOccluderData.h"
+
+/**
+ * Renderer independent core of the software occlusion: screen space binning and rasterization of occluder
+ * triangles and occludee boxes. Everything in here can be driven from an FOcclusionSceneData built by hand,
+ * which is what the automation tests and the benchmark commandlet do.
+ */
+
+DECLARE_STATS_GROUP(TEXT("Software Occlusion"), STATGROUP_SoftwareOcclusion, STATCAT_Advanced);
+
+static const int32 BIN_WIDTH = 64;
+static const int32 BIN_NUM = 6;
+static const int32 FRAMEBUFFER_WIDTH = BIN_WIDTH * BIN_NUM;
+static const int32 FRAMEBUFFER_HEIGHT = 256;
+
+struct FFramebufferBin
+{
+	uint64 Data[FRAMEBUFFER_HEIGHT];
+};
+
+struct FScreenPosition
+{
+	int32 X, Y;
+};
+
+struct FScreenTriangle
+{
+	FScreenPosition V[3];
+};
+
+struct FOcclusionFrameResults
+{
+	FFramebufferBin Bins[BIN_NUM];
+	TMap<FPrimitiveComponentId, bool> VisibilityMap;
+};
+
+struct FOcclusionMeshData
+{
+	FMatrix LocalToWorld;
+	FOccluderVertexArraySP VerticesSP;
+	FOccluderIndexArraySP IndicesSP;
+	FPrimitiveComponentId PrimId;
+};
+
+struct FOcclusionSceneData
+{
+	FMatrix ViewProj;
+	TArray<FVector> OccludeeBoxMinMax;
+	TArray<FPrimitiveComponentId> OccludeeBoxPrimId;
+	TArray<FOcclusionMeshData> OccluderData;
+	int32 NumOccluderTriangles;
+
+	friend FArchive& operator<<(FArchive& Ar, FOcclusionSceneData& SceneData);
+};
+
+/** Per stage timings of one processed frame, in seconds */
+struct FOcclusionFrameStats
+{
+	double ProcessOccluderTime = 0.0;
+	double ProcessOccludeeTime = 0.0;
+	double SortTime = 0.0;
+	double RasterizeTime = 0.0;
+	int32 NumTriangles = 0;
+	int32 NumRasterizedOccluderTris = 0;
+	int32 NumRasterizedOccludeeTris = 0;
+};
+
+namespace SoftwareOcclusion
+{
+	/** Rasterizes a Y-sorted occluder triangle into one bin */
+	void RasterizeOccluderTri(const FScreenTriangle& Tri, uint64* BinData, int32 BinMinX);
+
+	/** Tests an occludee quad against one bin, returns true if any of its pixels is not covered */
+	bool RasterizeOccludeeQuad(const FScreenTriangle& Tri, uint64* BinData, int32 BinMinX);
+
+	/** Projects occludee boxes (min/max pairs) to framebuffer quads: MinX, MinY, MaxX, MaxY per box */
+	void ProcessOccludeeGeomSIMD(const FMatrix& InMat, const FVector* InMinMax, int32 Num, int32* RESTRICT OutQuads, float* RESTRICT OutQuadDepth, int32* RESTRICT OutQuadClipped);
+	void ProcessOccludeeGeomScalar(const FMatrix& InMat, const FVector* InMinMax, int32 Num, int32* RESTRICT OutQuads, float* RESTRICT OutQuadDepth, int32* RESTRICT OutQuadClipped);
+
+	/** Clip space to framebuffer space transform */
+	const FMatrix& GetFramebufferMatrix();
+
+	/** Rasterizes all occluders and tests all occludees of the scene */
+	void ProcessOcclusionFrame(const FOcclusionSceneData& InSceneData, FOcclusionFrameResults& OutResults, bool bUseSIMD, FOcclusionFrameStats* OutStats = nullptr);
+
+	/** Saves/loads a captured occluder and occludee set */
+	bool SaveSceneData(FOcclusionSceneData& SceneData, const FString& Filename);
+	bool LoadSceneData(FOcclusionSceneData& OutSceneData, const FString& Filename);
+} // namespace SoftwareOcclusion
+
+#endif // WITH_OCULUS_BRANCH
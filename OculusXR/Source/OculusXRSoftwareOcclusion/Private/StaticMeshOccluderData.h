@@ -10,10 +10,40 @@
  * Convenience typedefs for a software occlusion mesh elements
  */
 typedef TArray<FVector> FOccluderVertexArray;
-typedef TArray<uint16> FOccluderIndexArray;
+typedef TArray<uint32> FOccluderIndexArray;
 typedef TSharedPtr<FOccluderVertexArray, ESPMode::ThreadSafe> FOccluderVertexArraySP;
 typedef TSharedPtr<FOccluderIndexArray, ESPMode::ThreadSafe> FOccluderIndexArraySP;
 
+/**
+ * Custom version of the occluder payload serialized by UOccluderMeshAssetUserData
+ */
+struct FOccluderMeshCustomVersion
+{
+	enum Type
+	{
+		// Occluder indices were 16 bit
+		BeforeCustomVersionWasAdded = 0,
+
+		// Occluder indices are 32 bit
+		ThirtyTwoBitIndices,
+
+		// -----<new versions can be added above this line>-------------------------------------------------
+		VersionPlusOne,
+		LatestVersion = VersionPlusOne - 1
+	};
+
+	// The GUID for this custom version number
+	static const FGuid GUID;
+
+private:
+	FOccluderMeshCustomVersion() {}
+};
+
+/**
+ * Serializes occluder indices, widening the 16-bit indices of payloads saved before FOccluderMeshCustomVersion::ThirtyTwoBitIndices
+ */
+void SerializeOccluderIndices(FArchive& Ar, FOccluderIndexArray& Indices);
+
 /**
  * This geometry is used to rasterize mesh for software occlusion
  * Generated only for if SoftwareOcclusion is supported
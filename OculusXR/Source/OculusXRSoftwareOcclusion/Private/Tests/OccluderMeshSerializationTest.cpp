@@ -0,0 +1,72 @@
+// Copyright (c) Meta Platforms, Inc. and affiliates.
+
+#include "Misc/AutomationTest.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "StaticMeshOccluderData.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+#ifdef WITH_OCULUS_BRANCH
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FOccluderMeshIndicesRoundTripTest,
+	"OculusXR.SoftwareOcclusion.Serialization.IndicesRoundTrip",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FOccluderMeshIndicesRoundTripTest::RunTest(const FString& Parameters)
+{
+	// Indices past the 16-bit range are what the 32-bit payload exists for
+	const FOccluderIndexArray SavedIndices({ 0, 1, 2, 65535, 65536, 100000 });
+
+	TArray<uint8> Bytes;
+	FMemoryWriter Writer(Bytes);
+	FOccluderIndexArray WrittenIndices = SavedIndices;
+	SerializeOccluderIndices(Writer, WrittenIndices);
+	TestEqual(TEXT("Saved with the latest version"), Writer.CustomVer(FOccluderMeshCustomVersion::GUID), int32(FOccluderMeshCustomVersion::LatestVersion));
+
+	FMemoryReader Reader(Bytes);
+	Reader.SetCustomVersions(Writer.GetCustomVersions());
+	FOccluderIndexArray LoadedIndices;
+	SerializeOccluderIndices(Reader, LoadedIndices);
+
+	TestFalse(TEXT("Round trip read without errors"), Reader.IsError());
+	TestEqual(TEXT("Round trip index count"), LoadedIndices.Num(), SavedIndices.Num());
+	TestTrue(TEXT("Round trip indices"), LoadedIndices == SavedIndices);
+	TestTrue(TEXT("Round trip consumed the payload"), Reader.AtEnd());
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FOccluderMeshLegacyIndicesTest,
+	"OculusXR.SoftwareOcclusion.Serialization.LegacyIndices",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FOccluderMeshLegacyIndicesTest::RunTest(const FString& Parameters)
+{
+	// Payload laid out as it was before the custom version, with 16-bit indices
+	TArray<uint16> LegacyIndices({ 0, 1, 2, 2, 3, 65535 });
+	TArray<uint8> Bytes;
+	FMemoryWriter Writer(Bytes);
+	LegacyIndices.BulkSerialize(Writer);
+
+	FMemoryReader Reader(Bytes);
+	Reader.SetCustomVersion(FOccluderMeshCustomVersion::GUID, FOccluderMeshCustomVersion::BeforeCustomVersionWasAdded, TEXT("OculusXROccluderMeshVer"));
+	FOccluderIndexArray LoadedIndices;
+	SerializeOccluderIndices(Reader, LoadedIndices);
+
+	TestFalse(TEXT("Legacy read without errors"), Reader.IsError());
+	if (TestEqual(TEXT("Legacy index count"), LoadedIndices.Num(), LegacyIndices.Num()))
+	{
+		for (int32 i = 0; i < LegacyIndices.Num(); ++i)
+		{
+			TestEqual(*FString::Printf(TEXT("Legacy index %d widened"), i), LoadedIndices[i], uint32(LegacyIndices[i]));
+		}
+	}
+	TestTrue(TEXT("Legacy read consumed the payload"), Reader.AtEnd());
+
+	return true;
+}
+
+#endif // WITH_OCULUS_BRANCH
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,364 @@
+// Copyright (c) Meta Platforms, Inc. and affiliates.
+
+#include "Misc/AutomationTest.h"
+#include "SoftwareOcclusionRasterizer.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+#ifdef WITH_OCULUS_BRANCH
+
+namespace SoftwareOcclusionTest
+{
+	static const float NearPlane = 10.0f;
+
+	// Camera at the origin looking down +X, same view space swizzle as FViewMatrices
+	static FMatrix MakeViewProj()
+	{
+		const FMatrix ViewMatrix(FPlane(0, 0, 1, 0), FPlane(1, 0, 0, 0), FPlane(0, 1, 0, 0), FPlane(0, 0, 0, 1));
+		const FMatrix ProjMatrix = FReversedZPerspectiveMatrix(UE_PI / 4.0f, FRAMEBUFFER_WIDTH, FRAMEBUFFER_HEIGHT, NearPlane);
+		return ViewMatrix * ProjMatrix;
+	}
+
+	static FPrimitiveComponentId MakePrimId(uint32 Value)
+	{
+		FPrimitiveComponentId PrimId;
+		PrimId.PrimIDValue = Value;
+		return PrimId;
+	}
+
+	static void InitScene(FOcclusionSceneData& Scene)
+	{
+		Scene.ViewProj = MakeViewProj();
+		Scene.NumOccluderTriangles = 0;
+	}
+
+	// Double sided quad, so the test does not depend on the backface convention
+	static void AddWall(FOcclusionSceneData& Scene, uint32 PrimId, const FVector& A, const FVector& B, const FVector& C, const FVector& D)
+	{
+		FOcclusionMeshData& Mesh = Scene.OccluderData.AddDefaulted_GetRef();
+		Mesh.LocalToWorld = FMatrix::Identity;
+		Mesh.PrimId = MakePrimId(PrimId);
+		Mesh.VerticesSP = MakeShared<FOccluderVertexArray, ESPMode::ThreadSafe>(FOccluderVertexArray({ A, B, C, D }));
+		Mesh.IndicesSP = MakeShared<FOccluderIndexArray, ESPMode::ThreadSafe>(FOccluderIndexArray({ 0, 1, 2, 0, 2, 3, 0, 2, 1, 0, 3, 2 }));
+		Scene.NumOccluderTriangles += 4;
+	}
+
+	static void AddBox(FOcclusionSceneData& Scene, uint32 PrimId, const FVector& Center, const FVector& Extent)
+	{
+		Scene.OccludeeBoxMinMax.Add(Center - Extent);
+		Scene.OccludeeBoxMinMax.Add(Center + Extent);
+		Scene.OccludeeBoxPrimId.Add(MakePrimId(PrimId));
+	}
+
+	static TUniquePtr<FOcclusionFrameResults> Process(const FOcclusionSceneData& Scene, bool bUseSIMD)
+	{
+		// MakeUnique value-initializes, which clears the framebuffer bins
+		TUniquePtr<FOcclusionFrameResults> Results = MakeUnique<FOcclusionFrameResults>();
+		SoftwareOcclusion::ProcessOcclusionFrame(Scene, *Results, bUseSIMD);
+		return Results;
+	}
+
+	/**
+	 * Brute force reference: an occludee is visible unless every pixel of its screen rect is covered by an
+	 * occluder triangle that is entirely closer than the closest point of the occludee.
+	 */
+	class FReferenceRasterizer
+	{
+	public:
+		explicit FReferenceRasterizer(const FOcclusionSceneData& InScene)
+			: Scene(InScene)
+		{
+			for (const FOcclusionMeshData& Mesh : Scene.OccluderData)
+			{
+				const FMatrix LocalToClip = Mesh.LocalToWorld * Scene.ViewProj;
+				const FOccluderVertexArray& Vertices = *Mesh.VerticesSP;
+				const FOccluderIndexArray& Indices = *Mesh.IndicesSP;
+
+				for (int32 i = 0; i + 2 < Indices.Num(); i += 3)
+				{
+					FTri Tri;
+					bool bValid = true;
+					Tri.Depth = MAX_flt;
+					for (int32 j = 0; j < 3; ++j)
+					{
+						float Depth;
+						bValid &= Project(LocalToClip, Vertices[Indices[i + j]], Tri.V[j], Depth);
+						Tri.Depth = FMath::Min(Tri.Depth, Depth);
+					}
+					if (bValid)
+					{
+						Tris.Add(Tri);
+					}
+				}
+			}
+		}
+
+		bool IsVisible(int32 BoxIndex) const
+		{
+			const FVector& Min = Scene.OccludeeBoxMinMax[BoxIndex * 2 + 0];
+			const FVector& Max = Scene.OccludeeBoxMinMax[BoxIndex * 2 + 1];
+
+			FVector2D ScreenMin(MAX_flt, MAX_flt);
+			FVector2D ScreenMax(-MAX_flt, -MAX_flt);
+			float BoxDepth = 0.0f;
+			for (int32 Corner = 0; Corner < 8; ++Corner)
+			{
+				const FVector P((Corner & 1) ? Max.X : Min.X, (Corner & 2) ? Max.Y : Min.Y, (Corner & 4) ? Max.Z : Min.Z);
+				FVector2D Screen;
+				float Depth;
+				if (!Project(Scene.ViewProj, P, Screen, Depth))
+				{
+					// Crosses the near plane
+					return true;
+				}
+				ScreenMin = FVector2D::Min(ScreenMin, Screen);
+				ScreenMax = FVector2D::Max(ScreenMax, Screen);
+				BoxDepth = FMath::Max(BoxDepth, Depth);
+			}
+
+			const int32 X0 = FMath::Max(0, FMath::FloorToInt32(ScreenMin.X + 0.5));
+			const int32 Y0 = FMath::Max(0, FMath::FloorToInt32(ScreenMin.Y + 0.5));
+			const int32 X1 = FMath::Min(FRAMEBUFFER_WIDTH - 1, FMath::FloorToInt32(ScreenMax.X + 0.5));
+			const int32 Y1 = FMath::Min(FRAMEBUFFER_HEIGHT - 1, FMath::FloorToInt32(ScreenMax.Y + 0.5));
+
+			for (int32 Y = Y0; Y <= Y1; ++Y)
+			{
+				for (int32 X = X0; X <= X1; ++X)
+				{
+					if (!IsCovered(FVector2D(X, Y), BoxDepth))
+					{
+						return true;
+					}
+				}
+			}
+
+			return false;
+		}
+
+	private:
+		struct FTri
+		{
+			FVector2D V[3];
+			float Depth;
+		};
+
+		static bool Project(const FMatrix& Mat, const FVector& P, FVector2D& OutScreen, float& OutDepth)
+		{
+			const FVector4 Clip = Mat.TransformFVector4(FVector4(P, 1.0));
+			if (Clip.W < NearPlane)
+			{
+				return false;
+			}
+			OutScreen.X = (Clip.X / Clip.W + 1.0) * 0.5 * FRAMEBUFFER_WIDTH;
+			OutScreen.Y = (Clip.Y / Clip.W + 1.0) * 0.5 * FRAMEBUFFER_HEIGHT;
+			OutDepth = Clip.Z / Clip.W;
+			return true;
+		}
+
+		bool IsCovered(const FVector2D& Sample, float OccludeeDepth) const
+		{
+			for (const FTri& Tri : Tris)
+			{
+				if (Tri.Depth <= OccludeeDepth)
+				{
+					continue;
+				}
+
+				const double E0 = FVector2D::CrossProduct(Tri.V[1] - Tri.V[0], Sample - Tri.V[0]);
+				const double E1 = FVector2D::CrossProduct(Tri.V[2] - Tri.V[1], Sample - Tri.V[1]);
+				const double E2 = FVector2D::CrossProduct(Tri.V[0] - Tri.V[2], Sample - Tri.V[2]);
+				if ((E0 >= 0 && E1 >= 0 && E2 >= 0) || (E0 <= 0 && E1 <= 0 && E2 <= 0))
+				{
+					return true;
+				}
+			}
+			return false;
+		}
+
+		const FOcclusionSceneData& Scene;
+		TArray<FTri> Tris;
+	};
+} // namespace SoftwareOcclusionTest
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FSoftwareOcclusionReferenceSceneTest,
+	"OculusXR.SoftwareOcclusion.Rasterizer.ReferenceScene",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FSoftwareOcclusionReferenceSceneTest::RunTest(const FString& Parameters)
+{
+	using namespace SoftwareOcclusionTest;
+
+	FOcclusionSceneData Scene;
+	InitScene(Scene);
+
+	// Wall covering the left half of the screen at distance 1000
+	AddWall(Scene, 100, FVector(1000, -2000, -2000), FVector(1000, 0, -2000), FVector(1000, 0, 2000), FVector(1000, -2000, 2000));
+
+	struct FCase
+	{
+		const TCHAR* Name;
+		FVector Center;
+		FVector Extent;
+		bool bExpectedVisible;
+	};
+	const FCase Cases[] = {
+		{ TEXT("Behind wall"), FVector(2000, -1000, 0), FVector(100), false },
+		{ TEXT("Beside wall"), FVector(2000, 1000, 0), FVector(100), true },
+		{ TEXT("In front of wall"), FVector(500, -200, 0), FVector(50), true },
+		{ TEXT("Partially behind wall"), FVector(2000, 0, 0), FVector(100), true },
+		{ TEXT("Off screen"), FVector(2000, -5000, 0), FVector(100), false },
+		{ TEXT("Behind camera"), FVector(-500, 0, 0), FVector(100), true },
+		{ TEXT("Crossing near plane"), FVector(0, 0, 0), FVector(100), true },
+	};
+
+	for (int32 i = 0; i < UE_ARRAY_COUNT(Cases); ++i)
+	{
+		AddBox(Scene, i + 1, Cases[i].Center, Cases[i].Extent);
+	}
+
+	const FReferenceRasterizer Reference(Scene);
+	const TUniquePtr<FOcclusionFrameResults> SIMDResults = Process(Scene, true);
+	const TUniquePtr<FOcclusionFrameResults> ScalarResults = Process(Scene, false);
+
+	for (int32 i = 0; i < UE_ARRAY_COUNT(Cases); ++i)
+	{
+		const FPrimitiveComponentId PrimId = MakePrimId(i + 1);
+		const bool* SIMDVisible = SIMDResults->VisibilityMap.Find(PrimId);
+		const bool* ScalarVisible = ScalarResults->VisibilityMap.Find(PrimId);
+
+		TestEqual(FString::Printf(TEXT("%s: reference"), Cases[i].Name), Reference.IsVisible(i), Cases[i].bExpectedVisible);
+		if (TestNotNull(FString::Printf(TEXT("%s: SIMD result"), Cases[i].Name), SIMDVisible))
+		{
+			TestEqual(FString::Printf(TEXT("%s: SIMD"), Cases[i].Name), *SIMDVisible, Cases[i].bExpectedVisible);
+		}
+		if (TestNotNull(FString::Printf(TEXT("%s: scalar result"), Cases[i].Name), ScalarVisible))
+		{
+			TestEqual(FString::Printf(TEXT("%s: scalar"), Cases[i].Name), *ScalarVisible, Cases[i].bExpectedVisible);
+		}
+	}
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FSoftwareOcclusionOccludeeSIMDScalarTest,
+	"OculusXR.SoftwareOcclusion.Rasterizer.OccludeeSIMDMatchesScalar",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FSoftwareOcclusionOccludeeSIMDScalarTest::RunTest(const FString& Parameters)
+{
+	using namespace SoftwareOcclusionTest;
+
+	const int32 NumBoxes = 1024;
+	FRandomStream Random(1234);
+
+	TArray<FVector> MinMax;
+	for (int32 i = 0; i < NumBoxes; ++i)
+	{
+		const FVector Center(Random.FRandRange(-500, 5000), Random.FRandRange(-3000, 3000), Random.FRandRange(-3000, 3000));
+		const FVector Extent(Random.FRandRange(10, 300), Random.FRandRange(10, 300), Random.FRandRange(10, 300));
+		MinMax.Add(Center - Extent);
+		MinMax.Add(Center + Extent);
+	}
+
+	const FMatrix WorldToFB = MakeViewProj() * SoftwareOcclusion::GetFramebufferMatrix();
+
+	MS_ALIGN(SIMD_ALIGNMENT)
+	int32 SIMDQuads[NumBoxes * 4] GCC_ALIGN(SIMD_ALIGNMENT);
+	float SIMDDepths[NumBoxes];
+	int32 SIMDClipped[NumBoxes];
+	int32 ScalarQuads[NumBoxes * 4];
+	float ScalarDepths[NumBoxes];
+	int32 ScalarClipped[NumBoxes];
+
+	SoftwareOcclusion::ProcessOccludeeGeomSIMD(WorldToFB, MinMax.GetData(), NumBoxes, SIMDQuads, SIMDDepths, SIMDClipped);
+	SoftwareOcclusion::ProcessOccludeeGeomScalar(WorldToFB, MinMax.GetData(), NumBoxes, ScalarQuads, ScalarDepths, ScalarClipped);
+
+	int32 NumMismatches = 0;
+	for (int32 i = 0; i < NumBoxes; ++i)
+	{
+		const bool bSIMDClipped = SIMDClipped[i] != 0;
+		const bool bScalarClipped = ScalarClipped[i] != 0;
+		if (bSIMDClipped != bScalarClipped)
+		{
+			NumMismatches++;
+			continue;
+		}
+
+		if (bScalarClipped)
+		{
+			// Scalar path stops at the first clipped corner and leaves the quad untouched
+			continue;
+		}
+
+		// Rounding of the two paths may differ by one pixel
+		bool bMatches = FMath::IsNearlyEqual(SIMDDepths[i], ScalarDepths[i], 1.e-4f);
+		for (int32 j = 0; j < 4; ++j)
+		{
+			bMatches &= FMath::Abs(SIMDQuads[i * 4 + j] - ScalarQuads[i * 4 + j]) <= 1;
+		}
+		NumMismatches += bMatches ? 0 : 1;
+	}
+
+	TestEqual(TEXT("SIMD and scalar occludee quads match"), NumMismatches, 0);
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(
+	FSoftwareOcclusionRandomSceneTest,
+	"OculusXR.SoftwareOcclusion.Rasterizer.RandomSceneMatchesReference",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FSoftwareOcclusionRandomSceneTest::RunTest(const FString& Parameters)
+{
+	using namespace SoftwareOcclusionTest;
+
+	FOcclusionSceneData Scene;
+	InitScene(Scene);
+
+	FRandomStream Random(4321);
+	for (int32 i = 0; i < 16; ++i)
+	{
+		const float X = Random.FRandRange(300, 3000);
+		const float Y = Random.FRandRange(-2000, 2000);
+		const float Z = Random.FRandRange(-1500, 1500);
+		const float HalfSize = Random.FRandRange(100, 600);
+		AddWall(Scene, 1000 + i,
+			FVector(X, Y - HalfSize, Z - HalfSize), FVector(X, Y + HalfSize, Z - HalfSize),
+			FVector(X, Y + HalfSize, Z + HalfSize), FVector(X, Y - HalfSize, Z + HalfSize));
+	}
+
+	const int32 NumBoxes = 512;
+	for (int32 i = 0; i < NumBoxes; ++i)
+	{
+		const FVector Center(Random.FRandRange(200, 6000), Random.FRandRange(-4000, 4000), Random.FRandRange(-3000, 3000));
+		AddBox(Scene, i + 1, Center, FVector(Random.FRandRange(10, 200)));
+	}
+
+	const FReferenceRasterizer Reference(Scene);
+	const TUniquePtr<FOcclusionFrameResults> SIMDResults = Process(Scene, true);
+	const TUniquePtr<FOcclusionFrameResults> ScalarResults = Process(Scene, false);
+
+	int32 NumSIMDMismatches = 0;
+	int32 NumScalarMismatches = 0;
+	int32 NumOccluded = 0;
+	for (int32 i = 0; i < NumBoxes; ++i)
+	{
+		const bool bExpected = Reference.IsVisible(i);
+		NumOccluded += bExpected ? 0 : 1;
+
+		const FPrimitiveComponentId PrimId = MakePrimId(i + 1);
+		NumSIMDMismatches += (SIMDResults->VisibilityMap.FindRef(PrimId) != bExpected) ? 1 : 0;
+		NumScalarMismatches += (ScalarResults->VisibilityMap.FindRef(PrimId) != bExpected) ? 1 : 0;
+	}
+
+	// Pixel snapping differs slightly between the binned rasterizer and the reference, allow boundary cases
+	const int32 MaxMismatches = NumBoxes / 50;
+	TestTrue(TEXT("Scene has occluded boxes"), NumOccluded > 0);
+	TestTrue(FString::Printf(TEXT("SIMD matches reference (%d mismatches)"), NumSIMDMismatches), NumSIMDMismatches <= MaxMismatches);
+	TestTrue(FString::Printf(TEXT("Scalar matches reference (%d mismatches)"), NumScalarMismatches), NumScalarMismatches <= MaxMismatches);
+	return true;
+}
+
+#endif // WITH_OCULUS_BRANCH
+#endif // WITH_DEV_AUTOMATION_TESTS